@@ -0,0 +1,372 @@
+# Sources of MediaElch without main.cpp, shared by the application and tests/benchmark
+
+include($$PWD/quazip/quazip/quazip.pri)
+
+QT       += core gui network script xml sql widgets multimedia multimediawidgets concurrent
+
+LIBS += -lmediainfo -lzen -lz
+
+unix:LIBS += -lcurl
+macx:LIBS += -framework Foundation
+
+DEFINES += UNICODE
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+SOURCES += \
+    $$PWD/main/MainWindow.cpp \
+    $$PWD/movies/Movie.cpp \
+    $$PWD/data/MovieFileSearcher.cpp \
+    $$PWD/mediaCenterPlugins/XbmcXml.cpp \
+    $$PWD/scrapers/TMDb.cpp \
+    $$PWD/globals/Manager.cpp \
+    $$PWD/movies/MovieSearch.cpp \
+    $$PWD/smallWidgets/MyLineEdit.cpp \
+    $$PWD/movies/MovieWidget.cpp \
+    $$PWD/smallWidgets/MyLabel.cpp \
+    $$PWD/globals/DownloadManager.cpp \
+    $$PWD/movies/FilesWidget.cpp \
+    $$PWD/data/MovieModel.cpp \
+    $$PWD/data/MovieProxyModel.cpp \
+    $$PWD/main/AboutDialog.cpp \
+    $$PWD/scrapers/VideoBuster.cpp \
+    $$PWD/scrapers/HtmlExtractor.cpp \
+    $$PWD/scrapers/OFDb.cpp \
+    $$PWD/scrapers/Cinefacts.cpp \
+    $$PWD/smallWidgets/MyTableWidget.cpp \
+    $$PWD/notifications/NotificationBox.cpp \
+    $$PWD/main/Message.cpp \
+    $$PWD/data/TvShow.cpp \
+    $$PWD/data/TvShowFileSearcher.cpp \
+    $$PWD/data/TvShowModel.cpp \
+    $$PWD/tvShows/TvShowFilesWidget.cpp \
+    $$PWD/data/TvShowProxyModel.cpp \
+    $$PWD/data/TvShowModelItem.cpp \
+    $$PWD/data/TvShowEpisode.cpp \
+    $$PWD/data/TvShowDelegate.cpp \
+    $$PWD/tvShows/TvShowWidget.cpp \
+    $$PWD/tvShows/TvShowWidgetEpisode.cpp \
+    $$PWD/tvShows/TvShowWidgetTvShow.cpp \
+    $$PWD/scrapers/TheTvDb.cpp \
+    $$PWD/tvShows/TvShowSearch.cpp \
+    $$PWD/globals/DownloadManagerElement.cpp \
+    $$PWD/smallWidgets/ImageLabel.cpp \
+    $$PWD/globals/ImagePreviewDialog.cpp \
+    $$PWD/sets/SetsWidget.cpp \
+    $$PWD/sets/MovieListDialog.cpp \
+    $$PWD/globals/Helper.cpp \
+    $$PWD/globals/JsonValue.cpp \
+    $$PWD/globals/Logger.cpp \
+    $$PWD/globals/Tracer.cpp \
+    $$PWD/globals/DirectoryListing.cpp \
+    $$PWD/smallWidgets/MyTreeView.cpp \
+    $$PWD/globals/ImageDialog.cpp \
+    $$PWD/settings/DataFile.cpp \
+    $$PWD/data/ConcertFileSearcher.cpp \
+    $$PWD/data/ConcertModel.cpp \
+    $$PWD/data/ConcertProxyModel.cpp \
+    $$PWD/data/Concert.cpp \
+    $$PWD/concerts/ConcertWidget.cpp \
+    $$PWD/concerts/ConcertSearch.cpp \
+    $$PWD/concerts/ConcertFilesWidget.cpp \
+    $$PWD/scrapers/TMDbConcerts.cpp \
+    $$PWD/settings/Settings.cpp \
+    $$PWD/movies/GenreWidget.cpp \
+    $$PWD/movies/CertificationWidget.cpp \
+    $$PWD/support/SupportDialog.cpp \
+    $$PWD/main/FileScannerDialog.cpp \
+    $$PWD/globals/Filter.cpp \
+    $$PWD/data/MovieFilesOrganizer.cpp \
+    $$PWD/globals/NameFormatter.cpp \
+    $$PWD/imageProviders/FanartTv.cpp \
+    $$PWD/imageProviders/FanartTvMusicArtists.cpp \
+    $$PWD/imageProviders/TMDbImages.cpp \
+    $$PWD/imageProviders/TheTvDbImages.cpp \
+    $$PWD/globals/ComboDelegate.cpp \
+    $$PWD/data/StreamDetails.cpp \
+    $$PWD/data/StreamDetailsService.cpp \
+    $$PWD/smallWidgets/MediaFlags.cpp \
+    $$PWD/data/BatchSaver.cpp \
+    $$PWD/data/SafeFileWriter.cpp \
+    $$PWD/data/StagedImage.cpp \
+    $$PWD/data/Database.cpp \
+    $$PWD/smallWidgets/LoadingStreamDetails.cpp \
+    $$PWD/trailerProviders/MovieMaze.cpp \
+    $$PWD/globals/TrailerDialog.cpp \
+    $$PWD/smallWidgets/SlidingStackedWidget.cpp \
+    $$PWD/scrapers/IMDB.cpp \
+    $$PWD/xbmc/XbmcSync.cpp \
+    $$PWD/smallWidgets/MyCheckBox.cpp \
+    $$PWD/movies/MovieController.cpp \
+    $$PWD/movies/MovieMultiScrapeDialog.cpp \
+    $$PWD/smallWidgets/Badge.cpp \
+    $$PWD/trailerProviders/HdTrailers.cpp \
+    $$PWD/smallWidgets/TagCloud.cpp \
+    $$PWD/smallWidgets/MyWidget.cpp \
+    $$PWD/data/Storage.cpp \
+    $$PWD/tvShows/TvShowWidgetSeason.cpp \
+    $$PWD/smallWidgets/ImageGallery.cpp \
+    $$PWD/smallWidgets/ClosableImage.cpp \
+    $$PWD/renamer/Renamer.cpp \
+    $$PWD/smallWidgets/MySpinBox.cpp \
+    $$PWD/settings/AdvancedSettings.cpp \
+    $$PWD/smallWidgets/AlphabeticalList.cpp \
+    $$PWD/smallWidgets/MyTableView.cpp \
+    $$PWD/data/ImageCache.cpp \
+    $$PWD/data/PreviewCache.cpp \
+    $$PWD/data/MovieIndex.cpp \
+    $$PWD/data/LibraryCacheLoader.cpp \
+    $$PWD/scrapers/TvTunes.cpp \
+    $$PWD/tvShows/TvTunesDialog.cpp \
+    $$PWD/settings/SettingsWindow.cpp \
+    $$PWD/export/ExportTemplateLoader.cpp \
+    $$PWD/export/ExportTemplate.cpp \
+    $$PWD/settings/ExportTemplateWidget.cpp \
+    $$PWD/smallWidgets/StyledPushButton.cpp \
+    $$PWD/export/CompiledTemplate.cpp \
+    $$PWD/export/ExportDialog.cpp \
+    $$PWD/export/ExportManifest.cpp \
+    $$PWD/export/Exporter.cpp \
+    $$PWD/smallWidgets/MessageLabel.cpp \
+    $$PWD/smallWidgets/SearchOverlay.cpp \
+    $$PWD/tvShows/ItemWidgetShow.cpp \
+    $$PWD/scrapers/CustomMovieScraper.cpp \
+    $$PWD/scrapers/MediaPassion.cpp \
+    $$PWD/imageProviders/MediaPassionImages.cpp \
+    $$PWD/downloads/DownloadsWidget.cpp \
+    $$PWD/smallWidgets/MyTableWidgetItem.cpp \
+    $$PWD/downloads/UnpackButtons.cpp \
+    $$PWD/downloads/Extractor.cpp \
+    $$PWD/downloads/ImportActions.cpp \
+    $$PWD/movies/MovieSearchWidget.cpp \
+    $$PWD/downloads/ImportDialog.cpp \
+    $$PWD/downloads/FileWorker.cpp \
+    $$PWD/downloads/MyFile.cpp \
+    $$PWD/concerts/ConcertSearchWidget.cpp \
+    $$PWD/concerts/ConcertController.cpp \
+    $$PWD/smallWidgets/MySplitter.cpp \
+    $$PWD/smallWidgets/MySplitterHandle.cpp \
+    $$PWD/tvShows/TvShowSearchEpisode.cpp \
+    $$PWD/notifications/Notificator.cpp \
+    $$PWD/main/Update.cpp \
+    $$PWD/tvShows/TvShowUpdater.cpp \
+    $$PWD/scrapers/AEBN.cpp \
+    $$PWD/scrapers/HotMovies.cpp \
+    $$PWD/scrapers/AdultDvdEmpire.cpp \
+    $$PWD/main/Navbar.cpp \
+    $$PWD/smallWidgets/FilterWidget.cpp \
+    $$PWD/downloads/MakeMkvDialog.cpp \
+    $$PWD/downloads/MakeMkvCon.cpp
+
+macx {
+    OBJECTIVE_SOURCES += $$PWD/notifications/MacNotificationHandler.mm
+}
+
+HEADERS += \
+    $$PWD/main/MainWindow.h \
+    $$PWD/movies/Movie.h \
+    $$PWD/globals/Globals.h \
+    $$PWD/data/MediaCenterInterface.h \
+    $$PWD/data/MovieFileSearcher.h \
+    $$PWD/mediaCenterPlugins/XbmcXml.h \
+    $$PWD/scrapers/TMDb.h \
+    $$PWD/data/ScraperInterface.h \
+    $$PWD/globals/Manager.h \
+    $$PWD/movies/MovieSearch.h \
+    $$PWD/smallWidgets/MyLineEdit.h \
+    $$PWD/movies/MovieWidget.h \
+    $$PWD/smallWidgets/MyLabel.h \
+    $$PWD/globals/DownloadManager.h \
+    $$PWD/movies/FilesWidget.h \
+    $$PWD/data/MovieModel.h \
+    $$PWD/data/MovieProxyModel.h \
+    $$PWD/main/AboutDialog.h \
+    $$PWD/scrapers/VideoBuster.h \
+    $$PWD/scrapers/HtmlExtractor.h \
+    $$PWD/scrapers/OFDb.h \
+    $$PWD/scrapers/Cinefacts.h \
+    $$PWD/smallWidgets/FilterWidget.h \
+    $$PWD/smallWidgets/MyTableWidget.h \
+    $$PWD/notifications/NotificationBox.h \
+    $$PWD/main/Message.h \
+    $$PWD/data/TvShow.h \
+    $$PWD/data/TvShowFileSearcher.h \
+    $$PWD/data/TvShowModel.h \
+    $$PWD/tvShows/TvShowFilesWidget.h \
+    $$PWD/data/TvShowProxyModel.h \
+    $$PWD/data/TvShowModelItem.h \
+    $$PWD/data/TvShowEpisode.h \
+    $$PWD/data/TvShowDelegate.h \
+    $$PWD/tvShows/TvShowWidget.h \
+    $$PWD/tvShows/TvShowWidgetEpisode.h \
+    $$PWD/tvShows/TvShowWidgetTvShow.h \
+    $$PWD/scrapers/TheTvDb.h \
+    $$PWD/data/TvScraperInterface.h \
+    $$PWD/tvShows/TvShowSearch.h \
+    $$PWD/globals/DownloadManagerElement.h \
+    $$PWD/smallWidgets/ImageLabel.h \
+    $$PWD/globals/ImagePreviewDialog.h \
+    $$PWD/sets/SetsWidget.h \
+    $$PWD/sets/MovieListDialog.h \
+    $$PWD/globals/Helper.h \
+    $$PWD/globals/JsonValue.h \
+    $$PWD/globals/Logger.h \
+    $$PWD/globals/Tracer.h \
+    $$PWD/globals/DirectoryListing.h \
+    $$PWD/smallWidgets/MyTreeView.h \
+    $$PWD/globals/ImageDialog.h \
+    $$PWD/settings/DataFile.h \
+    $$PWD/data/ConcertFileSearcher.h \
+    $$PWD/data/ConcertModel.h \
+    $$PWD/data/ConcertProxyModel.h \
+    $$PWD/data/Concert.h \
+    $$PWD/data/ConcertScraperInterface.h \
+    $$PWD/concerts/ConcertWidget.h \
+    $$PWD/concerts/ConcertSearch.h \
+    $$PWD/concerts/ConcertFilesWidget.h \
+    $$PWD/scrapers/TMDbConcerts.h \
+    $$PWD/settings/Settings.h \
+    $$PWD/movies/GenreWidget.h \
+    $$PWD/movies/CertificationWidget.h \
+    $$PWD/support/SupportDialog.h \
+    $$PWD/main/FileScannerDialog.h \
+    $$PWD/globals/Filter.h \
+    $$PWD/data/MovieFilesOrganizer.h \
+    $$PWD/globals/NameFormatter.h \
+    $$PWD/data/ImageProviderInterface.h \
+    $$PWD/imageProviders/FanartTv.h \
+    $$PWD/imageProviders/FanartTvMusicArtists.h \
+    $$PWD/imageProviders/TMDbImages.h \
+    $$PWD/imageProviders/TheTvDbImages.h \
+    $$PWD/globals/ComboDelegate.h \
+    $$PWD/data/StreamDetails.h \
+    $$PWD/data/StreamDetailsService.h \
+    $$PWD/smallWidgets/MediaFlags.h \
+    $$PWD/data/BatchSaver.h \
+    $$PWD/data/SafeFileWriter.h \
+    $$PWD/data/StagedImage.h \
+    $$PWD/data/Database.h \
+    $$PWD/smallWidgets/LoadingStreamDetails.h \
+    $$PWD/trailerProviders/TrailerProvider.h \
+    $$PWD/trailerProviders/MovieMaze.h \
+    $$PWD/globals/TrailerDialog.h \
+    $$PWD/smallWidgets/SlidingStackedWidget.h \
+    $$PWD/scrapers/IMDB.h \
+    $$PWD/xbmc/XbmcSync.h \
+    $$PWD/smallWidgets/MyCheckBox.h \
+    $$PWD/movies/MovieController.h \
+    $$PWD/movies/MovieMultiScrapeDialog.h \
+    $$PWD/smallWidgets/Badge.h \
+    $$PWD/trailerProviders/HdTrailers.h \
+    $$PWD/smallWidgets/TagCloud.h \
+    $$PWD/smallWidgets/MyWidget.h \
+    $$PWD/data/Storage.h \
+    $$PWD/tvShows/TvShowWidgetSeason.h \
+    $$PWD/smallWidgets/ImageGallery.h \
+    $$PWD/smallWidgets/ClosableImage.h \
+    $$PWD/renamer/Renamer.h \
+    $$PWD/smallWidgets/MySpinBox.h \
+    $$PWD/settings/AdvancedSettings.h \
+    $$PWD/smallWidgets/AlphabeticalList.h \
+    $$PWD/smallWidgets/MyTableView.h \
+    $$PWD/data/ImageCache.h \
+    $$PWD/data/PreviewCache.h \
+    $$PWD/data/MovieIndex.h \
+    $$PWD/data/LibraryCacheLoader.h \
+    $$PWD/scrapers/TvTunes.h \
+    $$PWD/tvShows/TvTunesDialog.h \
+    $$PWD/globals/LocaleStringCompare.h \
+    $$PWD/settings/SettingsWindow.h \
+    $$PWD/export/ExportTemplateLoader.h \
+    $$PWD/export/ExportTemplate.h \
+    $$PWD/settings/ExportTemplateWidget.h \
+    $$PWD/smallWidgets/StyledPushButton.h \
+    $$PWD/export/CompiledTemplate.h \
+    $$PWD/export/ExportDialog.h \
+    $$PWD/export/ExportManifest.h \
+    $$PWD/export/Exporter.h \
+    $$PWD/smallWidgets/MessageLabel.h \
+    $$PWD/smallWidgets/SearchOverlay.h \
+    $$PWD/tvShows/ItemWidgetShow.h \
+    $$PWD/scrapers/CustomMovieScraper.h \
+    $$PWD/scrapers/MediaPassion.h \
+    $$PWD/imageProviders/MediaPassionImages.h \
+    $$PWD/downloads/DownloadsWidget.h \
+    $$PWD/smallWidgets/MyTableWidgetItem.h \
+    $$PWD/downloads/UnpackButtons.h \
+    $$PWD/downloads/Extractor.h \
+    $$PWD/downloads/ImportActions.h \
+    $$PWD/movies/MovieSearchWidget.h \
+    $$PWD/downloads/ImportDialog.h \
+    $$PWD/downloads/FileWorker.h \
+    $$PWD/downloads/MyFile.h \
+    $$PWD/concerts/ConcertSearchWidget.h \
+    $$PWD/concerts/ConcertController.h \
+    $$PWD/smallWidgets/MySplitter.h \
+    $$PWD/smallWidgets/MySplitterHandle.h \
+    $$PWD/tvShows/TvShowSearchEpisode.h \
+    $$PWD/notifications/Notificator.h \
+    $$PWD/notifications/MacNotificationHandler.h \
+    $$PWD/main/Update.h \
+    $$PWD/tvShows/TvShowUpdater.h \
+    $$PWD/scrapers/AEBN.h \
+    $$PWD/scrapers/HotMovies.h \
+    $$PWD/scrapers/AdultDvdEmpire.h \
+    $$PWD/main/Navbar.h \
+    $$PWD/downloads/MakeMkvDialog.h \
+    $$PWD/downloads/MakeMkvCon.h
+
+FORMS += \
+    $$PWD/main/MainWindow.ui \
+    $$PWD/movies/MovieSearch.ui \
+    $$PWD/movies/MovieWidget.ui \
+    $$PWD/movies/FilesWidget.ui \
+    $$PWD/main/AboutDialog.ui \
+    $$PWD/smallWidgets/FilterWidget.ui \
+    $$PWD/notifications/NotificationBox.ui \
+    $$PWD/main/Message.ui \
+    $$PWD/tvShows/TvShowFilesWidget.ui \
+    $$PWD/tvShows/TvShowWidget.ui \
+    $$PWD/tvShows/TvShowWidgetEpisode.ui \
+    $$PWD/tvShows/TvShowWidgetTvShow.ui \
+    $$PWD/tvShows/TvShowSearch.ui \
+    $$PWD/smallWidgets/ImageLabel.ui \
+    $$PWD/globals/ImagePreviewDialog.ui \
+    $$PWD/sets/SetsWidget.ui \
+    $$PWD/sets/MovieListDialog.ui \
+    $$PWD/globals/ImageDialog.ui \
+    $$PWD/concerts/ConcertWidget.ui \
+    $$PWD/concerts/ConcertSearch.ui \
+    $$PWD/concerts/ConcertFilesWidget.ui \
+    $$PWD/movies/GenreWidget.ui \
+    $$PWD/movies/CertificationWidget.ui \
+    $$PWD/support/SupportDialog.ui \
+    $$PWD/main/FileScannerDialog.ui \
+    $$PWD/smallWidgets/MediaFlags.ui \
+    $$PWD/smallWidgets/LoadingStreamDetails.ui \
+    $$PWD/globals/TrailerDialog.ui \
+    $$PWD/xbmc/XbmcSync.ui \
+    $$PWD/movies/MovieMultiScrapeDialog.ui \
+    $$PWD/smallWidgets/TagCloud.ui \
+    $$PWD/tvShows/TvShowWidgetSeason.ui \
+    $$PWD/renamer/Renamer.ui \
+    $$PWD/tvShows/TvTunesDialog.ui \
+    $$PWD/settings/SettingsWindow.ui \
+    $$PWD/settings/ExportTemplateWidget.ui \
+    $$PWD/export/ExportDialog.ui \
+    $$PWD/tvShows/ItemWidgetShow.ui \
+    $$PWD/downloads/DownloadsWidget.ui \
+    $$PWD/downloads/UnpackButtons.ui \
+    $$PWD/downloads/ImportActions.ui \
+    $$PWD/movies/MovieSearchWidget.ui \
+    $$PWD/downloads/ImportDialog.ui \
+    $$PWD/concerts/ConcertSearchWidget.ui \
+    $$PWD/tvShows/TvShowSearchEpisode.ui \
+    $$PWD/main/Navbar.ui \
+    $$PWD/downloads/MakeMkvDialog.ui
+
+RESOURCES += \
+    $$PWD/MediaElch.qrc \
+    $$PWD/i18n.qrc
+
@@ -2,8 +2,10 @@
 
 #include <QDir>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QtCore/qmath.h>
 #include "data/ImageCache.h"
+#include "data/StreamDetailsService.h"
 #include "globals/DownloadManagerElement.h"
 #include "globals/Helper.h"
 #include "globals/NameFormatter.h"
@@ -29,13 +31,25 @@ bool ConcertController::saveData(MediaCenterInterface *mediaCenterInterface)
     if (!m_concert->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails())
         loadStreamDetailsFromFile();
     bool saved = mediaCenterInterface->saveConcert(m_concert);
+    setSaved(saved);
+    return saved;
+}
+
+/**
+ * @brief Marks the concert as saved, clears its changed state and the staged images.
+ *        A BatchSaver calls this only after all files of the concert were written.
+ * @param saved The nfo file was saved
+ */
+void ConcertController::setSaved(bool saved)
+{
     if (!m_infoLoaded)
         m_infoLoaded = saved;
+    if (saved)
+        m_infoFromNfoLoaded = true;
     m_concert->setChanged(false);
     m_concert->clearImages();
     m_concert->clearExtraFanartData();
     m_concert->setSyncNeeded(true);
-    return saved;
 }
 
 bool ConcertController::loadData(MediaCenterInterface *mediaCenterInterface, bool force, bool reloadFromNfo)
@@ -101,9 +115,57 @@ void ConcertController::loadData(QString id, ConcertScraperInterface *scraperInt
     scraperInterface->loadData(id, m_concert, infos);
 }
 
+/**
+ * @brief Tries to load streamdetails from the file
+ *        Unchanged files are served from the cache, otherwise this blocks until the probe has finished.
+ *        Interactive code should use loadStreamDetailsInBackground instead.
+ * @see StreamDetailsService::load
+ */
 void ConcertController::loadStreamDetailsFromFile()
 {
-    m_concert->streamDetails()->loadStreamDetails();
+    setStreamDetails(StreamDetailsService::instance()->load(m_concert->files()).result());
+}
+
+/**
+ * @brief Loads streamdetails from the file without blocking
+ *        Cached results are applied immediately, otherwise they are applied
+ *        when the probe has finished and sigStreamDetailsLoaded is emitted.
+ * @see StreamDetailsService::load
+ */
+void ConcertController::loadStreamDetailsInBackground()
+{
+    QFuture<QString> future = StreamDetailsService::instance()->load(m_concert->files());
+    if (future.isFinished()) {
+        setStreamDetails(future.result());
+        return;
+    }
+
+    QFutureWatcher<QString> *watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onStreamDetailsLoaded()));
+    watcher->setFuture(future);
+}
+
+/**
+ * @brief Applies the result of a background probe
+ *        Streamdetails which were loaded in the meantime (e.g. while saving) are kept.
+ */
+void ConcertController::onStreamDetailsLoaded()
+{
+    QFutureWatcher<QString> *watcher = static_cast<QFutureWatcher<QString>*>(QObject::sender());
+    watcher->deleteLater();
+    if (m_concert->streamDetailsLoaded())
+        return;
+    setStreamDetails(watcher->result());
+    emit sigStreamDetailsLoaded(m_concert);
+}
+
+/**
+ * @brief Assigns the result of a probe to the concert and updates its runtime
+ * @param content <streamdetails> xml
+ */
+void ConcertController::setStreamDetails(const QString &content)
+{
+    StreamDetailsService::instance()->assign(m_concert->streamDetails(), content);
     m_concert->setRuntime(qFloor(m_concert->streamDetails()->videoDetails().value("durationinseconds").toInt()/60));
     m_concert->setStreamDetailsLoaded(true);
     m_concert->setChanged(true);
@@ -189,14 +251,14 @@ void ConcertController::onDownloadFinished(DownloadManagerElement elem)
     m_downloadsLeft--;
     emit sigDownloadProgress(m_concert, m_downloadsLeft, m_downloadsSize);
 
-    if (!elem.data.isEmpty()) {
+    if (!elem.image.isNull()) {
         ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(m_concert, elem.imageType));
         if (elem.imageType == ImageType::ConcertBackdrop)
-            Helper::resizeBackdrop(elem.data);
-        m_concert->setImage(elem.imageType, elem.data);
+            elem.image = Helper::resizeBackdrop(elem.image);
+        m_concert->setImage(elem.imageType, elem.image);
     }
 
-    emit sigImage(m_concert, elem.imageType, elem.data);
+    emit sigImage(m_concert, elem.imageType, elem.image);
 }
 
 void ConcertController::loadImage(int type, QUrl url)
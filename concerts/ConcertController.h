@@ -20,9 +20,11 @@ public:
     explicit ConcertController(Concert *parent = 0);
 
     bool saveData(MediaCenterInterface *mediaCenterInterface);
+    void setSaved(bool saved);
     bool loadData(MediaCenterInterface *mediaCenterInterface, bool force = false, bool reloadFromNfo = true);
     void loadData(QString id, ConcertScraperInterface *scraperInterface, QList<int> infos);
     void loadStreamDetailsFromFile();
+    void loadStreamDetailsInBackground();
     void scraperLoadDone(ConcertScraperInterface *scraper);
     QList<int> infosToLoad();
     bool infoLoaded() const;
@@ -40,14 +42,18 @@ signals:
     void sigLoadImagesStarted(Concert*);
     void sigDownloadProgress(Concert*, int, int);
     void sigLoadingImages(Concert*, QList<int>);
-    void sigImage(Concert*, int, QByteArray);
+    void sigImage(Concert*, int, StagedImage);
+    void sigStreamDetailsLoaded(Concert*);
 
 private slots:
     void onFanartLoadDone(Concert* concert, QMap<int, QList<Poster> > posters);
     void onAllDownloadsFinished();
     void onDownloadFinished(DownloadManagerElement elem);
+    void onStreamDetailsLoaded();
 
 private:
+    void setStreamDetails(const QString &content);
+
     Concert *m_concert;
     bool m_infoLoaded;
     bool m_infoFromNfoLoaded;
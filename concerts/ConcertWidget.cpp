@@ -79,11 +79,11 @@ ConcertWidget::ConcertWidget(QWidget *parent) :
     connect(ui->tagCloud, SIGNAL(activated(QString)), this, SLOT(addTag(QString)));
     connect(ui->tagCloud, SIGNAL(deactivated(QString)), this, SLOT(removeTag(QString)));
 
-    ui->poster->setDefaultPixmap(QPixmap(":/img/film_reel.png"));
-    ui->backdrop->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->logo->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->clearArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->cdArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->poster->setDefaultPixmap(Helper::scaledPixmap(":/img/film_reel.png"));
+    ui->backdrop->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->logo->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->clearArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->cdArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
 
     m_loadingMovie = new QMovie(":/img/spinner.gif");
     m_loadingMovie->start();
@@ -182,11 +182,11 @@ void ConcertWidget::clear()
     ui->playcount->clear();
     ui->lastPlayed->setDateTime(QDateTime::currentDateTime());
     ui->overview->clear();
-    ui->poster->setPixmap(QPixmap(":/img/film_reel.png"));
-    ui->backdrop->setPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->logo->setPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->clearArt->setPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->cdArt->setPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->poster->setPixmap(Helper::scaledPixmap(":/img/film_reel.png"));
+    ui->backdrop->setPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->logo->setPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->clearArt->setPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->cdArt->setPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
     ui->genreCloud->clear();
     ui->tagCloud->clear();
 
@@ -267,11 +267,8 @@ void ConcertWidget::setConcert(Concert *concert)
     qDebug() << "Entered, concert=" << concert->name();
     concert->controller()->loadData(Manager::instance()->mediaCenterInterfaceConcert());
     m_concert = concert;
-    if (!concert->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails()) {
-        concert->controller()->loadStreamDetailsFromFile();
-        if (concert->streamDetailsLoaded() && concert->streamDetails()->videoDetails().value("durationinseconds").toInt() != 0)
-            concert->setRuntime(qFloor(concert->streamDetails()->videoDetails().value("durationinseconds").toInt()/60));
-    }
+    if (!concert->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails())
+        concert->controller()->loadStreamDetailsInBackground();
     updateConcertInfo();
 
     connect(m_concert->controller(), SIGNAL(sigInfoLoadDone(Concert*)), this, SLOT(onInfoLoadDone(Concert*)), Qt::UniqueConnection);
@@ -279,7 +276,8 @@ void ConcertWidget::setConcert(Concert *concert)
     connect(m_concert->controller(), SIGNAL(sigDownloadProgress(Concert*,int, int)), this, SLOT(onDownloadProgress(Concert*,int,int)), Qt::UniqueConnection);
     connect(m_concert->controller(), SIGNAL(sigLoadingImages(Concert*,QList<int>)), this, SLOT(onLoadingImages(Concert*,QList<int>)), Qt::UniqueConnection);
     connect(m_concert->controller(), SIGNAL(sigLoadImagesStarted(Concert*)), this, SLOT(onLoadImagesStarted(Concert*)), Qt::UniqueConnection);
-    connect(m_concert->controller(), SIGNAL(sigImage(Concert*,int,QByteArray)), this, SLOT(onSetImage(Concert*,int,QByteArray)), Qt::UniqueConnection);
+    connect(m_concert->controller(), SIGNAL(sigImage(Concert*,int,StagedImage)), this, SLOT(onSetImage(Concert*,int,StagedImage)), Qt::UniqueConnection);
+    connect(m_concert->controller(), SIGNAL(sigStreamDetailsLoaded(Concert*)), this, SLOT(onStreamDetailsLoaded(Concert*)), Qt::UniqueConnection);
 
     if (concert->controller()->downloadsInProgress())
         setDisabledTrue();
@@ -357,11 +355,12 @@ void ConcertWidget::onLoadingImages(Concert *concert, QList<int> imageTypes)
     ui->groupBox_3->update();
 }
 
-void ConcertWidget::onSetImage(Concert *concert, int type, QByteArray data)
+void ConcertWidget::onSetImage(Concert *concert, int type, StagedImage image)
 {
     if (concert != m_concert)
         return;
 
+    QByteArray data = image.data();
     if (type == ImageType::ConcertExtraFanart) {
         ui->fanarts->addImage(data);
         return;
@@ -483,7 +482,7 @@ void ConcertWidget::updateImages(QList<int> images)
 
 void ConcertWidget::updateImage(const int &imageType, ClosableImage *image)
 {
-    if (!m_concert->image(imageType).isNull()) {
+    if (!m_concert->stagedImage(imageType).isNull()) {
         image->setImage(m_concert->image(imageType));
     } else if (!m_concert->imagesToRemove().contains(imageType) && m_concert->hasImage(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_concert, imageType);
@@ -607,7 +606,6 @@ void ConcertWidget::onSaveInformation()
     setDisabledTrue();
     m_savingWidget->show();
     m_concert->controller()->saveData(Manager::instance()->mediaCenterInterfaceConcert());
-    m_concert->controller()->loadData(Manager::instance()->mediaCenterInterfaceConcert(), true);
     updateConcertInfo();
     setEnabledTrue();
     m_savingWidget->hide();
@@ -621,21 +619,54 @@ void ConcertWidget::onSaveInformation()
 void ConcertWidget::onSaveAll()
 {
     qDebug() << "Entered";
+    if (m_batchSaver)
+        return;
+
     setDisabledTrue();
     m_savingWidget->show();
 
+    QList<Concert*> concertsToSave;
     foreach (Concert *concert, Manager::instance()->concertModel()->concerts()) {
-        if (concert->hasChanged()) {
-            concert->controller()->saveData(Manager::instance()->mediaCenterInterfaceConcert());
-            concert->controller()->loadData(Manager::instance()->mediaCenterInterfaceConcert(), true);
-            if (m_concert == concert)
-                updateConcertInfo();
-        }
+        if (concert->hasChanged())
+            concertsToSave.append(concert);
     }
+
+    NotificationBox::instance()->showProgressBar(tr("Saving concerts..."), Constants::ConcertWidgetSaveProgressMessageId);
+    qApp->processEvents();
+    m_batchSaver = new BatchSaver(this);
+    connect(m_batchSaver, SIGNAL(sigProgress(int,int)), this, SLOT(onSaveAllProgress(int,int)));
+    connect(m_batchSaver, SIGNAL(sigFinished()), this, SLOT(onSaveAllFinished()));
+    m_batchSaver->saveConcerts(concertsToSave);
+}
+
+/**
+ * @brief Called when all concerts were saved
+ */
+void ConcertWidget::onSaveAllFinished()
+{
+    if (m_concert)
+        updateConcertInfo();
     setEnabledTrue();
     m_savingWidget->hide();
-    NotificationBox::instance()->showMessage(tr("All Concerts Saved"));
-    ui->buttonRevert->setVisible(false);
+    NotificationBox::instance()->hideProgressBar(Constants::ConcertWidgetSaveProgressMessageId);
+    if (m_batchSaver->failedItemCount() > 0) {
+        NotificationBox::instance()->showMessage(tr("%n Concert(s) could not be saved", "", m_batchSaver->failedItemCount()));
+    } else {
+        NotificationBox::instance()->showMessage(tr("All Concerts Saved"));
+        ui->buttonRevert->setVisible(false);
+    }
+    m_batchSaver->deleteLater();
+    m_batchSaver = 0;
+}
+
+/**
+ * @brief Updates the progress bar while saving all concerts
+ * @param current Current progress
+ * @param max Maximum progress
+ */
+void ConcertWidget::onSaveAllProgress(int current, int max)
+{
+    NotificationBox::instance()->progressBarProgress(current, max, Constants::ConcertWidgetSaveProgressMessageId);
 }
 
 /**
@@ -776,6 +807,21 @@ void ConcertWidget::onReleasedChange(QDate date)
     ui->buttonRevert->setVisible(true);
 }
 
+/**
+ * @brief Shows the streamdetails and runtime once the background probe has finished
+ * @param concert Concert whose streamdetails were loaded
+ */
+void ConcertWidget::onStreamDetailsLoaded(Concert *concert)
+{
+    if (concert != m_concert)
+        return;
+    ui->runtime->blockSignals(true);
+    ui->runtime->setValue(m_concert->runtime());
+    ui->runtime->blockSignals(false);
+    updateStreamDetails();
+    ui->buttonRevert->setVisible(true);
+}
+
 /**
  * @brief Marks the concert as changed when the runtime has changed
  */
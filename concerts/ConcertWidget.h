@@ -9,6 +9,7 @@
 #include <QTableWidgetItem>
 #include <QWidget>
 
+#include "data/BatchSaver.h"
 #include "data/Concert.h"
 #include "smallWidgets/ClosableImage.h"
 
@@ -47,10 +48,13 @@ signals:
 private slots:
     void onInfoLoadDone(Concert *concert);
     void onLoadDone(Concert *concert);
+    void onSaveAllProgress(int current, int max);
+    void onSaveAllFinished();
     void onLoadImagesStarted(Concert *concert);
     void onLoadingImages(Concert *concert, QList<int> imageTypes);
     void onDownloadProgress(Concert *concert, int current, int maximum);
-    void onSetImage(Concert *concert, int type, QByteArray data);
+    void onSetImage(Concert *concert, int type, StagedImage image);
+    void onStreamDetailsLoaded(Concert *concert);
 
     void onChooseImage();
     void onDeleteImage();
@@ -91,6 +95,7 @@ private slots:
 private:
     Ui::ConcertWidget *ui;
     QPointer<Concert> m_concert;
+    QPointer<BatchSaver> m_batchSaver;
     QMovie *m_loadingMovie;
     QLabel *m_savingWidget;
     QList<QWidget*> m_streamDetailsWidgets;
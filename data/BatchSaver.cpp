@@ -0,0 +1,580 @@
+#include "BatchSaver.h"
+
+#include <QBuffer>
+#include <QDebug>
+#include <QFile>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+#include "data/SafeFileWriter.h"
+#include "data/StreamDetailsService.h"
+#include "globals/Logger.h"
+#include "globals/Manager.h"
+#include "settings/Settings.h"
+
+/**
+ * @brief BatchSaver::BatchSaver
+ * @param parent
+ */
+BatchSaver::BatchSaver(QObject *parent) :
+    QObject(parent),
+    m_itemCount(0),
+    m_itemsSaved(0),
+    m_failedItemCount(0),
+    m_pendingProbes(0),
+    m_currentItem(0)
+{
+}
+
+/**
+ * @brief Saves all changed movies, sigFinished is emitted when all files were written
+ * @param movies List of movies
+ */
+void BatchSaver::saveMovies(QList<Movie*> movies)
+{
+    begin();
+    foreach (Movie *movie, movies) {
+        if (movie->hasChanged())
+            m_movies.append(movie);
+    }
+    m_itemCount = m_movies.count();
+
+    emit sigProgress(0, m_itemCount*2);
+    if (Settings::instance()->autoLoadStreamDetails()) {
+        foreach (Movie *movie, m_movies) {
+            if (!movie->streamDetailsLoaded())
+                loadStreamDetails(movie->files());
+        }
+    }
+    if (m_pendingProbes == 0)
+        saveItems();
+}
+
+/**
+ * @brief Saves all changed concerts, sigFinished is emitted when all files were written
+ * @param concerts List of concerts
+ */
+void BatchSaver::saveConcerts(QList<Concert*> concerts)
+{
+    begin();
+    foreach (Concert *concert, concerts) {
+        if (concert->hasChanged())
+            m_concerts.append(concert);
+    }
+    m_itemCount = m_concerts.count();
+
+    emit sigProgress(0, m_itemCount*2);
+    if (Settings::instance()->autoLoadStreamDetails()) {
+        foreach (Concert *concert, m_concerts) {
+            if (!concert->streamDetailsLoaded())
+                loadStreamDetails(concert->files());
+        }
+    }
+    if (m_pendingProbes == 0)
+        saveItems();
+}
+
+/**
+ * @brief Saves all changed tv shows and their changed episodes, sigFinished is emitted when all files were written
+ * @param shows List of tv shows
+ */
+void BatchSaver::saveTvShows(QList<TvShow*> shows)
+{
+    begin();
+    foreach (TvShow *show, shows) {
+        if (show->hasChanged())
+            m_shows.append(show);
+        foreach (TvShowEpisode *episode, show->episodes()) {
+            if (episode->hasChanged())
+                m_episodes.append(episode);
+        }
+    }
+    m_itemCount = m_shows.count() + m_episodes.count();
+
+    emit sigProgress(0, m_itemCount*2);
+    if (Settings::instance()->autoLoadStreamDetails()) {
+        foreach (TvShowEpisode *episode, m_episodes) {
+            if (!episode->streamDetailsLoaded())
+                loadStreamDetails(episode->files());
+        }
+    }
+    if (m_pendingProbes == 0)
+        saveItems();
+}
+
+/**
+ * @brief Number of items of the last save which could not be written completely
+ * @return Number of items, they are still marked as changed
+ */
+int BatchSaver::failedItemCount() const
+{
+    return m_failedItemCount;
+}
+
+/**
+ * @brief Returns the nfo content which was generated for an item before it is saved
+ * @param item Movie, concert, tv show or episode
+ * @return Nfo content, empty if none was generated
+ */
+QByteArray BatchSaver::nfoContent(QObject *item) const
+{
+    return m_nfoContents.value(item);
+}
+
+/**
+ * @brief Queues a file write. A later operation on the same file replaces this one.
+ * @param fileName File to write
+ * @param data Content
+ * @param text Open the file in text mode
+ * @return Always true, failed writes keep their item marked as changed
+ */
+bool BatchSaver::queueWrite(QString fileName, QByteArray data, bool text)
+{
+    FileOperation operation;
+    operation.fileName = fileName;
+    operation.data = data;
+    operation.imageType = -1;
+    operation.remove = false;
+    operation.text = text;
+    operation.skipped = false;
+    operation.success = false;
+    queue(operation);
+    return true;
+}
+
+/**
+ * @brief Queues writing an image. A later operation on the same file replaces this one.
+ *        Staged images are copied from their file when the queue is executed.
+ * @param fileName File to write
+ * @param image Image
+ * @param imageType Image type which is marked as existing once the item was saved, -1 for none
+ * @return Always true, failed writes keep their item marked as changed
+ */
+bool BatchSaver::queueImage(QString fileName, StagedImage image, int imageType)
+{
+    FileOperation operation;
+    operation.fileName = fileName;
+    operation.image = image;
+    operation.imageType = imageType;
+    operation.remove = false;
+    operation.text = false;
+    operation.skipped = false;
+    operation.success = false;
+    queue(operation);
+    return true;
+}
+
+/**
+ * @brief Queues a file removal. A later operation on the same file replaces this one.
+ * @param fileName File to remove
+ */
+void BatchSaver::queueRemove(QString fileName)
+{
+    FileOperation operation;
+    operation.fileName = fileName;
+    operation.imageType = -1;
+    operation.remove = true;
+    operation.text = false;
+    operation.skipped = false;
+    operation.success = false;
+    queue(operation);
+}
+
+/**
+ * @brief Adds an item which is saved together with the current one (e.g. the episodes of a multi episode file).
+ *        It is marked as saved when the files of the current item were written and is not saved again.
+ * @param item Sibling of the current item
+ */
+void BatchSaver::addSibling(QObject *item)
+{
+    if (item != m_currentItem)
+        m_siblings.insert(item, m_currentItem);
+}
+
+/**
+ * @brief Adds an operation to the queue
+ * @param operation File operation
+ */
+void BatchSaver::queue(FileOperation operation)
+{
+    operation.item = m_currentItem;
+    if (m_operationIndex.contains(operation.fileName)) {
+        m_operations[m_operationIndex.value(operation.fileName)] = operation;
+        return;
+    }
+    m_operationIndex.insert(operation.fileName, m_operations.count());
+    m_operations.append(operation);
+}
+
+/**
+ * @brief Resets the state of a previous save
+ */
+void BatchSaver::begin()
+{
+    m_movies.clear();
+    m_concerts.clear();
+    m_shows.clear();
+    m_episodes.clear();
+    m_nfoContents.clear();
+    m_saved.clear();
+    m_siblings.clear();
+    m_itemCount = 0;
+    m_itemsSaved = 0;
+    m_failedItemCount = 0;
+    m_pendingProbes = 0;
+    m_currentItem = 0;
+    m_operations.clear();
+    m_operationIndex.clear();
+}
+
+/**
+ * @brief Queues a stream details probe, the items are saved when all probes have finished
+ * @param files Files of the item
+ */
+void BatchSaver::loadStreamDetails(const QStringList &files)
+{
+    QFuture<QString> future = StreamDetailsService::instance()->load(files);
+    if (future.isFinished())
+        return;
+    m_pendingProbes++;
+    QFutureWatcher<QString> *watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onStreamDetailsLoaded()));
+    watcher->setFuture(future);
+}
+
+/**
+ * @brief Saves the items once the last stream details probe has finished
+ */
+void BatchSaver::onStreamDetailsLoaded()
+{
+    sender()->deleteLater();
+    if (--m_pendingProbes == 0)
+        saveItems();
+}
+
+/**
+ * @brief Generates the nfo files on the thread pool, lets the media center interfaces queue
+ *        their file operations and starts executing them.
+ *        No events are processed until the file operations were started, so the items can't change in between.
+ */
+void BatchSaver::saveItems()
+{
+    LOG_DEBUG() << "Entered, itemCount=" << m_itemCount;
+    MediaCenterInterface *movieInterface = Manager::instance()->mediaCenterInterface();
+    MediaCenterInterface *concertInterface = Manager::instance()->mediaCenterInterfaceConcert();
+    MediaCenterInterface *tvShowInterface = Manager::instance()->mediaCenterInterfaceTvShow();
+
+    // all probes have finished, so this only assigns the results
+    bool loadStreamDetails = Settings::instance()->autoLoadStreamDetails();
+    QList<NfoJob> jobs;
+    foreach (Movie *movie, m_movies) {
+        if (loadStreamDetails && !movie->streamDetailsLoaded())
+            movie->controller()->loadStreamDetailsFromFile();
+        NfoJob job = { movie, movieInterface, QByteArray() };
+        jobs.append(job);
+    }
+    foreach (Concert *concert, m_concerts) {
+        if (loadStreamDetails && !concert->streamDetailsLoaded())
+            concert->controller()->loadStreamDetailsFromFile();
+        NfoJob job = { concert, concertInterface, QByteArray() };
+        jobs.append(job);
+    }
+    foreach (TvShow *show, m_shows) {
+        NfoJob job = { show, tvShowInterface, QByteArray() };
+        jobs.append(job);
+    }
+    foreach (TvShowEpisode *episode, m_episodes) {
+        if (loadStreamDetails && !episode->streamDetailsLoaded())
+            episode->loadStreamDetailsFromFile();
+        NfoJob job = { episode, tvShowInterface, QByteArray() };
+        jobs.append(job);
+    }
+
+    QtConcurrent::blockingMap(jobs, &BatchSaver::serialize);
+    foreach (const NfoJob &job, jobs)
+        m_nfoContents.insert(job.item, job.content);
+
+    movieInterface->setBatchSaver(this);
+    concertInterface->setBatchSaver(this);
+    tvShowInterface->setBatchSaver(this);
+
+    foreach (Movie *movie, m_movies) {
+        m_currentItem = movie;
+        m_saved.insert(movie, movieInterface->saveMovie(movie));
+        itemSaved();
+    }
+    foreach (Concert *concert, m_concerts) {
+        m_currentItem = concert;
+        m_saved.insert(concert, concertInterface->saveConcert(concert));
+        itemSaved();
+    }
+    foreach (TvShow *show, m_shows) {
+        m_currentItem = show;
+        m_saved.insert(show, tvShowInterface->saveTvShow(show));
+        itemSaved();
+    }
+    foreach (TvShowEpisode *episode, m_episodes) {
+        // Saving a multi episode also saves its sibling episodes
+        if (m_siblings.contains(episode)) {
+            itemSaved();
+            continue;
+        }
+        m_currentItem = episode;
+        m_saved.insert(episode, tvShowInterface->saveTvShowEpisode(episode));
+        itemSaved();
+    }
+
+    m_currentItem = 0;
+    movieInterface->setBatchSaver(0);
+    concertInterface->setBatchSaver(0);
+    tvShowInterface->setBatchSaver(0);
+
+    LOG_DEBUG() << "Executing" << m_operations.count() << "file operations";
+    if (m_operations.isEmpty()) {
+        finish();
+        return;
+    }
+
+    QFutureWatcher<void> *watcher = new QFutureWatcher<void>(this);
+    connect(watcher, SIGNAL(progressValueChanged(int)), this, SLOT(onFileOperationProgress(int)));
+    connect(watcher, SIGNAL(finished()), this, SLOT(onFileOperationsExecuted()));
+    watcher->setFuture(QtConcurrent::map(m_operations, &BatchSaver::execute));
+}
+
+/**
+ * @brief Reports the progress after one item was saved
+ */
+void BatchSaver::itemSaved()
+{
+    emit sigProgress(++m_itemsSaved, m_itemCount*2);
+}
+
+/**
+ * @brief Replaces the targets with their temporary files once all of them were written
+ */
+void BatchSaver::onFileOperationsExecuted()
+{
+    sender()->deleteLater();
+    QFutureWatcher<void> *watcher = new QFutureWatcher<void>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onFileOperationsCommitted()));
+    watcher->setFuture(QtConcurrent::run(&BatchSaver::commitAll, &m_operations));
+}
+
+/**
+ * @brief Finishes the save after all file operations were executed
+ */
+void BatchSaver::onFileOperationsCommitted()
+{
+    sender()->deleteLater();
+    finish();
+}
+
+/**
+ * @brief Marks the items whose files were all written as saved and updates them in the database.
+ *        Items with a failed write keep their changed state and staged images, so they are saved with the next save.
+ */
+void BatchSaver::finish()
+{
+    int skipped = 0;
+    QList<QObject*> failedItems;
+    foreach (const FileOperation &operation, m_operations) {
+        if (operation.skipped)
+            skipped++;
+        if (!operation.success && operation.remove) {
+            LOG_DEBUG() << "File could not be removed" << operation.fileName;
+        } else if (!operation.success) {
+            qWarning() << "File could not be written" << operation.fileName;
+            if (operation.item && !failedItems.contains(operation.item))
+                failedItems.append(operation.item);
+        }
+    }
+    m_failedItemCount = failedItems.count();
+    LOG_DEBUG() << skipped << "files were unchanged," << m_failedItemCount << "items could not be saved";
+
+    foreach (const FileOperation &operation, m_operations) {
+        if (operation.success && !operation.remove && operation.imageType != -1 && !failedItems.contains(operation.item))
+            setHasImage(operation.item, operation.imageType);
+    }
+
+    Database *database = Manager::instance()->database();
+    database->transaction();
+    foreach (Movie *movie, m_movies) {
+        if (failedItems.contains(movie))
+            continue;
+        bool saved = m_saved.value(movie);
+        if (saved) {
+            movie->setNfoContent(m_nfoContents.value(movie));
+            database->update(movie);
+        }
+        movie->controller()->setSaved(saved);
+    }
+    foreach (Concert *concert, m_concerts) {
+        if (failedItems.contains(concert))
+            continue;
+        bool saved = m_saved.value(concert);
+        if (saved) {
+            concert->setNfoContent(m_nfoContents.value(concert));
+            database->update(concert);
+        }
+        concert->controller()->setSaved(saved);
+    }
+    foreach (TvShow *show, m_shows) {
+        if (failedItems.contains(show))
+            continue;
+        bool saved = m_saved.value(show);
+        if (saved) {
+            show->setNfoContent(m_nfoContents.value(show));
+            database->update(show);
+        }
+        show->setSaved(saved);
+    }
+    foreach (TvShowEpisode *episode, m_episodes) {
+        if (m_siblings.contains(episode) || failedItems.contains(episode))
+            continue;
+        bool saved = m_saved.value(episode);
+        if (saved) {
+            episode->setNfoContent(m_nfoContents.value(episode));
+            database->update(episode);
+        }
+        episode->setSaved(saved);
+    }
+    QHashIterator<QObject*, QObject*> it(m_siblings);
+    while (it.hasNext()) {
+        it.next();
+        TvShowEpisode *episode = static_cast<TvShowEpisode*>(it.key());
+        if (failedItems.contains(it.value()) || !m_saved.value(it.value()))
+            continue;
+        episode->setChanged(false);
+        episode->setSyncNeeded(true);
+        episode->setNfoContent(m_nfoContents.value(it.value()));
+        database->update(episode);
+    }
+    database->commit();
+
+    m_operations.clear();
+    m_operationIndex.clear();
+    m_nfoContents.clear();
+    emit sigProgress(m_itemCount*2, m_itemCount*2);
+    emit sigFinished();
+}
+
+/**
+ * @brief Marks an image as existing after it was written
+ * @param item Movie, concert or tv show
+ * @param imageType Image type
+ */
+void BatchSaver::setHasImage(QObject *item, int imageType)
+{
+    if (Movie *movie = qobject_cast<Movie*>(item)) {
+        if (imageType == ImageType::MovieExtraFanart)
+            movie->setHasExtraFanarts(true);
+        else
+            movie->setHasImage(imageType, true);
+    } else if (Concert *concert = qobject_cast<Concert*>(item)) {
+        if (imageType == ImageType::ConcertExtraFanart)
+            concert->setHasExtraFanarts(true);
+        else
+            concert->setHasImage(imageType, true);
+    } else if (TvShow *show = qobject_cast<TvShow*>(item)) {
+        show->setHasImage(imageType, true);
+    }
+}
+
+/**
+ * @brief Reports the progress of the file operations
+ * @param value Number of executed operations
+ */
+void BatchSaver::onFileOperationProgress(int value)
+{
+    if (m_operations.isEmpty())
+        return;
+    emit sigProgress(m_itemCount + value*m_itemCount/m_operations.count(), m_itemCount*2);
+}
+
+/**
+ * @brief Generates the nfo content of an item. Called from the thread pool while the items can't change.
+ * @param job Item and its media center interface
+ */
+void BatchSaver::serialize(NfoJob &job)
+{
+    if (Movie *movie = qobject_cast<Movie*>(job.item))
+        job.content = job.mediaCenterInterface->nfoXml(movie);
+    else if (Concert *concert = qobject_cast<Concert*>(job.item))
+        job.content = job.mediaCenterInterface->nfoXml(concert);
+    else if (TvShow *show = qobject_cast<TvShow*>(job.item))
+        job.content = job.mediaCenterInterface->nfoXml(show);
+    else if (TvShowEpisode *episode = qobject_cast<TvShowEpisode*>(job.item))
+        job.content = job.mediaCenterInterface->nfoXml(episode);
+}
+
+/**
+ * @brief Executes a file operation. Called from the thread pool.
+ *        Writes only go to the temporary file, BatchSaver::commit replaces the target afterwards.
+ * @param operation File operation
+ */
+void BatchSaver::execute(FileOperation &operation)
+{
+    if (operation.remove) {
+        operation.success = QFile::remove(operation.fileName);
+        return;
+    }
+
+    // images are compared by their checksum, so an unchanged image is not read at all
+    bool isImage = !operation.image.isNull();
+    if (isImage && SafeFileWriter::isUnchanged(operation.fileName, operation.image.size(), operation.image.checksum())) {
+        operation.skipped = true;
+        operation.success = true;
+        return;
+    }
+
+    // staged images are copied from their file, everything else is written from memory
+    QByteArray content;
+    QBuffer buffer(&content);
+    QFile file(operation.image.stagedFileName());
+    QIODevice *device = &buffer;
+    if (!operation.image.stagedFileName().isEmpty()) {
+        device = &file;
+    } else {
+        content = SafeFileWriter::fileContent(isImage ? operation.image.data() : operation.data, operation.text);
+    }
+    if (!device->open(QIODevice::ReadOnly))
+        return;
+
+    if (!isImage && SafeFileWriter::isUnchanged(operation.fileName, device)) {
+        operation.skipped = true;
+        operation.success = true;
+        return;
+    }
+    bool sync = Settings::instance()->advanced()->syncWrites();
+    operation.success = SafeFileWriter::writeTemporary(operation.fileName, device, sync, &operation.temporaryFileName);
+}
+
+/**
+ * @brief Replaces the target of a written file operation with its temporary file. Called from the thread pool.
+ * @param operation File operation
+ */
+void BatchSaver::commit(FileOperation &operation)
+{
+    if (operation.remove || operation.skipped || !operation.success)
+        return;
+    operation.success = SafeFileWriter::commit(operation.fileName, operation.temporaryFileName);
+}
+
+/**
+ * @brief Replaces the targets and syncs the directories of the replaced files. Called from the thread pool.
+ * @param operations Executed file operations
+ */
+void BatchSaver::commitAll(QList<FileOperation> *operations)
+{
+    QtConcurrent::blockingMap(*operations, &BatchSaver::commit);
+    if (!Settings::instance()->advanced()->syncWrites())
+        return;
+
+    // the temporary files were synced when they were written, every directory is synced once
+    QStringList replacedFiles;
+    foreach (const FileOperation &operation, *operations) {
+        if (operation.success && !operation.temporaryFileName.isEmpty())
+            replacedFiles.append(operation.fileName);
+    }
+    SafeFileWriter::syncDirectories(replacedFiles);
+}
@@ -0,0 +1,102 @@
+#ifndef BATCHSAVER_H
+#define BATCHSAVER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include "data/StagedImage.h"
+
+class Concert;
+class MediaCenterInterface;
+class Movie;
+class TvShow;
+class TvShowEpisode;
+
+/**
+ * @brief The BatchSaver class
+ *        Saves multiple movies, concerts or tv shows at once.
+ *        The nfo files of all items are generated on the global thread pool, afterwards the media center
+ *        interfaces only queue their file operations here. The queued writes and removals are executed
+ *        in parallel on the thread pool while the event loop keeps running, sigFinished is emitted afterwards.
+ *        Files which already have their new content are not touched, the others are written
+ *        to temporary files which replace the targets once all of them were written.
+ *        Only items whose files were all written are marked as saved: their staged images are cleared,
+ *        image flags are set and the database is updated. The others stay changed and keep their staged data.
+ */
+class BatchSaver : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BatchSaver(QObject *parent = 0);
+    void saveMovies(QList<Movie*> movies);
+    void saveConcerts(QList<Concert*> concerts);
+    void saveTvShows(QList<TvShow*> shows);
+    int failedItemCount() const;
+
+    QByteArray nfoContent(QObject *item) const;
+    bool queueWrite(QString fileName, QByteArray data, bool text);
+    bool queueImage(QString fileName, StagedImage image, int imageType = -1);
+    void queueRemove(QString fileName);
+    void addSibling(QObject *item);
+
+signals:
+    void sigProgress(int current, int max);
+    void sigFinished();
+
+private slots:
+    void onStreamDetailsLoaded();
+    void onFileOperationProgress(int value);
+    void onFileOperationsExecuted();
+    void onFileOperationsCommitted();
+
+private:
+    struct FileOperation {
+        QString fileName;
+        QByteArray data;
+        StagedImage image;
+        QString temporaryFileName;
+        int imageType;
+        bool remove;
+        bool text;
+        bool skipped;
+        bool success;
+        QObject *item;
+    };
+
+    struct NfoJob {
+        QObject *item;
+        MediaCenterInterface *mediaCenterInterface;
+        QByteArray content;
+    };
+
+    void begin();
+    void loadStreamDetails(const QStringList &files);
+    void saveItems();
+    void itemSaved();
+    void finish();
+    void queue(FileOperation operation);
+    void setHasImage(QObject *item, int imageType);
+    static void serialize(NfoJob &job);
+    static void execute(FileOperation &operation);
+    static void commit(FileOperation &operation);
+    static void commitAll(QList<FileOperation> *operations);
+
+    QList<Movie*> m_movies;
+    QList<Concert*> m_concerts;
+    QList<TvShow*> m_shows;
+    QList<TvShowEpisode*> m_episodes;
+    QHash<QObject*, QByteArray> m_nfoContents;
+    QHash<QObject*, bool> m_saved;
+    QHash<QObject*, QObject*> m_siblings;
+    int m_itemCount;
+    int m_itemsSaved;
+    int m_failedItemCount;
+    int m_pendingProbes;
+    QObject *m_currentItem;
+    QList<FileOperation> m_operations;
+    QHash<QString, int> m_operationIndex;
+};
+
+#endif // BATCHSAVER_H
@@ -16,8 +16,8 @@
 Concert::Concert(QStringList files, QObject *parent) :
     QObject(parent)
 {
-    moveToThread(QApplication::instance()->thread());
     m_controller = new ConcertController(this);
+    moveToThread(QApplication::instance()->thread());
     m_rating = 0;
     m_runtime = 0;
     m_playcount = 0;
@@ -86,7 +86,7 @@ void Concert::clear(QList<int> infos)
 {
     if (infos.contains(ConcertScraperInfos::Backdrop)) {
         m_backdrops.clear();
-        m_images.insert(ImageType::ConcertBackdrop, QByteArray());
+        m_images.insert(ImageType::ConcertBackdrop, StagedImage());
         m_hasImageChanged.insert(ImageType::ConcertBackdrop, false);
         m_imagesToRemove.removeOne(ImageType::ConcertBackdrop);
     }
@@ -94,7 +94,7 @@ void Concert::clear(QList<int> infos)
         m_genres.clear();
     if (infos.contains(ConcertScraperInfos::Poster)) {
         m_posters.clear();
-        m_images.insert(ImageType::ConcertPoster, QByteArray());
+        m_images.insert(ImageType::ConcertPoster, StagedImage());
         m_hasImageChanged.insert(ImageType::ConcertPoster, false);
         m_imagesToRemove.removeOne(ImageType::ConcertPoster);
     }
@@ -115,11 +115,11 @@ void Concert::clear(QList<int> infos)
     if (infos.contains(ConcertScraperInfos::Tags))
         m_tags.clear();
     if (infos.contains(ConcertScraperInfos::ExtraArts)) {
-        m_images.insert(ImageType::ConcertCdArt, QByteArray());
+        m_images.insert(ImageType::ConcertCdArt, StagedImage());
         m_hasImageChanged.insert(ImageType::ConcertCdArt, false);
-        m_images.insert(ImageType::ConcertLogo, QByteArray());
+        m_images.insert(ImageType::ConcertLogo, StagedImage());
         m_hasImageChanged.insert(ImageType::ConcertLogo, false);
-        m_images.insert(ImageType::ConcertClearArt, QByteArray());
+        m_images.insert(ImageType::ConcertClearArt, StagedImage());
         m_hasImageChanged.insert(ImageType::ConcertClearArt, false);
         m_imagesToRemove.removeOne(ImageType::ConcertCdArt);
         m_imagesToRemove.removeOne(ImageType::ConcertClearArt);
@@ -847,6 +847,11 @@ void Concert::removeTag(QString tag)
 }
 
 void Concert::addExtraFanart(QByteArray fanart)
+{
+    addExtraFanart(StagedImage(fanart));
+}
+
+void Concert::addExtraFanart(StagedImage fanart)
 {
     m_extraFanartImagesToAdd.append(fanart);
     setChanged(true);
@@ -854,7 +859,13 @@ void Concert::addExtraFanart(QByteArray fanart)
 
 void Concert::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i=0, n=m_extraFanartImagesToAdd.count() ; i<n ; ++i) {
+        const StagedImage &image = m_extraFanartImagesToAdd.at(i);
+        if (image.size() == fanart.size() && image.data() == fanart) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setChanged(true);
 }
 
@@ -877,9 +888,9 @@ QList<ExtraFanart> Concert::extraFanarts(MediaCenterInterface *mediaCenterInterf
         f.path = file;
         fanarts.append(f);
     }
-    foreach (const QByteArray &img, m_extraFanartImagesToAdd) {
+    foreach (const StagedImage &img, m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -890,7 +901,7 @@ QStringList Concert::extraFanartsToRemove()
     return m_extraFanartsToRemove;
 }
 
-QList<QByteArray> Concert::extraFanartImagesToAdd()
+QList<StagedImage> Concert::extraFanartImagesToAdd()
 {
     return m_extraFanartImagesToAdd;
 }
@@ -920,8 +931,8 @@ QList<int> Concert::imagesToRemove() const
 
 void Concert::removeImage(int type)
 {
-    if (!m_images.value(type, QByteArray()).isNull()) {
-        m_images.insert(type, QByteArray());
+    if (!m_images.value(type).isNull()) {
+        m_images.insert(type, StagedImage());
         m_hasImageChanged.insert(type, false);
     } else if (!m_imagesToRemove.contains(type)) {
         m_imagesToRemove.append(type);
@@ -943,7 +954,17 @@ QList<int> Concert::imageTypes()
 
 QByteArray Concert::image(int imageType)
 {
-    return m_images.value(imageType, QByteArray());
+    return m_images.value(imageType).data();
+}
+
+/**
+ * @brief Returns the image without reading a staged image into memory
+ * @param imageType Type of the image
+ * @return Image handle, null if there is no new image
+ */
+StagedImage Concert::stagedImage(int imageType)
+{
+    return m_images.value(imageType);
 }
 
 bool Concert::imageHasChanged(int imageType)
@@ -952,6 +973,11 @@ bool Concert::imageHasChanged(int imageType)
 }
 
 void Concert::setImage(int imageType, QByteArray image)
+{
+    setImage(imageType, StagedImage(image));
+}
+
+void Concert::setImage(int imageType, StagedImage image)
 {
     m_images.insert(imageType, image);
     m_hasImageChanged.insert(imageType, true);
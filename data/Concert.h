@@ -12,6 +12,7 @@
 #include "concerts/ConcertController.h"
 #include "data/ConcertScraperInterface.h"
 #include "data/MediaCenterInterface.h"
+#include "data/StagedImage.h"
 #include "data/StreamDetails.h"
 #include "globals/Globals.h"
 
@@ -130,8 +131,9 @@ public:
     // Extra Fanarts
     QList<ExtraFanart> extraFanarts(MediaCenterInterface *mediaCenterInterface);
     QStringList extraFanartsToRemove();
-    QList<QByteArray> extraFanartImagesToAdd();
+    QList<StagedImage> extraFanartImagesToAdd();
     void addExtraFanart(QByteArray fanart);
+    void addExtraFanart(StagedImage fanart);
     void removeExtraFanart(QByteArray fanart);
     void removeExtraFanart(QString file);
     void clearExtraFanartData();
@@ -141,8 +143,10 @@ public:
     QList<int> imagesToRemove() const;
 
     QByteArray image(int imageType);
+    StagedImage stagedImage(int imageType);
     bool imageHasChanged(int imageType);
     void setImage(int imageType, QByteArray image);
+    void setImage(int imageType, StagedImage image);
     void setHasImage(int imageType, bool has);
     bool hasImage(int imageType);
     bool hasExtraFanarts() const;
@@ -204,9 +208,9 @@ private:
     QStringList m_extraFanarts;
     bool m_hasExtraFanarts;
 
-    QMap<int, QByteArray> m_images;
+    QMap<int, StagedImage> m_images;
     QMap<int, bool> m_hasImageChanged;
-    QList<QByteArray> m_extraFanartImagesToAdd;
+    QList<StagedImage> m_extraFanartImagesToAdd;
     QList<int> m_imagesToRemove;
     QMap<int, bool> m_hasImage;
 };
@@ -2,10 +2,12 @@
 
 #include <QApplication>
 #include <QDebug>
+#include <QSet>
 #include <QSqlQuery>
 #include <QSqlRecord>
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "globals/Tracer.h"
 
 /**
  * @brief ConcertFileSearcher::ConcertFileSearcher
@@ -39,29 +41,37 @@ void ConcertFileSearcher::setConcertDirectories(QList<SettingsDir> directories)
  */
 void ConcertFileSearcher::reload(bool force)
 {
+    ScopedTrace trace("ConcertFileSearcher::reload");
     m_aborted = false;
 
-    if (force)
+    if (force) {
+        clearCachedConcerts();
         Manager::instance()->database()->clearConcerts();
+    }
 
     Manager::instance()->concertModel()->clear();
     emit searchStarted(tr("Searching for Concerts..."), m_progressMessageId);
 
     QList<Concert*> concerts;
     QList<Concert*> dbConcerts;
+    QSet<Concert*> cachedConcerts;
     QList<QStringList> contents;
     foreach (SettingsDir dir, m_directories) {
         if (m_aborted)
             return;
 
-        QList<Concert*> concertsFromDb = Manager::instance()->database()->concerts(dir.path);
+        bool preloaded = !dir.autoReload && !force && m_cachedConcerts.contains(dir.path);
+        QList<Concert*> concertsFromDb = preloaded ? m_cachedConcerts.take(dir.path) : Manager::instance()->database()->concerts(dir.path);
         if (dir.autoReload || force || concertsFromDb.count() == 0) {
             Manager::instance()->database()->clearConcerts(dir.path);
             scanDir(dir.path, dir.path, contents, dir.separateFolders, true);
         } else {
             dbConcerts.append(concertsFromDb);
+            if (preloaded)
+                cachedConcerts.unite(concertsFromDb.toSet());
         }
     }
+    clearCachedConcerts();
     emit currentDir("");
 
     emit searchStarted(tr("Loading Concerts..."), m_progressMessageId);
@@ -107,7 +117,8 @@ void ConcertFileSearcher::reload(bool force)
         if (m_aborted)
             return;
 
-        concert->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
+        if (!cachedConcerts.contains(concert))
+            concert->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
         emit currentDir(concert->name());
         concerts.append(concert);
         emit progress(++concertCounter, concertSum, m_progressMessageId);
@@ -231,4 +242,35 @@ QStringList ConcertFileSearcher::getFiles(QString path)
 void ConcertFileSearcher::abort()
 {
     m_aborted = true;
+    clearCachedConcerts();
+}
+
+/**
+ * @brief Sets concerts which were already loaded from the database and parsed in another thread.
+ *        They are used instead of querying the database by the next reload.
+ * @param concerts Concerts by path of their directory, they have to live in the thread of the searcher
+ */
+void ConcertFileSearcher::setCachedConcerts(QMap<QString, QList<Concert*> > concerts)
+{
+    clearCachedConcerts();
+    QMapIterator<QString, QList<Concert*> > it(concerts);
+    while (it.hasNext()) {
+        it.next();
+        foreach (Concert *concert, it.value())
+            concert->setParent(this);
+    }
+    m_cachedConcerts = concerts;
+}
+
+/**
+ * @brief Deletes all preloaded concerts which were not used
+ */
+void ConcertFileSearcher::clearCachedConcerts()
+{
+    QMapIterator<QString, QList<Concert*> > it(m_cachedConcerts);
+    while (it.hasNext()) {
+        it.next();
+        qDeleteAll(it.value());
+    }
+    m_cachedConcerts.clear();
 }
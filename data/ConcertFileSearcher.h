@@ -16,6 +16,7 @@ class ConcertFileSearcher : public QObject
 public:
     explicit ConcertFileSearcher(QObject *parent = 0);
     void setConcertDirectories(QList<SettingsDir> directories);
+    void setCachedConcerts(QMap<QString, QList<Concert*> > concerts);
 
 public slots:
     void reload(bool force);
@@ -33,6 +34,8 @@ private:
     void scanDir(QString startPath, QString path, QList<QStringList> &contents, bool separateFolders = false, bool firstScan = false);
     QStringList getFiles(QString path);
     bool m_aborted;
+    QMap<QString, QList<Concert*> > m_cachedConcerts;
+    void clearCachedConcerts();
 };
 
 #endif // CONCERTFILESEARCHER_H
@@ -6,11 +6,31 @@
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlRecord>
+#include <QThread>
+#include <QThreadStorage>
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "globals/Tracer.h"
 #include "mediaCenterPlugins/XbmcXml.h"
 #include "settings/Settings.h"
 
+/**
+ * @brief Database connection of a worker thread, removed when the thread finishes
+ */
+class ThreadConnection
+{
+public:
+    explicit ThreadConnection(QString name) : name(name) {}
+    ~ThreadConnection()
+    {
+        QSqlDatabase::database(name, false).close();
+        QSqlDatabase::removeDatabase(name);
+    }
+    QString name;
+};
+
+static QThreadStorage<ThreadConnection*> threadConnections;
+
 /**
  * @brief Database::Database
  * @param parent
@@ -18,6 +38,7 @@
 Database::Database(QObject *parent) :
     QObject(parent)
 {
+    ScopedTrace trace("Database::Database");
     QString dataLocation = Settings::instance()->databaseDir();
     QDir dir(dataLocation);
     if (!dir.exists())
@@ -66,6 +87,8 @@ Database::Database(QObject *parent) :
             query.exec();
             query.prepare("DROP TABLE IF EXISTS labels;");
             query.exec();
+            query.prepare("DROP TABLE IF EXISTS streamDetailsCache;");
+            query.exec();
 
             query.prepare("CREATE TABLE IF NOT EXISTS settings( "
                           "\"idSettings\" integer NOT NULL PRIMARY KEY AUTOINCREMENT, "
@@ -179,6 +202,16 @@ Database::Database(QObject *parent) :
                       "\"path\" text NOT NULL);");
         query.exec();
 
+        query.prepare("CREATE TABLE IF NOT EXISTS streamDetailsCache ( "
+                      "\"idStreamDetails\" integer NOT NULL PRIMARY KEY AUTOINCREMENT, "
+                      "\"files\" text NOT NULL, "
+                      "\"size\" integer NOT NULL, "
+                      "\"lastModified\" integer NOT NULL, "
+                      "\"content\" text NOT NULL);");
+        query.exec();
+        query.prepare("CREATE INDEX id_streamdetails_files_idx ON streamDetailsCache(files);");
+        query.exec();
+
         query.prepare("PRAGMA synchronous=0;");
         query.exec();
 
@@ -201,11 +234,36 @@ Database::~Database()
 
 /**
  * @brief Returns an object to the cache database
+ *        Other threads than the one of the database object get their own connection,
+ *        QSqlDatabase connections can only be used in the thread which created them.
  * @return Cache database object
  */
 QSqlDatabase Database::db()
 {
-    return *m_db;
+    if (QThread::currentThread() == thread())
+        return *m_db;
+
+    if (!threadConnections.hasLocalData()) {
+        QString name = QString("mediaDb_%1").arg(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", name);
+        db.setDatabaseName(m_db->databaseName());
+        if (!db.open())
+            qWarning() << "Could not open cache database in thread" << name;
+        threadConnections.setLocalData(new ThreadConnection(name));
+    }
+    return QSqlDatabase::database(threadConnections.localData()->name, false);
+}
+
+/**
+ * @brief Returns the parent for objects created from the database
+ *        Objects created in another thread can't have a parent in this thread,
+ *        the caller has to move them to the thread of the parent.
+ * @param parent Parent in the thread of the database object
+ * @return Parent or 0
+ */
+QObject *Database::parentInThread(QObject *parent)
+{
+    return (QThread::currentThread() == thread()) ? parent : 0;
 }
 
 void Database::transaction()
@@ -218,6 +276,28 @@ void Database::commit()
     db().commit();
 }
 
+/**
+ * @brief Starts a savepoint. Unlike transaction() this nests into a transaction which is already open,
+ *        otherwise it starts a new one.
+ * @param name Name of the savepoint
+ */
+void Database::savepoint(QString name)
+{
+    QSqlQuery query(db());
+    query.exec(QString("SAVEPOINT %1").arg(name));
+}
+
+/**
+ * @brief Releases a savepoint started with savepoint()
+ *        Changes are only committed if the savepoint started the transaction.
+ * @param name Name of the savepoint
+ */
+void Database::releaseSavepoint(QString name)
+{
+    QSqlQuery query(db());
+    query.exec(QString("RELEASE SAVEPOINT %1").arg(name));
+}
+
 void Database::clearMovies(QString path)
 {
     QSqlQuery query(db());
@@ -276,14 +356,24 @@ void Database::add(Movie *movie, QString path)
 void Database::update(Movie *movie)
 {
     QSqlQuery query(db());
-    query.prepare("UPDATE movies SET content=:content WHERE idMovie=:id");
-    query.bindValue(":content", movie->nfoContent().isEmpty() ? "" : movie->nfoContent());
-    query.bindValue(":idMovie", movie->databaseId());
+    query.prepare("UPDATE movies SET content=:content, hasPoster=:hasPoster, hasBackdrop=:hasBackdrop, hasLogo=:hasLogo, hasClearArt=:hasClearArt, "
+                  "hasCdArt=:hasCdArt, hasBanner=:hasBanner, hasThumb=:hasThumb, hasExtraFanarts=:hasExtraFanarts WHERE idMovie=:id");
+    query.bindValue(":content", movie->nfoContent().isEmpty() ? "" : movie->nfoContent().toUtf8());
+    query.bindValue(":hasPoster", movie->hasImage(ImageType::MoviePoster) ? 1 : 0);
+    query.bindValue(":hasBackdrop", movie->hasImage(ImageType::MovieBackdrop) ? 1 : 0);
+    query.bindValue(":hasLogo", movie->hasImage(ImageType::MovieLogo) ? 1 : 0);
+    query.bindValue(":hasClearArt", movie->hasImage(ImageType::MovieClearArt) ? 1 : 0);
+    query.bindValue(":hasCdArt", movie->hasImage(ImageType::MovieCdArt) ? 1 : 0);
+    query.bindValue(":hasBanner", movie->hasImage(ImageType::MovieBanner) ? 1 : 0);
+    query.bindValue(":hasThumb", movie->hasImage(ImageType::MovieThumb) ? 1 : 0);
+    query.bindValue(":hasExtraFanarts", movie->hasExtraFanarts() ? 1 : 0);
+    query.bindValue(":id", movie->databaseId());
     query.exec();
 }
 
 QList<Movie*> Database::movies(QString path)
 {
+    ScopedTrace trace("Database::movies");
     QSqlQuery query(db());
     query.prepare("SELECT M.idMovie, M.content, M.lastModified, M.inSeparateFolder, M.hasPoster, M.hasBackdrop, M.hasLogo, M.hasClearArt, "
                   "M.hasCdArt, M.hasBanner, M.hasThumb, M.hasExtraFanarts, M.discType, MF.file, L.color "
@@ -298,7 +388,7 @@ QList<Movie*> Database::movies(QString path)
     while (query.next()) {
         if (!movies.contains(query.value(query.record().indexOf("idMovie")).toInt())) {
             int label = query.value(query.record().indexOf("color")).toInt();
-            Movie *movie = new Movie(QStringList(), Manager::instance()->movieFileSearcher());
+            Movie *movie = new Movie(QStringList(), parentInThread(Manager::instance()->movieFileSearcher()));
             movie->setDatabaseId(query.value(query.record().indexOf("idMovie")).toInt());
             movie->setFileLastModified(query.value(query.record().indexOf("lastModified")).toDateTime());
             movie->setInSeparateFolder(query.value(query.record().indexOf("inSeparateFolder")).toInt() == 1);
@@ -377,6 +467,7 @@ void Database::update(Concert *concert)
 
 QList<Concert*> Database::concerts(QString path)
 {
+    ScopedTrace trace("Database::concerts");
     QList<Concert*> concerts;
     QSqlQuery query(db());
     QSqlQuery queryFiles(db());
@@ -391,7 +482,7 @@ QList<Concert*> Database::concerts(QString path)
         while (queryFiles.next())
             files << QString::fromUtf8(queryFiles.value(queryFiles.record().indexOf("file")).toByteArray());
 
-        Concert *concert = new Concert(files, Manager::instance()->concertFileSearcher());
+        Concert *concert = new Concert(files, parentInThread(Manager::instance()->concertFileSearcher()));
         concert->setDatabaseId(query.value(query.record().indexOf("idConcert")).toInt());
         concert->setInSeparateFolder(query.value(query.record().indexOf("inSeparateFolder")).toInt() == 1);
         concert->setNfoContent(QString::fromUtf8(query.value(query.record().indexOf("content")).toByteArray()));
@@ -526,13 +617,14 @@ void Database::update(TvShowEpisode *episode)
 
 QList<TvShow*> Database::shows(QString path)
 {
+    ScopedTrace trace("Database::shows");
     QList<TvShow*> shows;
     QSqlQuery query(db());
     query.prepare("SELECT idShow, dir, content, path FROM shows WHERE path=:path");
     query.bindValue(":path", path.toUtf8());
     query.exec();
     while (query.next()) {
-        TvShow *show = new TvShow(QString::fromUtf8(query.value(query.record().indexOf("dir")).toByteArray()), Manager::instance()->tvShowFileSearcher());
+        TvShow *show = new TvShow(QString::fromUtf8(query.value(query.record().indexOf("dir")).toByteArray()), parentInThread(Manager::instance()->tvShowFileSearcher()));
         show->setDatabaseId(query.value(query.record().indexOf("idShow")).toInt());
         show->setNfoContent(QString::fromUtf8(query.value(query.record().indexOf("content")).toByteArray()));
         shows.append(show);
@@ -553,6 +645,7 @@ QList<TvShow*> Database::shows(QString path)
 
 QList<TvShowEpisode*> Database::episodes(int idShow)
 {
+    ScopedTrace trace("Database::episodes");
     QList<TvShowEpisode*> episodes;
     QSqlQuery query(db());
     QSqlQuery queryFiles(db());
@@ -801,3 +894,47 @@ int Database::getLabel(QStringList fileNames)
 
     return Labels::NO_LABEL;
 }
+
+/**
+ * @brief Looks up stream details from a previous MediaInfo run
+ * @param files Files, joined by a newline
+ * @param size Combined size of the files
+ * @param lastModified Last modification time of the files
+ * @param content Cached <streamdetails> xml
+ * @return True if the files were probed before and have not changed since
+ */
+bool Database::cachedStreamDetails(QString files, qint64 size, QDateTime lastModified, QString &content)
+{
+    QSqlQuery query(db());
+    query.prepare("SELECT content FROM streamDetailsCache WHERE files=:files AND size=:size AND lastModified=:lastModified");
+    query.bindValue(":files", files.toUtf8());
+    query.bindValue(":size", size);
+    query.bindValue(":lastModified", lastModified.toTime_t());
+    query.exec();
+    if (!query.next())
+        return false;
+    content = QString::fromUtf8(query.value(query.record().indexOf("content")).toByteArray());
+    return true;
+}
+
+/**
+ * @brief Stores the result of a MediaInfo run
+ * @param files Files, joined by a newline
+ * @param size Combined size of the files
+ * @param lastModified Last modification time of the files
+ * @param content <streamdetails> xml
+ */
+void Database::setCachedStreamDetails(QString files, qint64 size, QDateTime lastModified, QString content)
+{
+    QSqlQuery query(db());
+    query.prepare("DELETE FROM streamDetailsCache WHERE files=:files");
+    query.bindValue(":files", files.toUtf8());
+    query.exec();
+
+    query.prepare("INSERT INTO streamDetailsCache(files, size, lastModified, content) VALUES(:files, :size, :lastModified, :content)");
+    query.bindValue(":files", files.toUtf8());
+    query.bindValue(":size", size);
+    query.bindValue(":lastModified", lastModified.toTime_t());
+    query.bindValue(":content", content.toUtf8());
+    query.exec();
+}
@@ -17,6 +17,8 @@ public:
     QSqlDatabase db();
     void transaction();
     void commit();
+    void savepoint(QString name);
+    void releaseSavepoint(QString name);
     void clearMovies(QString path = "");
     void add(Movie *movie, QString path);
     void update(Movie *movie);
@@ -51,8 +53,12 @@ public:
     void setLabel(QStringList fileNames, int color);
     int getLabel(QStringList fileNames);
 
+    bool cachedStreamDetails(QString files, qint64 size, QDateTime lastModified, QString &content);
+    void setCachedStreamDetails(QString files, qint64 size, QDateTime lastModified, QString content);
+
 private:
     QSqlDatabase *m_db;
+    QObject *parentInThread(QObject *parent);
 };
 
 #endif // DATABASE_H
@@ -1,15 +1,19 @@
 #include "ImageCache.h"
 
+#include <QBuffer>
 #include <QCryptographicHash>
 #include <QDateTime>
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QImageReader>
+#include <QMutexLocker>
 #include "globals/Globals.h"
 #include "settings/Settings.h"
 
 ImageCache::ImageCache(QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    m_imageSizes(10000)
 {
     QString location = Settings::instance()->imageCacheDir();
     QDir dir(location);
@@ -61,6 +65,7 @@ QImage ImageCache::image(QString path, int width, int height, int &origWidth, in
         QImage origImg(path);
         origWidth = origImg.width();
         origHeight = origImg.height();
+        cacheImageSize(path, getLastModified(path), origImg.size());
         QImage img = scaledImage(origImg, width, height);
         img.save(m_cacheDir + "/" + QString("%1_%2_%3_%4_%5_%6_.png").arg(md5).arg(width).arg(height).arg(origWidth).arg(origHeight).arg(getLastModified(path)), "png", -1);
         return img;
@@ -83,6 +88,18 @@ QImage ImageCache::scaledImage(QImage img, int width, int height)
 
 void ImageCache::invalidateImages(QString path)
 {
+    // the modification time of the old file may still be remembered
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_lastModifiedTimes.contains(path))
+            m_imageSizes.remove(imageSizeKey(path, m_lastModifiedTimes.take(path).last()));
+    }
+    int lastModified = getLastModified(path);
+    {
+        QMutexLocker locker(&m_mutex);
+        m_imageSizes.remove(imageSizeKey(path, lastModified));
+    }
+
     if (m_cacheDir.isEmpty())
         return;
 
@@ -94,28 +111,90 @@ void ImageCache::invalidateImages(QString path)
     }
 }
 
+/**
+ * @brief Returns the size of an image without decoding it.
+ *        Sizes of recently used images are kept in memory by path and modification time,
+ *        otherwise they are taken from the names of cached images or read from the image header.
+ *        May be called from worker threads.
+ * @param path Image file
+ * @return Size of the image, invalid if it can't be read
+ */
 QSize ImageCache::imageSize(QString path)
 {
-    if (m_cacheDir.isEmpty())
-        return QImage(path).size();
+    int lastModified = getLastModified(path);
+    {
+        QMutexLocker locker(&m_mutex);
+        if (QSize *cachedSize = m_imageSizes.object(imageSizeKey(path, lastModified)))
+            return *cachedSize;
+    }
 
-    QString md5 = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Md5).toHex();
-    QString baseName = QString("%1_").arg(md5);
-    QDir dir(m_cacheDir);
-    QStringList files = dir.entryList(QStringList() << baseName + "*");
-    if (files.isEmpty() || files.first().split("_").count() < 7)
-        return QImage(path).size();
+    QSize size;
+    if (!m_cacheDir.isEmpty()) {
+        QString md5 = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Md5).toHex();
+        QStringList files = QDir(m_cacheDir).entryList(QStringList() << md5 + "_*");
+        if (!files.isEmpty() && files.first().split("_").count() >= 7) {
+            QStringList parts = files.first().split("_");
+            if (m_forceCache || lastModified == parts.at(5).toInt())
+                size = QSize(parts.at(3).toInt(), parts.at(4).toInt());
+        }
+    }
+
+    if (!size.isValid()) {
+        QFile file(path);
+        size = probeSize(&file);
+    }
+    cacheImageSize(path, lastModified, size);
+    return size;
+}
 
-    QStringList parts = files.first().split("_");
-    if (!m_forceCache && getLastModified(path) != parts.at(5).toInt())
-        return QImage(path).size();
+/**
+ * @brief Remembers the size of an image, the least recently used sizes are dropped
+ * @param path Image file
+ * @param lastModified Modification time of the file
+ * @param size Size of the image
+ */
+void ImageCache::cacheImageSize(const QString &path, int lastModified, QSize size)
+{
+    QMutexLocker locker(&m_mutex);
+    m_imageSizes.insert(imageSizeKey(path, lastModified), new QSize(size));
+}
 
-    return QSize(parts.at(3).toInt(), parts.at(4).toInt());
+QString ImageCache::imageSizeKey(const QString &path, int lastModified)
+{
+    return QString("%1_%2").arg(path).arg(lastModified);
+}
+
+/**
+ * @brief Reads the size of an image from its header.
+ *        The image is only decoded if its format doesn't store the size in the header.
+ * @param device Device with the image data
+ * @return Size of the image, invalid if it can't be read
+ */
+QSize ImageCache::probeSize(QIODevice *device)
+{
+    QImageReader reader(device);
+    QSize size = reader.size();
+    if (!size.isValid())
+        size = reader.read().size();
+    return size;
+}
+
+/**
+ * @brief Reads the size of an image from its header
+ * @param data Image data
+ * @return Size of the image, invalid if it can't be read
+ */
+QSize ImageCache::probeSize(const QByteArray &data)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    return probeSize(&buffer);
 }
 
 int ImageCache::getLastModified(const QString &fileName)
 {
     int now = QDateTime::currentDateTime().toTime_t();
+    QMutexLocker locker(&m_mutex);
     if (!m_lastModifiedTimes.contains(fileName) || m_lastModifiedTimes.value(fileName).first() < now-10) {
         int lastMod = QFileInfo(fileName).lastModified().toTime_t();
         m_lastModifiedTimes.insert(fileName, QList<int>() << now << lastMod);
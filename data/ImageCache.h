@@ -1,9 +1,13 @@
 #ifndef IMAGECACHE_H
 #define IMAGECACHE_H
 
+#include <QCache>
 #include <QHash>
 #include <QImage>
+#include <QIODevice>
+#include <QMutex>
 #include <QObject>
+#include <QSize>
 
 class ImageCache : public QObject
 {
@@ -13,14 +17,20 @@ public:
     static ImageCache *instance(QObject *parent = 0);
     QImage image(QString path, int width, int height, int &origWidth, int &origHeight);
     QSize imageSize(QString path);
+    static QSize probeSize(QIODevice *device);
+    static QSize probeSize(const QByteArray &data);
     void invalidateImages(QString path);
     void clearCache();
 
 private:
     QString m_cacheDir;
     QHash<QString, QList<int> > m_lastModifiedTimes;
+    QCache<QString, QSize> m_imageSizes;
+    QMutex m_mutex;
     QImage scaledImage(QImage img, int width, int height);
     int getLastModified(const QString &fileName);
+    void cacheImageSize(const QString &path, int lastModified, QSize size);
+    static QString imageSizeKey(const QString &path, int lastModified);
     bool m_forceCache;
 };
 
@@ -0,0 +1,284 @@
+#include "LibraryCacheLoader.h"
+
+#include <QDebug>
+#include <QFileInfo>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+#include "data/ConcertFileSearcher.h"
+#include "data/MovieFileSearcher.h"
+#include "data/TvShowFileSearcher.h"
+#include "globals/Manager.h"
+#include "globals/Tracer.h"
+
+/**
+ * @brief LibraryCacheLoader::LibraryCacheLoader
+ * @param parent
+ */
+LibraryCacheLoader::LibraryCacheLoader(QObject *parent) :
+    QObject(parent),
+    m_current(0),
+    m_max(0),
+    m_aborted(0),
+    m_running(0),
+    m_loadQueued(false)
+{
+    m_progressTimer.setInterval(100);
+    connect(&m_progressTimer, SIGNAL(timeout()), this, SLOT(onProgressTimeout()));
+    connect(&m_movieWatcher, SIGNAL(finished()), this, SLOT(onMoviesLoaded()));
+    connect(&m_tvShowWatcher, SIGNAL(finished()), this, SLOT(onTvShowsLoaded()));
+    connect(&m_concertWatcher, SIGNAL(finished()), this, SLOT(onConcertsLoaded()));
+}
+
+/**
+ * @brief Starts loading the three libraries, finished is emitted when all of them were handed over
+ *        Every call ends with either finished or aborted. If a load is still running it is aborted
+ *        and the new one starts as soon as its worker threads have returned.
+ * @param movieDirectories Movie directories
+ * @param tvShowDirectories Tv show directories
+ * @param concertDirectories Concert directories
+ */
+void LibraryCacheLoader::load(QList<SettingsDir> movieDirectories, QList<SettingsDir> tvShowDirectories, QList<SettingsDir> concertDirectories)
+{
+    LoadRequest request;
+    request.movieDirectories = movieDirectories;
+    request.tvShowDirectories = tvShowDirectories;
+    request.concertDirectories = concertDirectories;
+
+    if (!isRunning()) {
+        start(request);
+        return;
+    }
+
+    // a load which was queued before never started, it's replaced by this one
+    if (m_loadQueued)
+        emit aborted();
+    m_queuedLoad = request;
+    m_loadQueued = true;
+    m_aborted.store(1);
+}
+
+/**
+ * @brief Stops loading, already loaded objects are deleted and aborted is emitted instead of finished
+ */
+void LibraryCacheLoader::abort()
+{
+    m_aborted.store(1);
+    if (m_loadQueued) {
+        m_loadQueued = false;
+        emit aborted();
+    }
+}
+
+/**
+ * @brief Checks if one of the libraries is still loading
+ * @return True if loading is in progress
+ */
+bool LibraryCacheLoader::isRunning() const
+{
+    return m_running > 0;
+}
+
+/**
+ * @brief Starts the worker threads of the three libraries
+ * @param request Directories to load
+ */
+void LibraryCacheLoader::start(const LoadRequest &request)
+{
+    m_current.store(0);
+    m_max.store(0);
+    m_aborted.store(0);
+    m_running = 3;
+    emit progress(0, 0);
+    m_progressTimer.start();
+
+    m_movieWatcher.setFuture(QtConcurrent::run(&LibraryCacheLoader::loadMovies, request.movieDirectories, this));
+    m_tvShowWatcher.setFuture(QtConcurrent::run(&LibraryCacheLoader::loadTvShows, request.tvShowDirectories, this));
+    m_concertWatcher.setFuture(QtConcurrent::run(&LibraryCacheLoader::loadConcerts, request.concertDirectories, this));
+}
+
+void LibraryCacheLoader::onProgressTimeout()
+{
+    emit progress(m_current.load(), m_max.load());
+}
+
+void LibraryCacheLoader::onMoviesLoaded()
+{
+    MovieCache movies = m_movieWatcher.result();
+    if (m_aborted.load()) {
+        QMapIterator<QString, QList<Movie*> > it(movies);
+        while (it.hasNext()) {
+            it.next();
+            qDeleteAll(it.value());
+        }
+    } else {
+        Manager::instance()->movieFileSearcher()->setCachedMovies(movies);
+    }
+    onLoaded();
+}
+
+void LibraryCacheLoader::onTvShowsLoaded()
+{
+    TvShowCache shows = m_tvShowWatcher.result();
+    if (m_aborted.load()) {
+        QMapIterator<QString, QList<TvShow*> > it(shows.shows);
+        while (it.hasNext()) {
+            it.next();
+            qDeleteAll(it.value());
+        }
+    } else {
+        Manager::instance()->tvShowFileSearcher()->setCachedTvShows(shows.shows, shows.episodes);
+    }
+    onLoaded();
+}
+
+void LibraryCacheLoader::onConcertsLoaded()
+{
+    ConcertCache concerts = m_concertWatcher.result();
+    if (m_aborted.load()) {
+        QMapIterator<QString, QList<Concert*> > it(concerts);
+        while (it.hasNext()) {
+            it.next();
+            qDeleteAll(it.value());
+        }
+    } else {
+        Manager::instance()->concertFileSearcher()->setCachedConcerts(concerts);
+    }
+    onLoaded();
+}
+
+/**
+ * @brief Called when one library was loaded, emits finished or aborted after the last one
+ *        and starts a load which was requested in the meantime
+ */
+void LibraryCacheLoader::onLoaded()
+{
+    if (--m_running > 0)
+        return;
+
+    m_progressTimer.stop();
+    if (m_aborted.load()) {
+        // start the queued load first, so a new load requested from a slot is queued behind it
+        if (m_loadQueued) {
+            m_loadQueued = false;
+            start(m_queuedLoad);
+        }
+        emit aborted();
+        return;
+    }
+    emit progress(m_current.load(), m_max.load());
+    emit finished();
+}
+
+/**
+ * @brief Checks if the contents of a directory are taken from the cache database
+ * @param dir Directory
+ * @return False if the directory is reloaded automatically or doesn't exist
+ */
+bool LibraryCacheLoader::isCached(const SettingsDir &dir)
+{
+    return !dir.autoReload && QFileInfo(dir.path).isDir();
+}
+
+/**
+ * @brief Loads and parses the movies of all cached directories, runs in a worker thread
+ * @param directories Movie directories
+ * @param loader Loader which collects the progress
+ * @return Movies by directory, they live in the thread of the loader
+ */
+LibraryCacheLoader::MovieCache LibraryCacheLoader::loadMovies(QList<SettingsDir> directories, LibraryCacheLoader *loader)
+{
+    ScopedTrace trace("LibraryCacheLoader::loadMovies");
+    MovieCache cache;
+    foreach (const SettingsDir &dir, directories) {
+        if (loader->m_aborted.load())
+            break;
+        if (!isCached(dir))
+            continue;
+
+        QList<Movie*> movies = Manager::instance()->database()->movies(dir.path);
+        loader->m_max.fetchAndAddOrdered(movies.count());
+        for (int i=0, n=movies.count() ; i<n && !loader->m_aborted.load() ; i+=ChunkSize) {
+            QList<Movie*> chunk = movies.mid(i, ChunkSize);
+            QtConcurrent::blockingMapped(chunk, MovieFileSearcher::loadMovieData);
+            loader->m_current.fetchAndAddOrdered(chunk.count());
+        }
+
+        foreach (Movie *movie, movies)
+            movie->moveToThread(loader->thread());
+        cache.insert(dir.path, movies);
+    }
+    return cache;
+}
+
+/**
+ * @brief Loads and parses the tv shows and episodes of all cached directories, runs in a worker thread
+ * @param directories Tv show directories
+ * @param loader Loader which collects the progress
+ * @return Shows by directory and their episodes, they live in the thread of the loader
+ */
+LibraryCacheLoader::TvShowCache LibraryCacheLoader::loadTvShows(QList<SettingsDir> directories, LibraryCacheLoader *loader)
+{
+    ScopedTrace trace("LibraryCacheLoader::loadTvShows");
+    TvShowCache cache;
+    foreach (const SettingsDir &dir, directories) {
+        if (loader->m_aborted.load())
+            break;
+        if (!isCached(dir))
+            continue;
+
+        QList<TvShow*> shows = Manager::instance()->database()->shows(dir.path);
+        foreach (TvShow *show, shows) {
+            if (!loader->m_aborted.load()) {
+                show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
+                QList<TvShowEpisode*> episodes = Manager::instance()->database()->episodes(show->databaseId());
+                loader->m_max.fetchAndAddOrdered(episodes.count());
+                QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::loadEpisodeData);
+                foreach (TvShowEpisode *episode, episodes)
+                    episode->setShow(show);
+                cache.episodes.insert(show, episodes);
+                loader->m_current.fetchAndAddOrdered(episodes.count());
+            }
+            // episodes are moved together with their show
+            show->moveToThread(loader->thread());
+        }
+        cache.shows.insert(dir.path, shows);
+    }
+    return cache;
+}
+
+/**
+ * @brief Loads and parses the concerts of all cached directories, runs in a worker thread
+ * @param directories Concert directories
+ * @param loader Loader which collects the progress
+ * @return Concerts by directory, they live in the thread of the loader
+ */
+LibraryCacheLoader::ConcertCache LibraryCacheLoader::loadConcerts(QList<SettingsDir> directories, LibraryCacheLoader *loader)
+{
+    ScopedTrace trace("LibraryCacheLoader::loadConcerts");
+    ConcertCache cache;
+    foreach (const SettingsDir &dir, directories) {
+        if (loader->m_aborted.load())
+            break;
+        if (!isCached(dir))
+            continue;
+
+        QList<Concert*> concerts = Manager::instance()->database()->concerts(dir.path);
+        loader->m_max.fetchAndAddOrdered(concerts.count());
+        for (int i=0, n=concerts.count() ; i<n && !loader->m_aborted.load() ; i+=ChunkSize) {
+            QList<Concert*> chunk = concerts.mid(i, ChunkSize);
+            QtConcurrent::blockingMapped(chunk, LibraryCacheLoader::loadConcertData);
+            loader->m_current.fetchAndAddOrdered(chunk.count());
+        }
+
+        foreach (Concert *concert, concerts)
+            concert->moveToThread(loader->thread());
+        cache.insert(dir.path, concerts);
+    }
+    return cache;
+}
+
+Concert *LibraryCacheLoader::loadConcertData(Concert *concert)
+{
+    concert->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
+    return concert;
+}
@@ -0,0 +1,80 @@
+#ifndef LIBRARYCACHELOADER_H
+#define LIBRARYCACHELOADER_H
+
+#include <QAtomicInt>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMap>
+#include <QObject>
+#include <QTimer>
+
+#include "data/Concert.h"
+#include "data/TvShow.h"
+#include "data/TvShowEpisode.h"
+#include "globals/Globals.h"
+#include "movies/Movie.h"
+
+/**
+ * @brief The LibraryCacheLoader class
+ *        Loads movies, tv shows and concerts of all directories which are not reloaded automatically
+ *        from the cache database at the same time. Every library is read in its own worker thread
+ *        with its own database connection and the nfo contents are parsed there.
+ *        The loaded objects are handed over to the file searchers, which only have to fill the models.
+ */
+class LibraryCacheLoader : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LibraryCacheLoader(QObject *parent = 0);
+    void load(QList<SettingsDir> movieDirectories, QList<SettingsDir> tvShowDirectories, QList<SettingsDir> concertDirectories);
+    void abort();
+    bool isRunning() const;
+
+signals:
+    void progress(int current, int max);
+    void finished();
+    void aborted();
+
+private slots:
+    void onMoviesLoaded();
+    void onTvShowsLoaded();
+    void onConcertsLoaded();
+    void onProgressTimeout();
+
+private:
+    typedef QMap<QString, QList<Movie*> > MovieCache;
+    typedef QMap<QString, QList<Concert*> > ConcertCache;
+    struct TvShowCache {
+        QMap<QString, QList<TvShow*> > shows;
+        QHash<TvShow*, QList<TvShowEpisode*> > episodes;
+    };
+
+    struct LoadRequest {
+        QList<SettingsDir> movieDirectories;
+        QList<SettingsDir> tvShowDirectories;
+        QList<SettingsDir> concertDirectories;
+    };
+
+    static const int ChunkSize = 50;
+
+    QFutureWatcher<MovieCache> m_movieWatcher;
+    QFutureWatcher<TvShowCache> m_tvShowWatcher;
+    QFutureWatcher<ConcertCache> m_concertWatcher;
+    QTimer m_progressTimer;
+    QAtomicInt m_current;
+    QAtomicInt m_max;
+    QAtomicInt m_aborted;
+    int m_running;
+    bool m_loadQueued;
+    LoadRequest m_queuedLoad;
+
+    static MovieCache loadMovies(QList<SettingsDir> directories, LibraryCacheLoader *loader);
+    static TvShowCache loadTvShows(QList<SettingsDir> directories, LibraryCacheLoader *loader);
+    static ConcertCache loadConcerts(QList<SettingsDir> directories, LibraryCacheLoader *loader);
+    static Concert *loadConcertData(Concert *concert);
+    static bool isCached(const SettingsDir &dir);
+    void start(const LoadRequest &request);
+    void onLoaded();
+};
+
+#endif // LIBRARYCACHELOADER_H
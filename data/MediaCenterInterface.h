@@ -8,6 +8,7 @@
 #include "data/TvShowEpisode.h"
 #include "settings/DataFile.h"
 
+class BatchSaver;
 class Concert;
 class Movie;
 class TvShow;
@@ -45,10 +46,19 @@ public:
     virtual QString nfoFilePath(Concert *concert) = 0;
     virtual QString nfoFilePath(TvShowEpisode *episode) = 0;
 
-    virtual QString imageFileName(Movie *movie, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false) = 0;
-    virtual QString imageFileName(Concert *concert, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false) = 0;
-    virtual QString imageFileName(TvShowEpisode *episode, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false) = 0;
-    virtual QString imageFileName(TvShow *show, int type, int season = -2, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false) = 0;
+    virtual void setBatchSaver(BatchSaver *batchSaver) = 0;
+    virtual QByteArray nfoXml(Movie *movie) = 0;
+    virtual QByteArray nfoXml(Concert *concert) = 0;
+    virtual QByteArray nfoXml(TvShow *show) = 0;
+    virtual QByteArray nfoXml(TvShowEpisode *episode) = 0;
+
+    virtual QString imageFileName(Movie *movie, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false) = 0;
+    virtual QString imageFileName(Concert *concert, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false) = 0;
+    virtual QString imageFileName(TvShowEpisode *episode, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false) = 0;
+    virtual QString imageFileName(TvShow *show, int type, int season = -2, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false) = 0;
+    virtual QList<int> existingImageTypes(Movie *movie) = 0;
+    virtual QList<int> existingImageTypes(Concert *concert) = 0;
+    virtual QList<int> existingImageTypes(TvShow *show) = 0;
 };
 
 #endif // MEDIACENTERINTERFACE_H
@@ -11,6 +11,7 @@
 #include <QSqlRecord>
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "globals/Tracer.h"
 
 /**
  * @brief MovieFileSearcher::MovieFileSearcher
@@ -31,19 +32,23 @@ MovieFileSearcher::~MovieFileSearcher()
 
 void MovieFileSearcher::reload(bool force)
 {
+    ScopedTrace trace("MovieFileSearcher::reload");
     m_aborted = false;
     emit searchStarted(tr("Searching for Movies..."), m_progressMessageId);
 
-    if (force)
+    if (force) {
+        clearCachedMovies();
         Manager::instance()->database()->clearMovies();
+    }
 
     Manager::instance()->movieModel()->clear();
     m_lastModifications.clear();
 
     QList<MovieContents> c;
     QList<Movie*> dbMovies;
-    QStringList bluRays;
-    QStringList dvds;
+    QList<Movie*> cachedMovies;
+    QSet<QString> bluRays;
+    QSet<QString> dvds;
     int movieSum = 0;
     int movieCounter = 0;
 
@@ -54,8 +59,14 @@ void MovieFileSearcher::reload(bool force)
             return;
 
         QList<Movie*> moviesFromDb;
-        if (!dir.autoReload && !force)
-            moviesFromDb = Manager::instance()->database()->movies(dir.path);
+        bool preloaded = false;
+        if (!dir.autoReload && !force) {
+            preloaded = m_cachedMovies.contains(dir.path);
+            if (preloaded)
+                moviesFromDb = m_cachedMovies.take(dir.path);
+            else
+                moviesFromDb = Manager::instance()->database()->movies(dir.path);
+        }
 
         if (dir.autoReload || force || moviesFromDb.count() == 0) {
             emit currentDir(dir.path);
@@ -127,10 +138,14 @@ void MovieFileSearcher::reload(bool force)
             con.contents = contents;
             c.append(con);
         } else {
-            dbMovies.append(moviesFromDb);
+            if (preloaded)
+                cachedMovies.append(moviesFromDb);
+            else
+                dbMovies.append(moviesFromDb);
             movieSum += moviesFromDb.count();
         }
     }
+    clearCachedMovies();
 
     emit searchStarted(tr("Loading Movies..."), m_progressMessageId);
 
@@ -150,31 +165,27 @@ void MovieFileSearcher::reload(bool force)
             DiscType discType = DiscSingle;
 
             // BluRay handling
-            foreach (const QString &path, bluRays) {
-                if (!files.isEmpty() && (files.first().startsWith(path + "/") || files.first().startsWith(path + "\\"))) {
-                    QStringList f;
-                    foreach (const QString &file, files) {
-                        if (file.endsWith("index.bdmv", Qt::CaseInsensitive))
-                            f.append(file);
-                    }
-                    files = f;
-                    discType = DiscBluRay;
-                    qDebug() << "It's a BluRay structure";
+            if (!files.isEmpty() && isInDirectory(files.first(), bluRays)) {
+                QStringList f;
+                foreach (const QString &file, files) {
+                    if (file.endsWith("index.bdmv", Qt::CaseInsensitive))
+                        f.append(file);
                 }
+                files = f;
+                discType = DiscBluRay;
+                qDebug() << "It's a BluRay structure";
             }
 
             // DVD handling
-            foreach (const QString &path, dvds) {
-                if (!files.isEmpty() && (files.first().startsWith(path + "/") || files.first().startsWith(path + "\\"))) {
-                    QStringList f;
-                    foreach (const QString &file, files) {
-                        if (file.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive))
-                            f.append(file);
-                    }
-                    files = f;
-                    discType = DiscDvd;
-                    qDebug() << "It's a DVD structure";
+            if (!files.isEmpty() && isInDirectory(files.first(), dvds)) {
+                QStringList f;
+                foreach (const QString &file, files) {
+                    if (file.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive))
+                        f.append(file);
                 }
+                files = f;
+                discType = DiscDvd;
+                qDebug() << "It's a DVD structure";
             }
 
             if (files.isEmpty())
@@ -193,18 +204,10 @@ void MovieFileSearcher::reload(bool force)
                 movies.append(movie);
                 emit currentDir(movie->name());
             } else {
+                // Group the files by their stacked base name, every name is computed only once
                 QMap<QString, QStringList> stacked;
-                while (!files.isEmpty()) {
-                    QString file = files.takeLast();
-                    QString stackedBase = Helper::stackedBaseName(file);
-                    stacked.insert(stackedBase, QStringList() << file);
-                    foreach (const QString &f, files) {
-                        if (Helper::stackedBaseName(f) == stackedBase) {
-                            stacked[stackedBase].append(f);
-                            files.removeOne(f);
-                        }
-                    }
-                }
+                for (int i=files.count()-1 ; i>=0 ; --i)
+                    stacked[Helper::stackedBaseName(files.at(i))].append(files.at(i));
                 QMapIterator<QString, QStringList> it(stacked);
                 while (it.hasNext()) {
                     it.next();
@@ -230,6 +233,7 @@ void MovieFileSearcher::reload(bool force)
     emit currentDir("");
 
     QtConcurrent::blockingMapped(dbMovies, MovieFileSearcher::loadMovieData);
+    dbMovies.append(cachedMovies);
 
     foreach (Movie *movie, dbMovies) {
         if (m_aborted)
@@ -239,19 +243,72 @@ void MovieFileSearcher::reload(bool force)
         emit progress(++movieCounter, movieSum, m_progressMessageId);
     }
 
-    foreach (Movie *movie, movies)
-        Manager::instance()->movieModel()->addMovie(movie);
+    {
+        ScopedTrace trace("MovieModel::addMovie");
+        foreach (Movie *movie, movies)
+            Manager::instance()->movieModel()->addMovie(movie);
+    }
 
     if (!m_aborted)
         emit moviesLoaded(m_progressMessageId);
 }
 
+/**
+ * @brief Checks if a file is located inside one of the given directories (or their subdirectories).
+ *        Walks up the parent directories of the file, so the cost only depends on the depth of the path.
+ * @param file File to check
+ * @param directories Set of directories
+ * @return True if one of the parent directories of the file is in the set
+ */
+bool MovieFileSearcher::isInDirectory(const QString &file, const QSet<QString> &directories)
+{
+    if (directories.isEmpty())
+        return false;
+
+    int pos = file.length();
+    while ((pos = qMax(file.lastIndexOf("/", pos-1), file.lastIndexOf("\\", pos-1))) > 0) {
+        if (directories.contains(file.left(pos)))
+            return true;
+    }
+    return false;
+}
+
 Movie *MovieFileSearcher::loadMovieData(Movie *movie)
 {
     movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
     return movie;
 }
 
+/**
+ * @brief Sets movies which were already loaded from the database and parsed in another thread.
+ *        They are used instead of querying the database by the next reload.
+ * @param movies Movies by path of their directory, they have to live in the thread of the searcher
+ */
+void MovieFileSearcher::setCachedMovies(QMap<QString, QList<Movie*> > movies)
+{
+    clearCachedMovies();
+    QMapIterator<QString, QList<Movie*> > it(movies);
+    while (it.hasNext()) {
+        it.next();
+        foreach (Movie *movie, it.value())
+            movie->setParent(this);
+    }
+    m_cachedMovies = movies;
+}
+
+/**
+ * @brief Deletes all preloaded movies which were not used
+ */
+void MovieFileSearcher::clearCachedMovies()
+{
+    QMapIterator<QString, QList<Movie*> > it(m_cachedMovies);
+    while (it.hasNext()) {
+        it.next();
+        qDeleteAll(it.value());
+    }
+    m_cachedMovies.clear();
+}
+
 /**
  * @brief Sets the directories to scan for movies. Not existing directories are skipped.
  * @param directories List of directories
@@ -388,4 +445,5 @@ QStringList MovieFileSearcher::getFiles(QString path)
 void MovieFileSearcher::abort()
 {
     m_aborted = true;
+    clearCachedMovies();
 }
@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QDir>
 #include <QHash>
+#include <QSet>
 #include <QTime>
 
 #include "movies/Movie.h"
@@ -21,6 +22,7 @@ public:
     void setMovieDirectories(QList<SettingsDir> directories);
     void scanDir(QString startPath, QString path, QList<QStringList> &contents, bool separateFolders = false, bool firstScan = false);
     static Movie *loadMovieData(Movie *movie);
+    void setCachedMovies(QMap<QString, QList<Movie*> > movies);
 
 public slots:
     void reload(bool force);
@@ -34,11 +36,14 @@ signals:
 
 private:
     QStringList getFiles(QString path);
+    static bool isInDirectory(const QString &file, const QSet<QString> &directories);
+    void clearCachedMovies();
 
     QList<SettingsDir> m_directories;
     int m_progressMessageId;
     QHash<QString, QDateTime> m_lastModifications;
     bool m_aborted;
+    QMap<QString, QList<Movie*> > m_cachedMovies;
 
     struct MovieContents {
         QString path;
@@ -0,0 +1,165 @@
+#include "MovieIndex.h"
+
+#include <QtAlgorithms>
+
+/**
+ * @brief Orders values like LocaleStringCompare, values the locale treats as equal are ordered by their code points.
+ *        The index is hashed, so without the tie breaker their order would change from run to run.
+ */
+static bool valueLessThan(const QString &a, const QString &b)
+{
+    int result = QString::localeAwareCompare(a, b);
+    if (result == 0)
+        return a < b;
+    return result < 0;
+}
+
+/**
+ * @brief MovieIndex::MovieIndex
+ * @param parent
+ */
+MovieIndex::MovieIndex(QObject *parent) :
+    QObject(parent)
+{
+    for (int i=0 ; i<KeyCount ; ++i)
+        m_valuesChanged[i] = false;
+}
+
+/**
+ * @brief Adds a movie to the index
+ * @param movie Movie to add
+ */
+void MovieIndex::addMovie(Movie *movie)
+{
+    m_changedMovies.insert(movie);
+}
+
+/**
+ * @brief Marks a movie as changed, it's reindexed on the next lookup
+ * @param movie Changed movie
+ */
+void MovieIndex::movieChanged(Movie *movie)
+{
+    m_changedMovies.insert(movie);
+}
+
+/**
+ * @brief Removes all movies from the index
+ */
+void MovieIndex::clear()
+{
+    for (int i=0 ; i<KeyCount ; ++i) {
+        m_movieValues[i].clear();
+        m_valueMovies[i].clear();
+        m_sortedValues[i].clear();
+        m_valuesChanged[i] = false;
+    }
+    m_changedMovies.clear();
+}
+
+/**
+ * @brief Returns all values of a key which are used by at least one movie
+ * @param key Set, genre, certification or tag
+ * @return Values sorted by the locale
+ */
+QStringList MovieIndex::values(Key key)
+{
+    update();
+    if (m_valuesChanged[key]) {
+        m_sortedValues[key] = m_valueMovies[key].keys();
+        qSort(m_sortedValues[key].begin(), m_sortedValues[key].end(), valueLessThan);
+        m_valuesChanged[key] = false;
+    }
+    return m_sortedValues[key];
+}
+
+/**
+ * @brief Returns all movies using a value
+ * @param key Set, genre, certification or tag
+ * @param value Value of the key, e.g. the name of a genre
+ * @return List of movies sorted by name
+ */
+QList<Movie*> MovieIndex::movies(Key key, const QString &value)
+{
+    update();
+    QList<Movie*> movies = m_valueMovies[key].value(value).toList();
+    qSort(movies.begin(), movies.end(), Movie::lessThan);
+    return movies;
+}
+
+/**
+ * @brief Reindexes all changed movies
+ */
+void MovieIndex::update()
+{
+    foreach (Movie *movie, m_changedMovies)
+        reindex(movie);
+    m_changedMovies.clear();
+}
+
+/**
+ * @brief Updates the values of a movie in all keys
+ * @param movie Movie to reindex
+ */
+void MovieIndex::reindex(Movie *movie)
+{
+    for (int i=0 ; i<KeyCount ; ++i) {
+        QStringList oldValues = m_movieValues[i].value(movie);
+        QStringList newValues = movieValues(movie, static_cast<Key>(i));
+        if (oldValues == newValues)
+            continue;
+
+        foreach (const QString &value, oldValues) {
+            if (newValues.contains(value))
+                continue;
+            QHash<QString, QSet<Movie*> >::iterator it = m_valueMovies[i].find(value);
+            if (it == m_valueMovies[i].end())
+                continue;
+            it.value().remove(movie);
+            if (it.value().isEmpty()) {
+                m_valueMovies[i].erase(it);
+                m_valuesChanged[i] = true;
+            }
+        }
+        foreach (const QString &value, newValues) {
+            if (oldValues.contains(value))
+                continue;
+            if (!m_valueMovies[i].contains(value))
+                m_valuesChanged[i] = true;
+            m_valueMovies[i][value].insert(movie);
+        }
+
+        if (newValues.isEmpty())
+            m_movieValues[i].remove(movie);
+        else
+            m_movieValues[i].insert(movie, newValues);
+    }
+}
+
+/**
+ * @brief Returns the non empty values of a key for a movie
+ * @param movie Movie
+ * @param key Set, genre, certification or tag
+ * @return List of values
+ */
+QStringList MovieIndex::movieValues(Movie *movie, Key key)
+{
+    QStringList values;
+    switch (key) {
+    case Set:
+        values << movie->set();
+        break;
+    case Genre:
+        values << movie->genres();
+        break;
+    case Certification:
+        values << movie->certification();
+        break;
+    case Tag:
+        values << movie->tags();
+        break;
+    }
+    values.removeAll("");
+    values.removeDuplicates();
+    return values;
+}
@@ -0,0 +1,48 @@
+#ifndef MOVIEINDEX_H
+#define MOVIEINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include "movies/Movie.h"
+
+/**
+ * @brief The MovieIndex class
+ *        Maps sets, genres, certifications and tags to the movies using them.
+ *        Changed movies are only marked and reindexed on the next lookup.
+ */
+class MovieIndex : public QObject
+{
+    Q_OBJECT
+public:
+    enum Key {
+        Set = 0,
+        Genre,
+        Certification,
+        Tag
+    };
+
+    explicit MovieIndex(QObject *parent = 0);
+    void addMovie(Movie *movie);
+    void movieChanged(Movie *movie);
+    void clear();
+    QStringList values(Key key);
+    QList<Movie*> movies(Key key, const QString &value);
+
+private:
+    static const int KeyCount = 4;
+
+    QHash<Movie*, QStringList> m_movieValues[KeyCount];
+    QHash<QString, QSet<Movie*> > m_valueMovies[KeyCount];
+    QStringList m_sortedValues[KeyCount];
+    bool m_valuesChanged[KeyCount];
+    QSet<Movie*> m_changedMovies;
+
+    void update();
+    void reindex(Movie *movie);
+    static QStringList movieValues(Movie *movie, Key key);
+};
+
+#endif // MOVIEINDEX_H
@@ -9,7 +9,8 @@
  * @param parent
  */
 MovieModel::MovieModel(QObject *parent) :
-    QAbstractItemModel(parent)
+    QAbstractItemModel(parent),
+    m_movieIndex(new MovieIndex(this))
 {
     m_newIcon = QIcon(":/img/star_blue.png");
     m_syncIcon = QIcon(":/img/reload_orange.png");
@@ -24,16 +25,18 @@ void MovieModel::addMovie(Movie *movie)
     beginInsertRows(QModelIndex(), rowCount(), rowCount());
     m_movies.append(movie);
     endInsertRows();
+    m_movieIndex->addMovie(movie);
     connect(movie, SIGNAL(sigChanged(Movie*)), this, SLOT(onMovieChanged(Movie*)), Qt::UniqueConnection);
 }
 
 /**
  * @brief Called when a movies data has changed
- * Emits dataChanged
+ * Emits dataChanged and marks the movie as changed in the movie index
  * @param movie Movie which has changed
  */
 void MovieModel::onMovieChanged(Movie *movie)
 {
+    m_movieIndex->movieChanged(movie);
     QModelIndex index = createIndex(m_movies.indexOf(movie), 0);
     emit dataChanged(index, index);
 }
@@ -210,6 +213,7 @@ void MovieModel::clear()
     foreach (Movie *movie, m_movies)
         movie->deleteLater();
     m_movies.clear();
+    m_movieIndex->clear();
     endRemoveRows();
 }
 
@@ -222,6 +226,15 @@ QList<Movie*> MovieModel::movies()
     return m_movies;
 }
 
+/**
+ * @brief Returns the index of sets, genres, certifications and tags
+ * @return Index of all movies in the model
+ */
+MovieIndex *MovieModel::movieIndex()
+{
+    return m_movieIndex;
+}
+
 /**
  * @brief Checks if there are new movies (movies where infoLoaded is false)
  * @return True if there are new movies
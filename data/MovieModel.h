@@ -3,6 +3,7 @@
 
 #include <QAbstractItemModel>
 #include <QIcon>
+#include "data/MovieIndex.h"
 #include "movies/Movie.h"
 
 /**
@@ -20,6 +21,7 @@ public:
     void addMovie(Movie *movie);
     void clear();
     QList<Movie*> movies();
+    MovieIndex *movieIndex();
     Movie *movie(int row);
     int rowCount(const QModelIndex &parent = QModelIndex()) const;
     int columnCount(const QModelIndex &parent = QModelIndex()) const;
@@ -39,6 +41,7 @@ private:
     QList<Movie*> m_movies;
     QIcon m_newIcon;
     QIcon m_syncIcon;
+    MovieIndex *m_movieIndex;
 };
 
 #endif // MOVIEMODEL_H
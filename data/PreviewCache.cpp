@@ -0,0 +1,214 @@
+#include "PreviewCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QPair>
+#include <QTextStream>
+#include "settings/Settings.h"
+
+PreviewCache::PreviewCache(QObject *parent) :
+    QObject(parent),
+    m_size(0),
+    m_maxSize(100*1024*1024)
+{
+    QString location = Settings::instance()->imageCacheDir();
+    QDir dir(location);
+    if (!dir.exists())
+        dir.mkdir(location);
+    location = location + "/previews";
+    dir.setPath(location);
+    bool exists = dir.exists();
+    if (!exists)
+        exists = dir.mkdir(location);
+    if (exists)
+        m_cacheDir = location;
+    qDebug() << "Preview cache dir" << m_cacheDir;
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(5000);
+    connect(&m_saveTimer, SIGNAL(timeout()), this, SLOT(saveIndex()));
+
+    loadIndex();
+}
+
+/**
+ * @brief Returns an instance of the preview cache
+ *        The first call has to happen in the main thread
+ * @param parent Parent object
+ * @return Instance of the preview cache
+ */
+PreviewCache *PreviewCache::instance(QObject *parent)
+{
+    static PreviewCache *m_instance = 0;
+    if (!m_instance)
+        m_instance = new PreviewCache(parent);
+    return m_instance;
+}
+
+/**
+ * @brief Checks if a preview is cached
+ * @param url Url of the original image
+ * @param width Width of the preview
+ * @return True if the preview is cached
+ */
+bool PreviewCache::contains(const QUrl &url, int width)
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.contains(fileName(url, width));
+}
+
+/**
+ * @brief Loads a cached preview and marks it as recently used
+ * @param url Url of the original image
+ * @param width Width of the preview
+ * @return Preview, a null image if it's not cached
+ */
+QImage PreviewCache::image(const QUrl &url, int width)
+{
+    QString name = fileName(url, width);
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_entries.contains(name))
+            return QImage();
+        m_entries[name].lastAccess = QDateTime::currentMSecsSinceEpoch();
+    }
+    scheduleSave();
+
+    QImage image(m_cacheDir + "/" + name);
+    if (image.isNull()) {
+        QMutexLocker locker(&m_mutex);
+        if (m_entries.contains(name))
+            m_size -= m_entries.take(name).size;
+    }
+    return image;
+}
+
+/**
+ * @brief Stores a preview
+ * @param url Url of the original image
+ * @param width Width of the preview
+ * @param image Preview
+ */
+void PreviewCache::insert(const QUrl &url, int width, const QImage &image)
+{
+    if (m_cacheDir.isEmpty() || image.isNull())
+        return;
+
+    QString name = fileName(url, width);
+    QString path = m_cacheDir + "/" + name;
+    if (!image.save(path, "png", -1)) {
+        qWarning() << "Could not save preview" << path;
+        return;
+    }
+
+    Entry entry;
+    entry.size = QFileInfo(path).size();
+    entry.lastAccess = QDateTime::currentMSecsSinceEpoch();
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_entries.contains(name))
+            m_size -= m_entries.value(name).size;
+        m_entries.insert(name, entry);
+        m_size += entry.size;
+        if (m_size > m_maxSize)
+            removeLeastRecentlyUsed();
+    }
+    scheduleSave();
+}
+
+/**
+ * @brief Removes the least recently used previews until the cache uses 90% of its size
+ *        The mutex has to be locked
+ */
+void PreviewCache::removeLeastRecentlyUsed()
+{
+    QList<QPair<qint64, QString> > entries;
+    QHashIterator<QString, Entry> it(m_entries);
+    while (it.hasNext()) {
+        it.next();
+        entries.append(qMakePair(it.value().lastAccess, it.key()));
+    }
+    qSort(entries);
+
+    for (int i=0, n=entries.count() ; i<n && m_size > m_maxSize*0.9 ; ++i) {
+        QString name = entries.at(i).second;
+        QFile::remove(m_cacheDir + "/" + name);
+        m_size -= m_entries.take(name).size;
+    }
+}
+
+/**
+ * @brief Reads the cached previews and their last access times
+ */
+void PreviewCache::loadIndex()
+{
+    if (m_cacheDir.isEmpty())
+        return;
+
+    QHash<QString, qint64> lastAccess;
+    QFile file(m_cacheDir + "/index");
+    if (file.open(QIODevice::ReadOnly)) {
+        QTextStream in(&file);
+        while (!in.atEnd()) {
+            QStringList parts = in.readLine().split("\t");
+            if (parts.count() == 2)
+                lastAccess.insert(parts.at(0), parts.at(1).toLongLong());
+        }
+        file.close();
+    }
+
+    foreach (const QFileInfo &fi, QDir(m_cacheDir).entryInfoList(QStringList() << "*.png", QDir::Files)) {
+        Entry entry;
+        entry.size = fi.size();
+        entry.lastAccess = lastAccess.value(fi.fileName(), fi.lastModified().toMSecsSinceEpoch());
+        m_entries.insert(fi.fileName(), entry);
+        m_size += entry.size;
+    }
+    qDebug() << "Preview cache contains" << m_entries.count() << "previews," << m_size/1024 << "kB";
+}
+
+/**
+ * @brief Writes the last access times to the index file
+ */
+void PreviewCache::saveIndex()
+{
+    if (m_cacheDir.isEmpty())
+        return;
+
+    QByteArray content;
+    {
+        QMutexLocker locker(&m_mutex);
+        QHashIterator<QString, Entry> it(m_entries);
+        while (it.hasNext()) {
+            it.next();
+            content.append(QString("%1\t%2\n").arg(it.key()).arg(it.value().lastAccess).toUtf8());
+        }
+    }
+
+    QFile file(m_cacheDir + "/index");
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not write preview cache index";
+        return;
+    }
+    file.write(content);
+    file.close();
+}
+
+/**
+ * @brief Starts the timer which saves the index, may be called from any thread
+ */
+void PreviewCache::scheduleSave()
+{
+    QMetaObject::invokeMethod(&m_saveTimer, "start", Qt::QueuedConnection);
+}
+
+QString PreviewCache::fileName(const QUrl &url, int width)
+{
+    QString md5 = QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Md5).toHex();
+    return QString("%1_%2.png").arg(md5).arg(width);
+}
@@ -0,0 +1,49 @@
+#ifndef PREVIEWCACHE_H
+#define PREVIEWCACHE_H
+
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QTimer>
+#include <QUrl>
+
+/**
+ * @brief The PreviewCache class
+ *        Stores downscaled previews of remote images on disk, keyed by url and width.
+ *        The least recently used previews are removed when the cache exceeds its size.
+ *        All public functions except instance may be called from worker threads.
+ */
+class PreviewCache : public QObject
+{
+    Q_OBJECT
+public:
+    explicit PreviewCache(QObject *parent = 0);
+    static PreviewCache *instance(QObject *parent = 0);
+    bool contains(const QUrl &url, int width);
+    QImage image(const QUrl &url, int width);
+    void insert(const QUrl &url, int width, const QImage &image);
+
+private slots:
+    void saveIndex();
+
+private:
+    struct Entry {
+        qint64 size;
+        qint64 lastAccess;
+    };
+
+    QString m_cacheDir;
+    QHash<QString, Entry> m_entries;
+    qint64 m_size;
+    qint64 m_maxSize;
+    QMutex m_mutex;
+    QTimer m_saveTimer;
+
+    void loadIndex();
+    void scheduleSave();
+    void removeLeastRecentlyUsed();
+    static QString fileName(const QUrl &url, int width);
+};
+
+#endif // PREVIEWCACHE_H
@@ -0,0 +1,389 @@
+#include "SafeFileWriter.h"
+
+#include <QAtomicInt>
+#include <QBuffer>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSet>
+#include "settings/Settings.h"
+
+#ifdef Q_OS_WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(Q_OS_LINUX) || defined(Q_OS_MAC)
+#include <sys/xattr.h>
+#endif
+
+static const qint64 chunkSize = 64*1024;
+static QAtomicInt temporaryFileCounter;
+
+/**
+ * @brief Writes a file if its content has changed
+ * @param fileName File to write
+ * @param data Content
+ * @param text Write line endings of the platform
+ * @param skipped Set to true if the file already had the content
+ * @return True if the file has the content afterwards
+ */
+bool SafeFileWriter::write(QString fileName, QByteArray data, bool text, bool *skipped)
+{
+    QByteArray content = fileContent(data, text);
+    QBuffer buffer(&content);
+    buffer.open(QIODevice::ReadOnly);
+    return write(fileName, &buffer, skipped);
+}
+
+/**
+ * @brief Writes the content of a device if the file has a different content
+ * @param fileName File to write
+ * @param content Opened device with the file content
+ * @param skipped Set to true if the file already had the content
+ * @return True if the file has the content afterwards
+ */
+bool SafeFileWriter::write(QString fileName, QIODevice *content, bool *skipped)
+{
+    bool unchanged = isUnchanged(fileName, content);
+    if (skipped)
+        *skipped = unchanged;
+    if (unchanged)
+        return true;
+
+    return replace(fileName, content);
+}
+
+/**
+ * @brief Writes an image if the file has a different content. The file is compared with the checksum of the image,
+ *        so the image itself is only read if it has to be written. Staged images are copied in chunks.
+ * @param fileName File to write
+ * @param image Image
+ * @param skipped Set to true if the file already had the content
+ * @return True if the file has the content afterwards
+ */
+bool SafeFileWriter::writeImage(QString fileName, StagedImage image, bool *skipped)
+{
+    bool unchanged = isUnchanged(fileName, image.size(), image.checksum());
+    if (skipped)
+        *skipped = unchanged;
+    if (unchanged)
+        return true;
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    QFile file(image.stagedFileName());
+    QIODevice *device = &buffer;
+    if (!image.stagedFileName().isEmpty())
+        device = &file;
+    else
+        data = image.data();
+    if (!device->open(QIODevice::ReadOnly))
+        return false;
+    return replace(fileName, device);
+}
+
+/**
+ * @brief Writes the content to a temporary file which replaces the target
+ * @param fileName Target file
+ * @param content Opened device with the file content
+ * @return True if the target has the content afterwards
+ */
+bool SafeFileWriter::replace(const QString &fileName, QIODevice *content)
+{
+    QString tmpFileName;
+    bool sync = Settings::instance()->advanced()->syncWrites();
+    if (!writeTemporary(fileName, content, sync, &tmpFileName) || !commit(fileName, tmpFileName))
+        return false;
+    if (sync && !tmpFileName.isEmpty())
+        syncDirectories(QStringList() << fileName);
+    return true;
+}
+
+/**
+ * @brief Returns the bytes which end up in the file
+ * @param data Content
+ * @param text Convert line endings like a file opened in text mode
+ * @return File content
+ */
+QByteArray SafeFileWriter::fileContent(QByteArray data, bool text)
+{
+#ifdef Q_OS_WIN32
+    if (text)
+        data.replace("\n", "\r\n");
+#else
+    Q_UNUSED(text);
+#endif
+    return data;
+}
+
+/**
+ * @brief Checks if the file already has the content. The file is only read if the size matches.
+ * @param fileName File to check
+ * @param content Opened device with the file content
+ * @return True if the file exists with exactly this content
+ */
+bool SafeFileWriter::isUnchanged(QString fileName, QIODevice *content)
+{
+    QFileInfo fi(fileName);
+    if (!fi.isFile() || fi.size() != content->size())
+        return false;
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly) || !content->seek(0))
+        return false;
+    while (!file.atEnd()) {
+        QByteArray chunk = file.read(chunkSize);
+        if (chunk.isEmpty() || content->read(chunk.size()) != chunk)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks if the file already has the content with the given checksum. The file is only read if the size matches.
+ * @param fileName File to check
+ * @param size Size of the content
+ * @param checksum MD5 checksum of the content
+ * @return True if the file exists with this content
+ */
+bool SafeFileWriter::isUnchanged(QString fileName, qint64 size, QByteArray checksum)
+{
+    QFileInfo fi(fileName);
+    if (checksum.isEmpty() || !fi.isFile() || fi.size() != size)
+        return false;
+
+    QFile file(fileName);
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    if (!file.open(QIODevice::ReadOnly) || !hash.addData(&file))
+        return false;
+    return hash.result() == checksum;
+}
+
+/**
+ * @brief Writes the content to a new temporary file next to the target.
+ *        If the target must keep its file (see SafeFileWriter::mustWriteInPlace) or the temporary
+ *        file can not be created, the target is written in place and no temporary file is left.
+ * @param fileName Target file
+ * @param content Opened device with the file content
+ * @param sync Flush the data to disk
+ * @param temporaryFileName Set to the written temporary file, empty if the target was written in place
+ * @return True if the temporary file (or the target) was written completely
+ * @see SafeFileWriter::commit
+ */
+bool SafeFileWriter::writeTemporary(QString fileName, QIODevice *content, bool sync, QString *temporaryFileName)
+{
+    temporaryFileName->clear();
+    QString target = resolvedFileName(fileName);
+    if (!content->seek(0))
+        return false;
+
+    // left over by older versions which used a fixed name
+    if (QFileInfo(target + ".mediaelch-tmp").isFile())
+        QFile::remove(target + ".mediaelch-tmp");
+
+    if (mustWriteInPlace(target))
+        return writeInPlace(target, content, sync);
+
+    QFile file(SafeFileWriter::temporaryFileName(target));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        // e.g. the file is writable but its directory is not
+        qDebug() << "Could not create" << file.fileName() << "writing in place";
+        return writeInPlace(target, content, sync);
+    }
+
+    if (!writeContent(file, content, sync)) {
+        QFile::remove(file.fileName());
+        return false;
+    }
+
+    // keep the permissions of the file which is replaced
+    QFileInfo fi(target);
+    if (fi.exists())
+        file.setPermissions(fi.permissions());
+    *temporaryFileName = file.fileName();
+    return true;
+}
+
+/**
+ * @brief Replaces the target with the temporary file written by SafeFileWriter::writeTemporary.
+ *        Does nothing if the target was written in place.
+ * @param fileName Target file
+ * @param temporaryFileName Temporary file returned by SafeFileWriter::writeTemporary
+ * @return True if the target was replaced, the temporary file is removed if not
+ */
+bool SafeFileWriter::commit(QString fileName, QString temporaryFileName)
+{
+    if (temporaryFileName.isEmpty())
+        return true;
+    QString target = resolvedFileName(fileName);
+    QString tmpFileName = temporaryFileName;
+
+#ifdef Q_OS_WIN32
+    // ReplaceFileW keeps the ACLs, attributes and alternate streams of the replaced file
+    const wchar_t *nativeTarget = reinterpret_cast<const wchar_t*>(QDir::toNativeSeparators(target).utf16());
+    const wchar_t *nativeTmp = reinterpret_cast<const wchar_t*>(QDir::toNativeSeparators(tmpFileName).utf16());
+    bool success;
+    if (QFileInfo(target).exists())
+        success = ReplaceFileW(nativeTarget, nativeTmp, 0, REPLACEFILE_IGNORE_MERGE_ERRORS, 0, 0);
+    else
+        success = MoveFileExW(nativeTmp, nativeTarget, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    bool success = (::rename(QFile::encodeName(tmpFileName).constData(), QFile::encodeName(target).constData()) == 0);
+#endif
+    if (!success) {
+        qWarning() << "Could not replace" << target;
+        QFile::remove(tmpFileName);
+    }
+    return success;
+}
+
+/**
+ * @brief Flushes the directory entries of replaced files to disk, every directory is synced once
+ * @param fileNames Replaced files
+ */
+void SafeFileWriter::syncDirectories(const QStringList &fileNames)
+{
+#ifdef Q_OS_WIN32
+    // directories can not be flushed on Windows, MoveFileExW writes through already
+    Q_UNUSED(fileNames);
+#else
+    QSet<QString> directories;
+    foreach (const QString &fileName, fileNames)
+        directories.insert(QFileInfo(resolvedFileName(fileName)).absolutePath());
+    foreach (const QString &directory, directories) {
+        int fd = ::open(QFile::encodeName(directory).constData(), O_RDONLY);
+        if (fd < 0)
+            continue;
+        ::fsync(fd);
+        ::close(fd);
+    }
+#endif
+}
+
+/**
+ * @brief Builds a temporary file name next to the target which is unique for this process,
+ *        so a file left over by a crash is never taken for a new one
+ * @param fileName Resolved target file
+ * @return Temporary file name
+ */
+QString SafeFileWriter::temporaryFileName(const QString &fileName)
+{
+    return QString("%1.%2-%3.mediaelch-tmp").arg(fileName).arg(QCoreApplication::applicationPid()).arg(temporaryFileCounter.fetchAndAddRelaxed(1));
+}
+
+/**
+ * @brief Returns the file which is actually written, symlinks are replaced by their target
+ * @param fileName File to write
+ * @return Resolved file name
+ */
+QString SafeFileWriter::resolvedFileName(const QString &fileName)
+{
+    QFileInfo fi(fileName);
+    if (!fi.isSymLink())
+        return fileName;
+    QString target = fi.canonicalFilePath();
+    return target.isEmpty() ? fi.symLinkTarget() : target;
+}
+
+/**
+ * @brief Checks if replacing the file by a new one would lose something:
+ *        other hardlinks to it, its owner or its extended attributes and ACLs
+ * @param fileName Resolved target file
+ * @return True if the existing file has to be overwritten in place
+ */
+bool SafeFileWriter::mustWriteInPlace(const QString &fileName)
+{
+#ifdef Q_OS_WIN32
+    HANDLE handle = CreateFileW(reinterpret_cast<const wchar_t*>(QDir::toNativeSeparators(fileName).utf16()), 0,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, 0, OPEN_EXISTING, 0, 0);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    bool hardlinked = GetFileInformationByHandle(handle, &info) && info.nNumberOfLinks > 1;
+    CloseHandle(handle);
+    return hardlinked;
+#else
+    QByteArray path = QFile::encodeName(fileName);
+    struct stat info;
+    if (::stat(path.constData(), &info) != 0)
+        return false;
+    if (info.st_nlink > 1 || info.st_uid != ::geteuid())
+        return true;
+#if defined(Q_OS_LINUX) || defined(Q_OS_MAC)
+    // the SELinux label is set for the new file as well
+#if defined(Q_OS_LINUX)
+    ssize_t size = ::listxattr(path.constData(), 0, 0);
+#else
+    ssize_t size = ::listxattr(path.constData(), 0, 0, 0);
+#endif
+    if (size <= 0)
+        return false;
+    QByteArray names(size, '\0');
+#if defined(Q_OS_LINUX)
+    size = ::listxattr(path.constData(), names.data(), names.size());
+#else
+    size = ::listxattr(path.constData(), names.data(), names.size(), 0);
+#endif
+    foreach (const QByteArray &name, names.left(qMax<ssize_t>(size, 0)).split('\0')) {
+        if (!name.isEmpty() && name != "security.selinux")
+            return true;
+    }
+    return false;
+#else
+    return false;
+#endif
+#endif
+}
+
+/**
+ * @brief Overwrites the target directly, used when it can not be replaced
+ * @param fileName Resolved target file
+ * @param content Opened device with the file content
+ * @param sync Flush the data to disk
+ * @return True if the file was written completely
+ */
+bool SafeFileWriter::writeInPlace(const QString &fileName, QIODevice *content, bool sync)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    if (!writeContent(file, content, sync)) {
+        qWarning() << "Could not write" << fileName;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the content in chunks to an opened file and closes it
+ * @param file Opened file
+ * @param content Device with the file content, positioned at the start
+ * @param sync Flush the data to disk
+ * @return True if the file was written completely
+ */
+bool SafeFileWriter::writeContent(QFile &file, QIODevice *content, bool sync)
+{
+    bool success = true;
+    while (success && !content->atEnd()) {
+        QByteArray chunk = content->read(chunkSize);
+        success = !chunk.isEmpty() && file.write(chunk) == chunk.size();
+    }
+    success = success && file.flush();
+    if (success && sync) {
+#ifdef Q_OS_WIN32
+        success = (_commit(file.handle()) == 0);
+#else
+        success = (::fsync(file.handle()) == 0);
+#endif
+    }
+    file.close();
+    return success;
+}
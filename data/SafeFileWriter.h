@@ -0,0 +1,46 @@
+#ifndef SAFEFILEWRITER_H
+#define SAFEFILEWRITER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QIODevice>
+#include <QString>
+#include <QStringList>
+#include "data/StagedImage.h"
+
+/**
+ * @brief The SafeFileWriter class
+ *        Writes nfo files and images only if their content differs from the file on disk,
+ *        so unchanged files keep their modification time.
+ *        New content is written to a uniquely named temporary file next to the target which then replaces the target,
+ *        a crash never leaves a truncated file behind. Symlinks are resolved, so the file they point to is replaced.
+ *        Files which would lose something when being replaced (hardlinks, other owner, extended attributes)
+ *        and files in directories which are not writable are written in place instead.
+ *        With <syncWrites>true</syncWrites> in the advanced settings the data is flushed to disk before the rename
+ *        and the directory afterwards.
+ *        Content from a device (e.g. a staged image file) is compared and copied in chunks,
+ *        images are compared by their checksum.
+ */
+class SafeFileWriter
+{
+public:
+    static bool write(QString fileName, QByteArray data, bool text, bool *skipped = 0);
+    static bool write(QString fileName, QIODevice *content, bool *skipped = 0);
+    static bool writeImage(QString fileName, StagedImage image, bool *skipped = 0);
+    static QByteArray fileContent(QByteArray data, bool text);
+    static bool isUnchanged(QString fileName, QIODevice *content);
+    static bool isUnchanged(QString fileName, qint64 size, QByteArray checksum);
+    static bool writeTemporary(QString fileName, QIODevice *content, bool sync, QString *temporaryFileName);
+    static bool commit(QString fileName, QString temporaryFileName);
+    static void syncDirectories(const QStringList &fileNames);
+
+private:
+    static bool replace(const QString &fileName, QIODevice *content);
+    static QString resolvedFileName(const QString &fileName);
+    static QString temporaryFileName(const QString &fileName);
+    static bool mustWriteInPlace(const QString &fileName);
+    static bool writeInPlace(const QString &fileName, QIODevice *content, bool sync);
+    static bool writeContent(QFile &file, QIODevice *content, bool sync);
+};
+
+#endif // SAFEFILEWRITER_H
@@ -0,0 +1,159 @@
+#include "StagedImage.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+
+// images up to this size are kept in memory
+static const int maxMemorySize = 128*1024;
+
+class StagedImage::Private
+{
+public:
+    Private() : size(0) {}
+    ~Private()
+    {
+        if (!fileName.isEmpty())
+            QFile::remove(fileName);
+    }
+
+    QByteArray data;
+    QString fileName;
+    qint64 size;
+    QByteArray checksum;
+};
+
+/**
+ * @brief Creates a null image
+ */
+StagedImage::StagedImage()
+{
+}
+
+/**
+ * @brief Stages the image data, large images are moved to a file
+ * @param data Image data
+ */
+StagedImage::StagedImage(const QByteArray &data)
+{
+    if (data.isNull())
+        return;
+
+    d = QSharedPointer<Private>(new Private);
+    d->size = data.size();
+    d->checksum = QCryptographicHash::hash(data, QCryptographicHash::Md5);
+    if (data.size() <= maxMemorySize || stagingDir().isEmpty()) {
+        d->data = data;
+        return;
+    }
+
+    QTemporaryFile file(stagingDir() + "/imageXXXXXX");
+    file.setAutoRemove(false);
+    if (file.open() && file.write(data) == data.size()) {
+        d->fileName = file.fileName();
+    } else {
+        qWarning() << "Could not stage image, keeping it in memory";
+        file.remove();
+        d->data = data;
+    }
+}
+
+/**
+ * @brief Takes over a file in the staging directory, the file is removed with the last handle.
+ *        Small files are read into memory and removed right away.
+ * @param fileName Staged file
+ * @param checksum MD5 of the file, computed while it was written. If empty the file is read once to compute it.
+ * @return Image handle, null if the file is empty
+ */
+StagedImage StagedImage::fromStagedFile(QString fileName, QByteArray checksum)
+{
+    StagedImage image;
+    qint64 size = QFileInfo(fileName).size();
+    if (size <= maxMemorySize) {
+        QFile file(fileName);
+        if (size > 0 && file.open(QIODevice::ReadOnly))
+            image = StagedImage(file.readAll());
+        file.remove();
+        return image;
+    }
+
+    image.d = QSharedPointer<Private>(new Private);
+    image.d->fileName = fileName;
+    image.d->size = size;
+    image.d->checksum = checksum;
+    if (checksum.isEmpty()) {
+        QFile file(fileName);
+        QCryptographicHash hash(QCryptographicHash::Md5);
+        if (file.open(QIODevice::ReadOnly) && hash.addData(&file))
+            image.d->checksum = hash.result();
+    }
+    return image;
+}
+
+/**
+ * @brief Directory of the staged images, it is removed when MediaElch quits
+ * @return Path or an empty string if the directory could not be created
+ */
+QString StagedImage::stagingDir()
+{
+    static QTemporaryDir dir;
+    return dir.isValid() ? dir.path() : QString();
+}
+
+bool StagedImage::isNull() const
+{
+    return d.isNull();
+}
+
+qint64 StagedImage::size() const
+{
+    return d.isNull() ? 0 : d->size;
+}
+
+/**
+ * @brief Returns the MD5 checksum of the image data
+ * @return Checksum, empty for a null image
+ */
+QByteArray StagedImage::checksum() const
+{
+    return d.isNull() ? QByteArray() : d->checksum;
+}
+
+/**
+ * @brief Returns the image data, a staged image is read from its file
+ * @return Image data
+ */
+QByteArray StagedImage::data() const
+{
+    if (d.isNull())
+        return QByteArray();
+    if (d->fileName.isEmpty())
+        return d->data;
+
+    QFile file(d->fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not read staged image" << d->fileName;
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+/**
+ * @brief Returns the file of a staged image
+ * @return File name or an empty string if the image is kept in memory
+ */
+QString StagedImage::stagedFileName() const
+{
+    return d.isNull() ? QString() : d->fileName;
+}
+
+/**
+ * @brief Two handles are equal if they share the same image
+ */
+bool StagedImage::operator==(const StagedImage &other) const
+{
+    return d == other.d;
+}
@@ -0,0 +1,36 @@
+#ifndef STAGEDIMAGE_H
+#define STAGEDIMAGE_H
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+
+/**
+ * @brief The StagedImage class
+ *        Handle of a downloaded image which has not been saved yet.
+ *        Small images stay in memory, larger ones are written to a staging directory in the temp folder
+ *        and only read again when they are shown or compared. Saving copies the staged file to its target.
+ *        Copies of a handle share the image, the staged file is removed together with the last handle.
+ *        The MD5 checksum of the image is kept, so a target which already has the image is not rewritten.
+ */
+class StagedImage
+{
+public:
+    StagedImage();
+    explicit StagedImage(const QByteArray &data);
+    static StagedImage fromStagedFile(QString fileName, QByteArray checksum = QByteArray());
+    static QString stagingDir();
+
+    bool isNull() const;
+    qint64 size() const;
+    QByteArray checksum() const;
+    QByteArray data() const;
+    QString stagedFileName() const;
+    bool operator==(const StagedImage &other) const;
+
+private:
+    class Private;
+    QSharedPointer<Private> d;
+};
+
+#endif // STAGEDIMAGE_H
@@ -95,21 +95,20 @@ void StreamDetails::loadStreamDetails()
     int audioCount = QString::fromStdWString(MI.Get(Stream_General, 0, QString("AudioCount").toStdWString())).toInt();
     int textCount = QString::fromStdWString(MI.Get(Stream_General, 0, QString("TextCount").toStdWString())).toInt();
 
-    if (m_files.count() > 1) {
-        foreach (const QString &file, m_files) {
-            MediaInfo MI_duration;
-            MI_duration.Option(QString("Info_Version").toStdWString(), QString("0.7.61;%1;%2").arg(QApplication::applicationName()).arg(QApplication::applicationVersion()).toStdWString());
-            MI_duration.Option(QString("Internet").toStdWString(), QString("no").toStdWString());
-        #ifdef Q_OS_WIN32
-            MI_duration.Open(file.toStdWString());
-        #else
-            MI_duration.Open(QString(file.toUtf8()).toStdWString());
-        #endif
-            MI_duration.Option(QString("Complete").toStdWString(), QString("1").toStdWString());
-            duration += qRound(QString::fromStdWString(MI.Get(Stream_General, 0, QString("Duration").toStdWString())).toFloat()/1000);
-        }
-    } else {
-        duration = qRound(QString::fromStdWString(MI.Get(Stream_General, 0, QString("Duration").toStdWString())).toFloat()/1000);
+    duration = qRound(QString::fromStdWString(MI.Get(Stream_General, 0, QString("Duration").toStdWString())).toFloat()/1000);
+
+    // The first part is already open, the other parts are only needed for their duration
+    for (int i=1, n=m_files.count() ; i<n ; ++i) {
+        MediaInfo MI_duration;
+        MI_duration.Option(QString("Info_Version").toStdWString(), QString("0.7.61;%1;%2").arg(QApplication::applicationName()).arg(QApplication::applicationVersion()).toStdWString());
+        MI_duration.Option(QString("Internet").toStdWString(), QString("no").toStdWString());
+    #ifdef Q_OS_WIN32
+        MI_duration.Open(m_files.at(i).toStdWString());
+    #else
+        MI_duration.Open(QString(m_files.at(i).toUtf8()).toStdWString());
+    #endif
+        duration += qRound(QString::fromStdWString(MI_duration.Get(Stream_General, 0, QString("Duration").toStdWString())).toFloat()/1000);
+        MI_duration.Close();
     }
 
     setVideoDetail("durationinseconds", QString("%1").arg(duration));
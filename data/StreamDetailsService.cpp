@@ -0,0 +1,211 @@
+#include "StreamDetailsService.h"
+
+#include <QDebug>
+#include <QDomDocument>
+#include <QFileInfo>
+#include <QFutureInterface>
+#include <QRunnable>
+#include <QThread>
+#include <QXmlStreamWriter>
+#include "globals/Manager.h"
+#include "mediaCenterPlugins/XbmcXml.h"
+
+/**
+ * @brief Runnable which probes one file (or one set of stacked files)
+ *        and reports the result to a future
+ */
+class StreamDetailsProbe : public QRunnable
+{
+public:
+    StreamDetailsProbe(QStringList files, QString (*probe)(const QStringList&)) :
+        m_files(files),
+        m_probe(probe)
+    {
+        m_futureInterface.reportStarted();
+    }
+
+    QFuture<QString> future()
+    {
+        return m_futureInterface.future();
+    }
+
+    void run()
+    {
+        QString content = m_probe(m_files);
+        m_futureInterface.reportResult(content);
+        m_futureInterface.reportFinished();
+    }
+
+private:
+    QStringList m_files;
+    QString (*m_probe)(const QStringList&);
+    QFutureInterface<QString> m_futureInterface;
+};
+
+/**
+ * @brief StreamDetailsService::StreamDetailsService
+ * @param parent
+ */
+StreamDetailsService::StreamDetailsService(QObject *parent) :
+    QObject(parent)
+{
+    // MediaInfo is mostly bound by I/O, more parallel probes only hurt on network shares
+    m_threadPool.setMaxThreadCount(qBound(2, QThread::idealThreadCount(), 4));
+}
+
+/**
+ * @brief StreamDetailsService::~StreamDetailsService
+ */
+StreamDetailsService::~StreamDetailsService()
+{
+    m_threadPool.waitForDone();
+}
+
+/**
+ * @brief Returns an instance of the stream details service
+ * @param parent Parent widget (used only the first time for constructing)
+ * @return Instance of StreamDetailsService
+ */
+StreamDetailsService *StreamDetailsService::instance(QObject *parent)
+{
+    static StreamDetailsService *m_instance = 0;
+    if (!m_instance)
+        m_instance = new StreamDetailsService(parent);
+    return m_instance;
+}
+
+/**
+ * @brief Loads stream details for the given files.
+ *        If the files are unchanged since the last probe the cached result is returned
+ *        immediately, otherwise a probe is queued on the worker pool.
+ *        Files which can't be stat'ed (e.g. on an offline share) are never served from or stored in the cache.
+ *        Calling this multiple times for the same files while a probe is running
+ *        returns the same future, so callers can queue probes ahead of time.
+ *        Must be called from the main thread.
+ * @param files Files of the movie, concert or episode
+ * @return Future containing the <streamdetails> xml, empty if no details could be loaded
+ */
+QFuture<QString> StreamDetailsService::load(const QStringList &files)
+{
+    if (files.isEmpty())
+        return finishedFuture("");
+
+    CacheKey key = cacheKey(files);
+    if (m_pending.contains(key.files))
+        return m_pending.value(key.files);
+
+    QString content;
+    if (key.valid && Manager::instance()->database()->cachedStreamDetails(key.files, key.size, key.lastModified, content))
+        return finishedFuture(content);
+
+    StreamDetailsProbe *probe = new StreamDetailsProbe(files, &StreamDetailsService::probe);
+    QFuture<QString> future = probe->future();
+    m_pending.insert(key.files, future);
+
+    QFutureWatcher<QString> *watcher = new QFutureWatcher<QString>(this);
+    m_watchers.insert(watcher, key);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onProbeFinished()));
+    watcher->setFuture(future);
+
+    m_threadPool.start(probe);
+    return future;
+}
+
+/**
+ * @brief Stores the result of a finished probe in the database
+ */
+void StreamDetailsService::onProbeFinished()
+{
+    QFutureWatcher<QString> *watcher = static_cast<QFutureWatcher<QString>*>(QObject::sender());
+    if (!watcher || !m_watchers.contains(watcher))
+        return;
+
+    CacheKey key = m_watchers.take(watcher);
+    m_pending.remove(key.files);
+    if (key.valid)
+        Manager::instance()->database()->setCachedStreamDetails(key.files, key.size, key.lastModified, watcher->result());
+    watcher->deleteLater();
+}
+
+/**
+ * @brief Fills a StreamDetails object from the xml returned by load
+ * @param streamDetails StreamDetails object
+ * @param content Result of a probe
+ * @return True if stream details were found
+ */
+bool StreamDetailsService::assign(StreamDetails *streamDetails, const QString &content)
+{
+    streamDetails->clear();
+    QDomDocument domDoc;
+    domDoc.setContent(content);
+    if (domDoc.elementsByTagName("streamdetails").isEmpty())
+        return false;
+    XbmcXml::loadStreamDetails(streamDetails, domDoc.elementsByTagName("streamdetails").at(0).toElement());
+    return true;
+}
+
+/**
+ * @brief Blocks until all queued probes have finished
+ */
+void StreamDetailsService::waitForDone()
+{
+    m_threadPool.waitForDone();
+}
+
+/**
+ * @brief Builds the cache key for a list of files
+ *        Stacked files are combined: sizes are summed up and the latest modification time is used.
+ *        The key is only valid if all files exist, are not empty and have a modification time.
+ * @param files List of files
+ * @return Cache key
+ */
+StreamDetailsService::CacheKey StreamDetailsService::cacheKey(const QStringList &files)
+{
+    CacheKey key;
+    key.files = files.join("\n");
+    key.size = 0;
+    key.valid = true;
+    foreach (const QString &file, files) {
+        QFileInfo fi(file);
+        if (!fi.isFile() || fi.size() <= 0 || !fi.lastModified().isValid())
+            key.valid = false;
+        key.size += fi.size();
+        if (key.lastModified.isNull() || fi.lastModified() > key.lastModified)
+            key.lastModified = fi.lastModified();
+    }
+    return key;
+}
+
+/**
+ * @brief Runs MediaInfo on the files. Called from the worker pool.
+ * @param files List of files
+ * @return <streamdetails> xml
+ */
+QString StreamDetailsService::probe(const QStringList &files)
+{
+    StreamDetails streamDetails(0, files);
+    streamDetails.loadStreamDetails();
+
+    QByteArray xmlContent;
+    QXmlStreamWriter xml(&xmlContent);
+    xml.writeStartDocument("1.0", true);
+    xml.writeStartElement("root");
+    XbmcXml::writeStreamDetails(xml, &streamDetails);
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    return QString::fromUtf8(xmlContent);
+}
+
+/**
+ * @brief Constructs an already finished future
+ * @param content Result of the future
+ * @return Finished future
+ */
+QFuture<QString> StreamDetailsService::finishedFuture(const QString &content)
+{
+    QFutureInterface<QString> futureInterface;
+    futureInterface.reportStarted();
+    futureInterface.reportResult(content);
+    futureInterface.reportFinished();
+    return futureInterface.future();
+}
@@ -0,0 +1,50 @@
+#ifndef STREAMDETAILSSERVICE_H
+#define STREAMDETAILSSERVICE_H
+
+#include <QDateTime>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QThreadPool>
+#include "data/StreamDetails.h"
+
+/**
+ * @brief The StreamDetailsService class
+ *        Runs MediaInfo probes on a bounded worker pool and caches the results
+ *        in the database, keyed by files, size and last modification time.
+ *        Results are handed out as futures containing the <streamdetails> xml.
+ */
+class StreamDetailsService : public QObject
+{
+    Q_OBJECT
+public:
+    explicit StreamDetailsService(QObject *parent = 0);
+    ~StreamDetailsService();
+    static StreamDetailsService *instance(QObject *parent = 0);
+    QFuture<QString> load(const QStringList &files);
+    bool assign(StreamDetails *streamDetails, const QString &content);
+    void waitForDone();
+
+private slots:
+    void onProbeFinished();
+
+private:
+    struct CacheKey {
+        QString files;
+        qint64 size;
+        QDateTime lastModified;
+        bool valid;
+    };
+
+    static CacheKey cacheKey(const QStringList &files);
+    static QString probe(const QStringList &files);
+    static QFuture<QString> finishedFuture(const QString &content);
+
+    QThreadPool m_threadPool;
+    QHash<QString, QFuture<QString> > m_pending;
+    QHash<QFutureWatcher<QString>*, CacheKey> m_watchers;
+};
+
+#endif // STREAMDETAILSSERVICE_H
@@ -4,10 +4,12 @@
 #include <QApplication>
 #include <QDebug>
 #include <QDir>
+#include <QSet>
 #include "globals/Globals.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/NameFormatter.h"
+#include "globals/Tracer.h"
 
 /**
  * @brief TvShow::TvShow
@@ -18,6 +20,7 @@ TvShow::TvShow(QString dir, QObject *parent) :
     QObject(parent)
 {
     m_dir = dir;
+    m_episodeIndexValid = false;
     m_infoLoaded = false;
     m_infoFromNfoLoaded = false;
     m_hasChanged = false;
@@ -68,7 +71,7 @@ void TvShow::clear(QList<int> infos)
     if (infos.contains(TvShowScraperInfos::Banner)) {
         m_banners.clear();
         m_imagesToRemove.remove(ImageType::TvShowBanner);
-        m_images.insert(ImageType::TvShowBanner, QByteArray());
+        m_images.insert(ImageType::TvShowBanner, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowBanner, false);
     }
     if (infos.contains(TvShowScraperInfos::Certification))
@@ -84,7 +87,7 @@ void TvShow::clear(QList<int> infos)
     if (infos.contains(TvShowScraperInfos::Poster)) {
         m_posters.clear();
         m_imagesToRemove.remove(ImageType::TvShowPoster);
-        m_images.insert(ImageType::TvShowPoster, QByteArray());
+        m_images.insert(ImageType::TvShowPoster, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowPoster, false);
     }
     if (infos.contains(TvShowScraperInfos::Rating))
@@ -116,17 +119,17 @@ void TvShow::clear(QList<int> infos)
     if (infos.contains(TvShowScraperInfos::Fanart)) {
         m_backdrops.clear();
         m_imagesToRemove.remove(ImageType::TvShowBackdrop);
-        m_images.insert(ImageType::TvShowBackdrop, QByteArray());
+        m_images.insert(ImageType::TvShowBackdrop, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowBackdrop, false);
     }
     if (infos.contains(TvShowScraperInfos::ExtraArts)) {
-        m_images.insert(ImageType::TvShowLogos, QByteArray());
+        m_images.insert(ImageType::TvShowLogos, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowLogos, false);
-        m_images.insert(ImageType::TvShowThumb, QByteArray());
+        m_images.insert(ImageType::TvShowThumb, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowThumb, false);
-        m_images.insert(ImageType::TvShowClearArt, QByteArray());
+        m_images.insert(ImageType::TvShowClearArt, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowClearArt, false);
-        m_images.insert(ImageType::TvShowCharacterArt, QByteArray());
+        m_images.insert(ImageType::TvShowCharacterArt, StagedImage());
         m_hasImageChanged.insert(ImageType::TvShowCharacterArt, false);
         m_imagesToRemove.remove(ImageType::TvShowLogos);
         m_imagesToRemove.remove(ImageType::TvShowClearArt);
@@ -148,7 +151,7 @@ void TvShow::clearSeasonImageType(int imageType)
     QMapIterator<int, QMap<int, QByteArray> > it(m_seasonImages);
     while (it.hasNext()) {
         it.next();
-        m_seasonImages[it.key()].insert(imageType, QByteArray());
+        m_seasonImages[it.key()].insert(imageType, StagedImage());
     }
     QMapIterator<int, QMap<int, bool> > itC(m_hasSeasonImageChanged);
     while (itC.hasNext()) {
@@ -165,6 +168,9 @@ void TvShow::clearSeasonImageType(int imageType)
 void TvShow::addEpisode(TvShowEpisode *episode)
 {
     m_episodes.append(episode);
+    QPair<int, int> number(episode->season(), episode->episode());
+    if (m_episodeIndexValid && !m_episodeIndex.contains(number))
+        m_episodeIndex.insert(number, episode);
 }
 
 /**
@@ -202,8 +208,9 @@ bool TvShow::loadData(MediaCenterInterface *mediaCenterInterface, bool reloadFro
     setChanged(false);
 
     m_hasImage.clear();
+    QList<int> existingTypes = mediaCenterInterface->existingImageTypes(this);
     foreach (const int &imageType, TvShow::imageTypes())
-        m_hasImage.insert(imageType, !mediaCenterInterface->imageFileName(this, imageType).isEmpty());
+        m_hasImage.insert(imageType, existingTypes.contains(imageType));
     m_hasImage.insert(ImageType::TvShowExtraFanart, !mediaCenterInterface->extraFanartNames(this).isEmpty());
 
     return infoLoaded;
@@ -231,14 +238,26 @@ bool TvShow::saveData(MediaCenterInterface *mediaCenterInterface)
 {
     qDebug() << "Entered";
     bool saved = mediaCenterInterface->saveTvShow(this);
+    setSaved(saved);
+    return saved;
+}
+
+/**
+ * @brief Marks the show as saved, clears its changed state and the staged images.
+ *        A BatchSaver calls this only after all files of the show were written.
+ * @param saved The nfo file was saved
+ */
+void TvShow::setSaved(bool saved)
+{
     if (!m_infoLoaded)
         m_infoLoaded = saved;
+    if (saved)
+        m_infoFromNfoLoaded = true;
 
     setChanged(false);
     setSyncNeeded(true);
     clearImages();
     clearExtraFanartData();
-    return saved;
 }
 
 /**
@@ -597,18 +616,32 @@ QList<Poster> TvShow::seasonThumbs(int season, bool returnAll) const
 }
 
 /**
- * @brief TvShow::episode
+ * @brief Returns the episode with the given season and episode number
+ *        Episodes are looked up in an index which is rebuilt after episodes were removed or renumbered
  * @param season
  * @param episode
- * @return Episode object
+ * @return Episode object or 0 if the show has no such episode
  */
 TvShowEpisode *TvShow::episode(int season, int episode)
 {
-    for (int i=0, n=m_episodes.count() ; i<n ; ++i) {
-        if (m_episodes[i]->season() == season && m_episodes[i]->episode() == episode)
-            return m_episodes[i];
+    if (!m_episodeIndexValid) {
+        m_episodeIndex.clear();
+        foreach (TvShowEpisode *showEpisode, m_episodes) {
+            QPair<int, int> number(showEpisode->season(), showEpisode->episode());
+            if (!m_episodeIndex.contains(number))
+                m_episodeIndex.insert(number, showEpisode);
+        }
+        m_episodeIndexValid = true;
     }
-    return new TvShowEpisode(QStringList(), this);
+    return m_episodeIndex.value(QPair<int, int>(season, episode), 0);
+}
+
+/**
+ * @brief Has to be called when the season or episode number of a child episode changes
+ */
+void TvShow::invalidateEpisodeIndex()
+{
+    m_episodeIndexValid = false;
 }
 
 /**
@@ -1121,6 +1154,11 @@ void TvShow::setSyncNeeded(bool syncNeeded)
 }
 
 void TvShow::addExtraFanart(QByteArray fanart)
+{
+    addExtraFanart(StagedImage(fanart));
+}
+
+void TvShow::addExtraFanart(StagedImage fanart)
 {
     m_extraFanartImagesToAdd.append(fanart);
     setChanged(true);
@@ -1128,7 +1166,13 @@ void TvShow::addExtraFanart(QByteArray fanart)
 
 void TvShow::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i=0, n=m_extraFanartImagesToAdd.count() ; i<n ; ++i) {
+        const StagedImage &image = m_extraFanartImagesToAdd.at(i);
+        if (image.size() == fanart.size() && image.data() == fanart) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setChanged(true);
 }
 
@@ -1151,9 +1195,9 @@ QList<ExtraFanart> TvShow::extraFanarts(MediaCenterInterface *mediaCenterInterfa
         f.path = file;
         fanarts.append(f);
     }
-    foreach (const QByteArray &img, m_extraFanartImagesToAdd) {
+    foreach (const StagedImage &img, m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -1164,7 +1208,7 @@ QStringList TvShow::extraFanartsToRemove()
     return m_extraFanartsToRemove;
 }
 
-QList<QByteArray> TvShow::extraFanartImagesToAdd()
+QList<StagedImage> TvShow::extraFanartImagesToAdd()
 {
     return m_extraFanartImagesToAdd;
 }
@@ -1184,8 +1228,8 @@ QMap<int, QList<int> > TvShow::imagesToRemove() const
 void TvShow::removeImage(int type, int season)
 {
     if (TvShow::seasonImageTypes().contains(type)) {
-        if (m_seasonImages.contains(season) && !m_seasonImages.value(season).value(type, QByteArray()).isNull()) {
-            m_seasonImages[season].insert(type, QByteArray());
+        if (m_seasonImages.contains(season) && !m_seasonImages.value(season).value(type).isNull()) {
+            m_seasonImages[season].insert(type, StagedImage());
             if (!m_hasSeasonImageChanged.contains(season))
                 m_hasSeasonImageChanged.insert(season, QMap<int, bool>());
             m_hasSeasonImageChanged[season].insert(type, false);
@@ -1195,8 +1239,8 @@ void TvShow::removeImage(int type, int season)
             m_imagesToRemove[type].append(season);
         }
     } else {
-        if (!m_images.value(type, QByteArray()).isNull()) {
-            m_images.insert(type, QByteArray());
+        if (!m_images.value(type).isNull()) {
+            m_images.insert(type, StagedImage());
             m_hasImageChanged.insert(type, false);
         } else {
             m_imagesToRemove.insert(type, QList<int>() << -2);
@@ -1222,6 +1266,16 @@ bool TvShow::lessThan(TvShow *a, TvShow *b)
 }
 
 QByteArray TvShow::image(int imageType)
+{
+    return m_images.value(imageType).data();
+}
+
+/**
+ * @brief Returns the image without reading a staged image into memory
+ * @param imageType Type of the image
+ * @return Image handle, null if there is no new image
+ */
+StagedImage TvShow::stagedImage(int imageType)
 {
     return m_images.value(imageType);
 }
@@ -1229,11 +1283,21 @@ QByteArray TvShow::image(int imageType)
 QByteArray TvShow::seasonImage(int season, int imageType)
 {
     if (m_seasonImages.contains(season))
-        return m_seasonImages.value(season).value(imageType, QByteArray());
+        return m_seasonImages.value(season).value(imageType).data();
     return QByteArray();
 }
 
+StagedImage TvShow::stagedSeasonImage(int season, int imageType)
+{
+    return m_seasonImages.value(season).value(imageType);
+}
+
 void TvShow::setImage(int imageType, QByteArray image)
+{
+    setImage(imageType, StagedImage(image));
+}
+
+void TvShow::setImage(int imageType, StagedImage image)
 {
     m_images.insert(imageType, image);
     m_hasImageChanged.insert(imageType, true);
@@ -1241,9 +1305,14 @@ void TvShow::setImage(int imageType, QByteArray image)
 }
 
 void TvShow::setSeasonImage(int season, int imageType, QByteArray image)
+{
+    setSeasonImage(season, imageType, StagedImage(image));
+}
+
+void TvShow::setSeasonImage(int season, int imageType, StagedImage image)
 {
     if (!m_seasonImages.contains(season))
-        m_seasonImages.insert(season, QMap<int, QByteArray>());
+        m_seasonImages.insert(season, QMap<int, StagedImage>());
     m_seasonImages[season].insert(imageType, image);
 
     if (!m_hasSeasonImageChanged.contains(season))
@@ -1283,6 +1352,11 @@ bool TvShow::hasImage(int type)
     return m_hasImage.value(type, false);
 }
 
+void TvShow::setHasImage(int type, bool has)
+{
+    m_hasImage.insert(type, has);
+}
+
 int TvShow::runtime() const
 {
     return m_runtime;
@@ -1358,16 +1432,14 @@ bool TvShow::hideSpecialsInMissingEpisodes() const
 
 void TvShow::fillMissingEpisodes()
 {
+    ScopedTrace trace("TvShow::fillMissingEpisodes");
     QList<TvShowEpisode*> episodes = Manager::instance()->database()->showsEpisodes(this);
+    QSet<int> seasons;
+    foreach (TvShowEpisode *episode, m_episodes)
+        seasons.insert(episode->season());
+
     foreach (TvShowEpisode *episode, episodes) {
-        bool found = false;
-        for (int i=0, n=m_episodes.count() ; i<n ; ++i) {
-            if (m_episodes[i]->season() == episode->season() && m_episodes[i]->episode() == episode->episode()) {
-                found = true;
-                break;
-            }
-        }
-        if (found) {
+        if (this->episode(episode->season(), episode->episode())) {
             episode->deleteLater();
             continue;
         }
@@ -1382,15 +1454,8 @@ void TvShow::fillMissingEpisodes()
         episode->setInfosLoaded(true);
         addEpisode(episode);
 
-        bool newSeason = true;
-        foreach (TvShowEpisode *existEpisode, this->episodes()) {
-            if (existEpisode->season() == episode->season() && existEpisode != episode) {
-                newSeason = false;
-                break;
-            }
-        }
-
-        if (newSeason) {
+        if (!seasons.contains(episode->season())) {
+            seasons.insert(episode->season());
             modelItem()->appendChild(episode->season(), episode->seasonString(), this)->appendChild(episode);
         } else {
             for (int i=0, n=modelItem()->childCount() ; i<n ; ++i) {
@@ -1420,6 +1485,7 @@ void TvShow::clearMissingEpisodes()
             if (item->tvShowEpisode()->isDummy()) {
                 seasonItem->removeChildren(x, 1);
                 m_episodes.removeOne(item->tvShowEpisode());
+                m_episodeIndexValid = false;
                 item->tvShowEpisode()->deleteLater();
                 x--;
             } else {
@@ -1,10 +1,13 @@
 #ifndef TVSHOW_H
 #define TVSHOW_H
 
+#include <QHash>
 #include <QMetaType>
 #include <QObject>
+#include <QPair>
 #include <QStringList>
 #include "data/MediaCenterInterface.h"
+#include "data/StagedImage.h"
 #include "data/TvScraperInterface.h"
 #include "data/TvShowEpisode.h"
 #include "globals/Globals.h"
@@ -56,6 +59,7 @@ public:
     QList<Poster> seasonBanners(int season, bool returnAll = false) const;
     QList<Poster> seasonThumbs(int season, bool returnAll = false) const;
     TvShowEpisode *episode(int season, int episode);
+    void invalidateEpisodeIndex();
     QList<int> seasons(bool includeDummies = true);
     QList<TvShowEpisode*> episodes();
     QList<TvShowEpisode*> episodes(int season);
@@ -128,6 +132,7 @@ public:
     bool loadData(MediaCenterInterface *mediaCenterInterface, bool reloadFromNfo = true);
     void loadData(QString id, TvScraperInterface *tvScraperInterface, TvShowUpdateType type, QList<int> infosToLoad);
     bool saveData(MediaCenterInterface *mediaCenterInterface);
+    void setSaved(bool saved);
     void clearImages();
     void fillMissingEpisodes();
     void clearMissingEpisodes();
@@ -136,18 +141,24 @@ public:
     void removeImage(int type, int season = -2);
     QMap<int, QList<int> > imagesToRemove() const;
     QByteArray image(int imageType);
+    StagedImage stagedImage(int imageType);
     QByteArray seasonImage(int season, int imageType);
+    StagedImage stagedSeasonImage(int season, int imageType);
     void setImage(int imageType, QByteArray image);
+    void setImage(int imageType, StagedImage image);
     void setSeasonImage(int season, int imageType, QByteArray image);
+    void setSeasonImage(int season, int imageType, StagedImage image);
     bool imageHasChanged(int imageType) const;
     bool seasonImageHasChanged(int season, int imageType) const;
     bool hasImage(int type);
+    void setHasImage(int type, bool has);
 
     // Extra Fanarts
     QList<ExtraFanart> extraFanarts(MediaCenterInterface *mediaCenterInterface);
     QStringList extraFanartsToRemove();
-    QList<QByteArray> extraFanartImagesToAdd();
+    QList<StagedImage> extraFanartImagesToAdd();
     void addExtraFanart(QByteArray fanart);
+    void addExtraFanart(StagedImage fanart);
     void removeExtraFanart(QByteArray fanart);
     void removeExtraFanart(QString file);
     void clearExtraFanartData();
@@ -164,6 +175,8 @@ signals:
 
 private:
     QList<TvShowEpisode*> m_episodes;
+    QHash<QPair<int, int>, TvShowEpisode*> m_episodeIndex;
+    bool m_episodeIndexValid;
     QString m_dir;
     QString m_name;
     QString m_showTitle;
@@ -200,7 +213,7 @@ private:
     int m_databaseId;
     bool m_syncNeeded;
     QList<int> m_infosToLoad;
-    QList<QByteArray> m_extraFanartImagesToAdd;
+    QList<StagedImage> m_extraFanartImagesToAdd;
     QStringList m_extraFanartsToRemove;
     QStringList m_extraFanarts;
     QMap<int, QList<int> > m_imagesToRemove;
@@ -208,8 +221,8 @@ private:
     bool m_showMissingEpisodes;
     bool m_hideSpecialsInMissingEpisodes;
 
-    QMap<int, QByteArray> m_images;
-    QMap<int, QMap<int, QByteArray> > m_seasonImages;
+    QMap<int, StagedImage> m_images;
+    QMap<int, QMap<int, StagedImage> > m_seasonImages;
     QMap<int, bool> m_hasImageChanged;
     QMap<int, QMap<int, bool> > m_hasSeasonImageChanged;
 
@@ -3,9 +3,12 @@
 #include <QApplication>
 #include <QDir>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QTime>
+#include "data/StreamDetailsService.h"
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "globals/Logger.h"
 #include "settings/Settings.h"
 
 /**
@@ -152,17 +155,62 @@ bool TvShowEpisode::loadData(MediaCenterInterface *mediaCenterInterface, bool re
  */
 void TvShowEpisode::loadData(QString id, TvScraperInterface *tvScraperInterface, QList<int> infosToLoad)
 {
-    qDebug() << "Entered, id=" << id << "scraperInterface=" << tvScraperInterface->name();
+    LOG_DEBUG() << "Entered, id=" << id << "scraperInterface=" << tvScraperInterface->name();
     m_infosToLoad = infosToLoad;
     tvScraperInterface->loadTvShowEpisodeData(id, this, infosToLoad);
 }
 
 /**
  * @brief Tries to load streamdetails from the file
+ *        Unchanged files are served from the cache, otherwise this blocks until the probe has finished.
+ *        Interactive code should use loadStreamDetailsInBackground instead.
+ * @see StreamDetailsService::load
  */
 void TvShowEpisode::loadStreamDetailsFromFile()
 {
-    m_streamDetails->loadStreamDetails();
+    setStreamDetails(StreamDetailsService::instance()->load(files()).result());
+}
+
+/**
+ * @brief Loads streamdetails from the file without blocking
+ *        Cached results are applied immediately, otherwise they are applied
+ *        when the probe has finished and sigStreamDetailsLoaded is emitted.
+ * @see StreamDetailsService::load
+ */
+void TvShowEpisode::loadStreamDetailsInBackground()
+{
+    QFuture<QString> future = StreamDetailsService::instance()->load(files());
+    if (future.isFinished()) {
+        setStreamDetails(future.result());
+        return;
+    }
+
+    QFutureWatcher<QString> *watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onStreamDetailsLoaded()));
+    watcher->setFuture(future);
+}
+
+/**
+ * @brief Applies the result of a background probe
+ *        Streamdetails which were loaded in the meantime (e.g. while saving) are kept.
+ */
+void TvShowEpisode::onStreamDetailsLoaded()
+{
+    QFutureWatcher<QString> *watcher = static_cast<QFutureWatcher<QString>*>(QObject::sender());
+    watcher->deleteLater();
+    if (streamDetailsLoaded())
+        return;
+    setStreamDetails(watcher->result());
+    emit sigStreamDetailsLoaded(this);
+}
+
+/**
+ * @brief Assigns the result of a probe to the episode
+ * @param content <streamdetails> xml
+ */
+void TvShowEpisode::setStreamDetails(const QString &content)
+{
+    StreamDetailsService::instance()->assign(m_streamDetails, content);
     setStreamDetailsLoaded(true);
     setChanged(true);
 }
@@ -182,17 +230,27 @@ void TvShowEpisode::scraperLoadDone()
  */
 bool TvShowEpisode::saveData(MediaCenterInterface *mediaCenterInterface)
 {
-    qDebug() << "Entered";
+    LOG_DEBUG() << "Entered";
     if (!streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails())
         loadStreamDetailsFromFile();
     bool saved = mediaCenterInterface->saveTvShowEpisode(this);
-    qDebug() << "Saved" << saved;
+    LOG_DEBUG() << "Saved" << saved;
+    setSaved(saved);
+    return saved;
+}
+
+/**
+ * @brief Marks the episode as saved, clears its changed state and the staged thumbnail.
+ *        A BatchSaver calls this only after all files of the episode were written.
+ * @param saved The nfo file was saved
+ */
+void TvShowEpisode::setSaved(bool saved)
+{
     if (!m_infoLoaded)
         m_infoLoaded = saved;
     setChanged(false);
     setSyncNeeded(true);
     clearImages();
-    return saved;
 }
 
 /**
@@ -218,7 +276,7 @@ bool TvShowEpisode::isValid() const
  */
 void TvShowEpisode::clearImages()
 {
-    m_thumbnailImage = QByteArray();
+    m_thumbnailImage = StagedImage();
 }
 
 /*** GETTER ***/
@@ -469,6 +527,11 @@ QUrl TvShowEpisode::thumbnail() const
  * @return Image of the thumbnail
  */
 QByteArray TvShowEpisode::thumbnailImage()
+{
+    return m_thumbnailImage.data();
+}
+
+StagedImage TvShowEpisode::stagedThumbnailImage()
 {
     return m_thumbnailImage;
 }
@@ -623,6 +686,8 @@ void TvShowEpisode::setRating(qreal rating)
 void TvShowEpisode::setSeason(int season)
 {
     m_season = season;
+    if (m_parent)
+        m_parent->invalidateEpisodeIndex();
     setChanged(true);
 }
 
@@ -634,6 +699,8 @@ void TvShowEpisode::setSeason(int season)
 void TvShowEpisode::setEpisode(int episode)
 {
     m_episode = episode;
+    if (m_parent)
+        m_parent->invalidateEpisodeIndex();
     setChanged(true);
 }
 
@@ -791,6 +858,11 @@ void TvShowEpisode::setThumbnail(QUrl url)
  * @param thumbnail
  */
 void TvShowEpisode::setThumbnailImage(QByteArray thumbnail)
+{
+    setThumbnailImage(StagedImage(thumbnail));
+}
+
+void TvShowEpisode::setThumbnailImage(StagedImage thumbnail)
 {
     m_thumbnailImage = thumbnail;
     m_thumbnailImageChanged = true;
@@ -902,7 +974,7 @@ void TvShowEpisode::removeImage(int type)
     switch (type) {
     case ImageType::TvShowEpisodeThumb:
         if (!m_thumbnailImage.isNull()) {
-            m_thumbnailImage = QByteArray();
+            m_thumbnailImage = StagedImage();
             m_thumbnailImageChanged = false;
         } else if (!m_imagesToRemove.contains(type)) {
             m_imagesToRemove.append(type);
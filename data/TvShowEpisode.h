@@ -5,6 +5,7 @@
 #include <QObject>
 #include <QStringList>
 #include "data/MediaCenterInterface.h"
+#include "data/StagedImage.h"
 #include "data/StreamDetails.h"
 #include "data/TvScraperInterface.h"
 #include "data/TvShow.h"
@@ -67,6 +68,7 @@ public:
     bool isValid() const;
     QUrl thumbnail() const;
     QByteArray thumbnailImage();
+    StagedImage stagedThumbnailImage();
     bool thumbnailImageChanged() const;
     TvShowModelItem *modelItem();
     bool hasChanged() const;
@@ -101,6 +103,7 @@ public:
     void setNetwork(QString network);
     void setThumbnail(QUrl url);
     void setThumbnailImage(QByteArray thumbnail);
+    void setThumbnailImage(StagedImage thumbnail);
     void setEpBookmark(QTime epBookmark);
     void setInfosLoaded(bool loaded);
     void setChanged(bool changed);
@@ -122,7 +125,9 @@ public:
     bool loadData(MediaCenterInterface *mediaCenterInterface, bool reloadFromNfo = true);
     void loadData(QString id, TvScraperInterface *tvScraperInterface, QList<int> infosToLoad);
     bool saveData(MediaCenterInterface *mediaCenterInterface);
+    void setSaved(bool saved);
     void loadStreamDetailsFromFile();
+    void loadStreamDetailsInBackground();
     void clearImages();
     QList<int> infosToLoad();
 
@@ -136,8 +141,14 @@ public:
 signals:
     void sigLoaded();
     void sigChanged(TvShowEpisode*);
+    void sigStreamDetailsLoaded(TvShowEpisode*);
+
+private slots:
+    void onStreamDetailsLoaded();
 
 private:
+    void setStreamDetails(const QString &content);
+
     QStringList m_files;
     TvShow *m_parent;
     QString m_name;
@@ -157,7 +168,7 @@ private:
     QString m_certification;
     QString m_network;
     QUrl m_thumbnail;
-    QByteArray m_thumbnailImage;
+    StagedImage m_thumbnailImage;
     TvShowModelItem *m_modelItem;
     bool m_thumbnailImageChanged;
     bool m_infoLoaded;
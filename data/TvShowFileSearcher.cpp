@@ -8,6 +8,7 @@
 #include <QtConcurrent/QtConcurrentMap>
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "globals/Tracer.h"
 #include "data/TvShow.h"
 #include "data/TvShowEpisode.h"
 #include "data/TvShowModelItem.h"
@@ -44,10 +45,13 @@ void TvShowFileSearcher::setMovieDirectories(QList<SettingsDir> directories)
  */
 void TvShowFileSearcher::reload(bool force)
 {
+    ScopedTrace trace("TvShowFileSearcher::reload");
     m_aborted = false;
 
-    if (force)
+    if (force) {
+        clearCachedTvShows();
         Manager::instance()->database()->clearTvShows();
+    }
 
     emit searchStarted(tr("Searching for TV Shows..."), m_progressMessageId);
     QList<TvShow*> dbShows;
@@ -58,7 +62,8 @@ void TvShowFileSearcher::reload(bool force)
         if (m_aborted)
             return;
 
-        QList<TvShow*> showsFromDatabase = Manager::instance()->database()->shows(dir.path);
+        bool preloaded = !dir.autoReload && !force && m_cachedShows.contains(dir.path);
+        QList<TvShow*> showsFromDatabase = preloaded ? m_cachedShows.take(dir.path) : Manager::instance()->database()->shows(dir.path);
         if (dir.autoReload || force || showsFromDatabase.count() == 0) {
             Manager::instance()->database()->clearTvShows(dir.path);
             getTvShows(dir.path, contents);
@@ -66,6 +71,7 @@ void TvShowFileSearcher::reload(bool force)
             dbShows.append(showsFromDatabase);
         }
     }
+    clearCachedTvShows();
     emit currentDir("");
 
     emit searchStarted(tr("Loading TV Shows..."), m_progressMessageId);
@@ -143,13 +149,19 @@ void TvShowFileSearcher::reload(bool force)
         if (m_aborted)
             return;
 
-        show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
+        // Preloaded shows and their episodes are already parsed
+        QList<TvShowEpisode*> episodes;
+        if (m_cachedEpisodes.contains(show)) {
+            episodes = m_cachedEpisodes.take(show);
+        } else {
+            show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
+            episodes = Manager::instance()->database()->episodes(show->databaseId());
+            QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::loadEpisodeData);
+        }
         emit currentDir(show->name());
         TvShowModelItem *showItem = Manager::instance()->tvShowModel()->appendChild(show);
 
         QMap<int, TvShowModelItem*> seasonItems;
-        QList<TvShowEpisode*> episodes = Manager::instance()->database()->episodes(show->databaseId());
-        QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::loadEpisodeData);
         foreach (TvShowEpisode *episode, episodes) {
             episode->setShow(show);
             show->addEpisode(episode);
@@ -165,6 +177,8 @@ void TvShowFileSearcher::reload(bool force)
             show->fillMissingEpisodes();
     }
 
+    m_cachedEpisodes.clear();
+
     qDebug() << "Searching for tv shows done";
     if (!m_aborted)
         emit tvShowsLoaded(m_progressMessageId);
@@ -374,6 +388,43 @@ QStringList TvShowFileSearcher::getFiles(QString path)
 void TvShowFileSearcher::abort()
 {
     m_aborted = true;
+    clearCachedTvShows();
+    m_cachedEpisodes.clear();
+}
+
+/**
+ * @brief Sets tv shows which were already loaded from the database and parsed in another thread.
+ *        They are used instead of querying the database by the next reload.
+ * @param shows Shows by path of their directory, they have to live in the thread of the searcher
+ * @param episodes Episodes of the shows, they are already children of their show
+ */
+void TvShowFileSearcher::setCachedTvShows(QMap<QString, QList<TvShow*> > shows, QHash<TvShow*, QList<TvShowEpisode*> > episodes)
+{
+    clearCachedTvShows();
+    QMapIterator<QString, QList<TvShow*> > it(shows);
+    while (it.hasNext()) {
+        it.next();
+        foreach (TvShow *show, it.value())
+            show->setParent(this);
+    }
+    m_cachedShows = shows;
+    m_cachedEpisodes = episodes;
+}
+
+/**
+ * @brief Deletes all preloaded shows which were not used, episodes are deleted with their show
+ */
+void TvShowFileSearcher::clearCachedTvShows()
+{
+    QMapIterator<QString, QList<TvShow*> > it(m_cachedShows);
+    while (it.hasNext()) {
+        it.next();
+        foreach (TvShow *show, it.value()) {
+            m_cachedEpisodes.remove(show);
+            delete show;
+        }
+    }
+    m_cachedShows.clear();
 }
 
 int TvShowFileSearcher::getSeasonNumber(QStringList files)
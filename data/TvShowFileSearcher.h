@@ -2,6 +2,7 @@
 #define TVSHOWFILESEARCHER_H
 
 #include <QDir>
+#include <QHash>
 #include <QObject>
 #include "data/TvShowEpisode.h"
 #include "globals/Globals.h"
@@ -19,6 +20,7 @@ public:
     static QList<int> getEpisodeNumbers(QStringList files);
     static TvShowEpisode *loadEpisodeData(TvShowEpisode *episode);
     static TvShowEpisode *reloadEpisodeData(TvShowEpisode *episode);
+    void setCachedTvShows(QMap<QString, QList<TvShow*> > shows, QHash<TvShow*, QList<TvShowEpisode*> > episodes);
 
 public slots:
     void reload(bool force);
@@ -38,6 +40,9 @@ private:
     void scanTvShowDir(QString startPath, QString path, QList<QStringList> &contents);
     QStringList getFiles(QString path);
     bool m_aborted;
+    QMap<QString, QList<TvShow*> > m_cachedShows;
+    QHash<TvShow*, QList<TvShowEpisode*> > m_cachedEpisodes;
+    void clearCachedTvShows();
 };
 
 #endif // TVSHOWFILESEARCHER_H
@@ -422,7 +422,7 @@ void ImportDialog::onEpisodeDownloadFinished(DownloadManagerElement elem)
         return;
 
     ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(elem.episode, ImageType::TvShowEpisodeThumb));
-    elem.episode->setThumbnailImage(elem.data);
+    elem.episode->setThumbnailImage(elem.image);
     ui->loading->setVisible(false);
     ui->badgeSuccess->setText(tr("Episode information was loaded"));
     ui->badgeSuccess->setVisible(true);
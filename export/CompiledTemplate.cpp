@@ -0,0 +1,279 @@
+#include "CompiledTemplate.h"
+
+/**
+ * @brief Compiles the template content
+ * @param content Content of a template file
+ */
+CompiledTemplate::CompiledTemplate(const QString &content)
+{
+    m_nodes = compile(content);
+}
+
+/**
+ * @brief Renders the template
+ * @param context Values for variables, images and blocks
+ * @param subDir Images are referenced from a page in a subdirectory
+ * @return Rendered content
+ */
+QString CompiledTemplate::render(const Context &context, bool subDir) const
+{
+    QString result;
+    QList<const Context*> scopes;
+    scopes.append(&context);
+    render(m_nodes, scopes, subDir, result);
+    return result;
+}
+
+/**
+ * @brief Returns the content of the first block with the given name as a template on its own
+ * @param name Name of the block, e.g. "MOVIE" for {{ BEGIN_BLOCK_MOVIE }}
+ * @return Template of the block content, empty if there is no such block
+ */
+CompiledTemplate CompiledTemplate::block(const QString &name) const
+{
+    CompiledTemplate blockTemplate;
+    findBlock(m_nodes, name, blockTemplate.m_nodes);
+    return blockTemplate;
+}
+
+/**
+ * @brief Returns all images used in the template (including nested blocks)
+ * @return List of image types and sizes, every combination only once
+ */
+QList<CompiledTemplate::Image> CompiledTemplate::images() const
+{
+    QList<Image> images;
+    QStringList keys;
+    collectImages(m_nodes, images, keys);
+    return images;
+}
+
+/**
+ * @brief Key of an image in Context::images
+ * @param type Image type (lower case)
+ * @param size Image size
+ * @return Key
+ */
+QString CompiledTemplate::imageKey(const QString &type, const QSize &size)
+{
+    return QString("%1[%2,%3]").arg(type).arg(size.width()).arg(size.height());
+}
+
+/**
+ * @brief Builds block items which only contain one variable, e.g. TAG.NAME for each tag
+ * @param variable Name of the variable
+ * @param values One value per block item
+ * @return List of contexts
+ */
+QList<CompiledTemplate::Context> CompiledTemplate::listContexts(const QString &variable, const QStringList &values)
+{
+    QList<Context> contexts;
+    foreach (const QString &value, values) {
+        Context context;
+        context.variables.insert(variable, value);
+        contexts.append(context);
+    }
+    return contexts;
+}
+
+/**
+ * @brief Splits the content into nodes. Block contents are compiled recursively.
+ * @param content Template content
+ * @return List of nodes
+ */
+QList<CompiledTemplate::Node> CompiledTemplate::compile(const QString &content)
+{
+    QList<Node> nodes;
+    int pos = 0;
+    while (pos < content.length()) {
+        int start = content.indexOf("{{ ", pos);
+        if (start == -1)
+            break;
+        int end = content.indexOf(" }}", start + 3);
+        if (end == -1)
+            break;
+        int inner = content.lastIndexOf("{{ ", end);
+        if (inner > start)
+            start = inner;
+
+        QString tag = content.mid(start + 3, end - start - 3);
+        int tagEnd = end + 3;
+        appendText(nodes, content.mid(pos, start - pos));
+        pos = tagEnd;
+
+        if (tag.startsWith("BEGIN_BLOCK_")) {
+            QString name = tag.mid(12);
+            QString endTag = "{{ END_BLOCK_" + name + " }}";
+            int blockEnd = content.indexOf(endTag, tagEnd);
+            if (blockEnd == -1) {
+                appendText(nodes, content.mid(start, tagEnd - start));
+                continue;
+            }
+            Node node;
+            node.type = NodeBlock;
+            node.text = name;
+            node.children = compile(content.mid(tagEnd, blockEnd - tagEnd).trimmed());
+            nodes.append(node);
+            pos = blockEnd + endTag.length();
+            continue;
+        }
+
+        if (tag.startsWith("IMAGE.") && tag.endsWith("]")) {
+            int bracket = tag.lastIndexOf("[");
+            QStringList dimensions = tag.mid(bracket + 1, tag.length() - bracket - 2).split(",");
+            if (bracket > 6 && dimensions.count() == 2) {
+                QSize size(dimensions.at(0).toInt(), dimensions.at(1).toInt());
+                if (size.isEmpty()) {
+                    appendText(nodes, content.mid(start, tagEnd - start));
+                    continue;
+                }
+                Node node;
+                node.type = NodeImage;
+                node.text = tag.mid(6, bracket - 6).toLower();
+                node.size = size;
+                nodes.append(node);
+                continue;
+            }
+        }
+
+        Node node;
+        node.type = NodeVariable;
+        node.text = tag;
+        nodes.append(node);
+    }
+    appendText(nodes, content.mid(pos));
+    return nodes;
+}
+
+/**
+ * @brief Appends text, merging it with a preceding text node
+ * @param nodes List of nodes
+ * @param text Text to append
+ */
+void CompiledTemplate::appendText(QList<Node> &nodes, const QString &text)
+{
+    if (text.isEmpty())
+        return;
+    if (!nodes.isEmpty() && nodes.last().type == NodeText) {
+        nodes.last().text.append(text);
+        return;
+    }
+    Node node;
+    node.type = NodeText;
+    node.text = text;
+    nodes.append(node);
+}
+
+/**
+ * @brief Searches depth first for a block
+ * @param nodes Nodes to search in
+ * @param name Name of the block
+ * @param children Will contain the content of the block
+ * @return True if the block was found
+ */
+bool CompiledTemplate::findBlock(const QList<Node> &nodes, const QString &name, QList<Node> &children)
+{
+    foreach (const Node &node, nodes) {
+        if (node.type != NodeBlock)
+            continue;
+        if (node.text == name) {
+            children = node.children;
+            return true;
+        }
+        if (findBlock(node.children, name, children))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Collects all image nodes
+ * @param nodes Nodes to search in
+ * @param images List of images
+ * @param keys Keys of the images already collected
+ */
+void CompiledTemplate::collectImages(const QList<Node> &nodes, QList<Image> &images, QStringList &keys)
+{
+    foreach (const Node &node, nodes) {
+        if (node.type == NodeBlock) {
+            collectImages(node.children, images, keys);
+        } else if (node.type == NodeImage && !keys.contains(imageKey(node.text, node.size))) {
+            keys.append(imageKey(node.text, node.size));
+            Image image;
+            image.type = node.text;
+            image.size = node.size;
+            images.append(image);
+        }
+    }
+}
+
+/**
+ * @brief Renders a list of nodes
+ * @param nodes Nodes to render
+ * @param scopes Contexts from outermost to innermost
+ * @param subDir Images are referenced from a page in a subdirectory
+ * @param result Rendered content is appended here
+ */
+void CompiledTemplate::render(const QList<Node> &nodes, QList<const Context*> &scopes, bool subDir, QString &result) const
+{
+    foreach (const Node &node, nodes) {
+        switch (node.type) {
+        case NodeText:
+            result.append(node.text);
+            break;
+        case NodeVariable: {
+            bool found = false;
+            for (int i=scopes.count()-1 ; i>=0 && !found ; --i) {
+                QHash<QString, QString>::const_iterator it = scopes.at(i)->variables.constFind(node.text);
+                if (it != scopes.at(i)->variables.constEnd()) {
+                    result.append(it.value());
+                    found = true;
+                }
+            }
+            if (!found)
+                result.append("{{ " + node.text + " }}");
+            break;
+        }
+        case NodeImage: {
+            QString key = imageKey(node.text, node.size);
+            bool found = false;
+            for (int i=scopes.count()-1 ; i>=0 && !found ; --i) {
+                QHash<QString, QString>::const_iterator it = scopes.at(i)->images.constFind(key);
+                if (it != scopes.at(i)->images.constEnd()) {
+                    result.append((subDir ? "../" : "") + it.value());
+                    found = true;
+                }
+            }
+            if (!found)
+                result.append("{{ IMAGE." + key + " }}");
+            break;
+        }
+        case NodeBlock: {
+            int scope = scopes.count()-1;
+            while (scope >= 0 && !scopes.at(scope)->renderedBlocks.contains(node.text) && !scopes.at(scope)->blocks.contains(node.text))
+                --scope;
+            if (scope < 0) {
+                result.append("{{ BEGIN_BLOCK_" + node.text + " }}");
+                render(node.children, scopes, subDir, result);
+                result.append("{{ END_BLOCK_" + node.text + " }}");
+                break;
+            }
+            const Context *context = scopes.at(scope);
+            if (context->renderedBlocks.contains(node.text)) {
+                result.append(context->renderedBlocks.value(node.text));
+                break;
+            }
+            QString separator = context->blockSeparators.value(node.text, " ");
+            const QList<Context> &items = context->blocks.constFind(node.text).value();
+            for (int i=0, n=items.count() ; i<n ; ++i) {
+                if (i > 0)
+                    result.append(separator);
+                scopes.append(&items.at(i));
+                render(node.children, scopes, subDir, result);
+                scopes.removeLast();
+            }
+            break;
+        }
+        }
+    }
+}
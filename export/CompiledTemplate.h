@@ -0,0 +1,67 @@
+#ifndef COMPILEDTEMPLATE_H
+#define COMPILEDTEMPLATE_H
+
+#include <QHash>
+#include <QList>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The CompiledTemplate class
+ *        Parses the content of an export template once into a tree of text, variable,
+ *        image and block nodes. Each item is then rendered in a single pass over this tree.
+ *        Supported tags: {{ VARIABLE }}, {{ IMAGE.type[width,height] }} and
+ *        {{ BEGIN_BLOCK_NAME }}...{{ END_BLOCK_NAME }}
+ */
+class CompiledTemplate
+{
+public:
+    struct Image {
+        QString type;
+        QSize size;
+    };
+
+    /**
+     * @brief Values used when rendering a template
+     *        Lookups which fail in a block item fall back to the enclosing contexts.
+     *        Tags without a value are left untouched.
+     */
+    struct Context {
+        QHash<QString, QString> variables;
+        QHash<QString, QString> images;
+        QHash<QString, QList<Context> > blocks;
+        QHash<QString, QString> blockSeparators;
+        QHash<QString, QString> renderedBlocks;
+    };
+
+    explicit CompiledTemplate(const QString &content = QString());
+    QString render(const Context &context, bool subDir) const;
+    CompiledTemplate block(const QString &name) const;
+    QList<CompiledTemplate::Image> images() const;
+
+    static QString imageKey(const QString &type, const QSize &size);
+    static QList<CompiledTemplate::Context> listContexts(const QString &variable, const QStringList &values);
+
+private:
+    enum NodeType {
+        NodeText, NodeVariable, NodeImage, NodeBlock
+    };
+
+    struct Node {
+        NodeType type;
+        QString text;
+        QSize size;
+        QList<Node> children;
+    };
+
+    QList<Node> m_nodes;
+
+    static QList<Node> compile(const QString &content);
+    static void appendText(QList<Node> &nodes, const QString &text);
+    static bool findBlock(const QList<Node> &nodes, const QString &name, QList<Node> &children);
+    static void collectImages(const QList<Node> &nodes, QList<CompiledTemplate::Image> &images, QStringList &keys);
+    void render(const QList<Node> &nodes, QList<const Context*> &scopes, bool subDir, QString &result) const;
+};
+
+#endif // COMPILEDTEMPLATE_H
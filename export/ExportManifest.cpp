@@ -0,0 +1,207 @@
+#include "ExportManifest.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+ExportManifest::ExportManifest()
+{
+}
+
+/**
+ * @brief Name of the manifest file inside the export directory
+ * @return File name
+ */
+QString ExportManifest::fileName()
+{
+    return "mediaelch-export.json";
+}
+
+/**
+ * @brief Checks if a directory contains a previous export
+ * @param directory Directory to check
+ * @return True if a manifest exists
+ */
+bool ExportManifest::exists(const QString &directory)
+{
+    return QFileInfo(directory + "/" + fileName()).exists();
+}
+
+/**
+ * @brief Loads the manifest of an export directory.
+ *        If the directory was exported with another template (or template version) the
+ *        previous entries are discarded, so everything is exported again.
+ * @param directory Export directory
+ * @param templateIdentifier Identifier of the template used for this export
+ * @param templateVersion Version of the template used for this export
+ */
+void ExportManifest::load(const QString &directory, const QString &templateIdentifier, const QString &templateVersion)
+{
+    m_directory = directory;
+    m_templateIdentifier = templateIdentifier;
+    m_templateVersion = templateVersion;
+    m_pages.clear();
+    m_images.clear();
+    m_currentPages.clear();
+    m_currentImages.clear();
+
+    QFile file(directory + "/" + fileName());
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+    QJsonObject manifest = QJsonDocument::fromJson(file.readAll()).object();
+    file.close();
+
+    if (manifest.value("template").toString() != templateIdentifier || manifest.value("templateVersion").toString() != templateVersion) {
+        qDebug() << "Template changed, exporting everything";
+        return;
+    }
+
+    QJsonObject pages = manifest.value("pages").toObject();
+    foreach (const QString &page, pages.keys())
+        m_pages.insert(page, pages.value(page).toString().toLatin1());
+
+    QJsonObject images = manifest.value("images").toObject();
+    foreach (const QString &image, images.keys()) {
+        QJsonObject entry = images.value(image).toObject();
+        ImageEntry imageEntry;
+        imageEntry.source = entry.value("source").toString();
+        imageEntry.lastModified = static_cast<qint64>(entry.value("lastModified").toDouble());
+        m_images.insert(image, imageEntry);
+    }
+    qDebug() << "Loaded manifest with" << m_pages.count() << "pages and" << m_images.count() << "images";
+}
+
+/**
+ * @brief Writes the manifest to the export directory
+ * @return Success
+ */
+bool ExportManifest::save()
+{
+    QJsonObject pages;
+    QHashIterator<QString, QByteArray> itPages(m_pages);
+    while (itPages.hasNext()) {
+        itPages.next();
+        pages.insert(itPages.key(), QString::fromLatin1(itPages.value()));
+    }
+
+    QJsonObject images;
+    QHashIterator<QString, ImageEntry> itImages(m_images);
+    while (itImages.hasNext()) {
+        itImages.next();
+        QJsonObject entry;
+        entry.insert("source", itImages.value().source);
+        entry.insert("lastModified", static_cast<double>(itImages.value().lastModified));
+        images.insert(itImages.key(), entry);
+    }
+
+    QJsonObject manifest;
+    manifest.insert("template", m_templateIdentifier);
+    manifest.insert("templateVersion", m_templateVersion);
+    manifest.insert("pages", pages);
+    manifest.insert("images", images);
+
+    QFile file(m_directory + "/" + fileName());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Manifest could not be written" << file.fileName();
+        return false;
+    }
+    file.write(QJsonDocument(manifest).toJson());
+    file.close();
+    return true;
+}
+
+/**
+ * @brief Hash of a rendered page as stored in the manifest
+ * @param content Rendered content
+ * @return Hash
+ */
+QByteArray ExportManifest::pageHash(const QByteArray &content)
+{
+    return QCryptographicHash::hash(content, QCryptographicHash::Sha1).toHex();
+}
+
+/**
+ * @brief Checks if a page has to be written. The page is kept when stale pages are removed.
+ * @param fileName Absolute path of the page
+ * @param hash Hash of the rendered content
+ * @return True if the content differs from the last export or the file is missing
+ * @see ExportManifest::setPage
+ */
+bool ExportManifest::pageChanged(const QString &fileName, const QByteArray &hash)
+{
+    QString page = relativePath(fileName);
+    m_currentPages.insert(page);
+    return m_pages.value(page) != hash || !QFileInfo(fileName).exists();
+}
+
+/**
+ * @brief Records the hash of a page after it was written successfully
+ * @param fileName Absolute path of the page
+ * @param hash Hash of the written content
+ */
+void ExportManifest::setPage(const QString &fileName, const QByteArray &hash)
+{
+    QString page = relativePath(fileName);
+    m_currentPages.insert(page);
+    m_pages.insert(page, hash);
+}
+
+/**
+ * @brief Returns the source of an image from the last export
+ * @param destination Absolute path of the exported image
+ * @param source Will contain the source image, empty if the image is unknown
+ * @param lastModified Will contain the modification time of the source (msecs since epoch)
+ */
+void ExportManifest::image(const QString &destination, QString &source, qint64 &lastModified) const
+{
+    ImageEntry entry = m_images.value(relativePath(destination));
+    source = entry.source;
+    lastModified = source.isEmpty() ? 0 : entry.lastModified;
+}
+
+/**
+ * @brief Records the source of an exported image
+ * @param destination Absolute path of the exported image
+ * @param source Source image
+ * @param lastModified Modification time of the source (msecs since epoch)
+ */
+void ExportManifest::setImage(const QString &destination, const QString &source, qint64 lastModified)
+{
+    ImageEntry entry;
+    entry.source = source;
+    entry.lastModified = lastModified;
+    m_images.insert(relativePath(destination), entry);
+    m_currentImages.insert(relativePath(destination));
+}
+
+/**
+ * @brief Removes pages and images of items which were not exported this time (e.g. deleted movies)
+ * @param directories Only files in these directories (relative to the export directory) are removed
+ */
+void ExportManifest::removeStaleFiles(const QStringList &directories)
+{
+    foreach (const QString &page, m_pages.keys()) {
+        if (m_currentPages.contains(page) || !directories.contains(QFileInfo(page).path()))
+            continue;
+        qDebug() << "Removing stale page" << page;
+        QFile::remove(m_directory + "/" + page);
+        m_pages.remove(page);
+    }
+
+    foreach (const QString &image, m_images.keys()) {
+        if (m_currentImages.contains(image) || !directories.contains(QFileInfo(image).path()))
+            continue;
+        qDebug() << "Removing stale image" << image;
+        QFile::remove(m_directory + "/" + image);
+        m_images.remove(image);
+    }
+}
+
+QString ExportManifest::relativePath(const QString &fileName) const
+{
+    return QDir(m_directory).relativeFilePath(fileName);
+}
@@ -0,0 +1,50 @@
+#ifndef EXPORTMANIFEST_H
+#define EXPORTMANIFEST_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The ExportManifest class
+ *        Stored in the export directory, records a hash of every successfully written page and
+ *        the source file and modification time of every exported image.
+ *        Re-exporting into the same directory only rewrites pages and images whose inputs changed.
+ */
+class ExportManifest
+{
+public:
+    ExportManifest();
+    void load(const QString &directory, const QString &templateIdentifier, const QString &templateVersion);
+    bool save();
+    bool pageChanged(const QString &fileName, const QByteArray &hash);
+    void setPage(const QString &fileName, const QByteArray &hash);
+    void image(const QString &destination, QString &source, qint64 &lastModified) const;
+    void setImage(const QString &destination, const QString &source, qint64 lastModified);
+    void removeStaleFiles(const QStringList &directories);
+
+    static QString fileName();
+    static QByteArray pageHash(const QByteArray &content);
+    static bool exists(const QString &directory);
+
+private:
+    struct ImageEntry {
+        QString source;
+        qint64 lastModified;
+    };
+
+    QString m_directory;
+    QString m_templateIdentifier;
+    QString m_templateVersion;
+    QHash<QString, QByteArray> m_pages;
+    QHash<QString, ImageEntry> m_images;
+    QSet<QString> m_currentPages;
+    QSet<QString> m_currentImages;
+
+    QString relativePath(const QString &fileName) const;
+};
+
+#endif // EXPORTMANIFEST_H
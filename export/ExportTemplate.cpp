@@ -54,6 +54,15 @@ void ExportTemplate::setExportSections(QList<ExportSection> exportSections)
     m_exportSections = exportSections;
 }
 
+/**
+ * @brief Overrides the location of the template files, by default they are read from the export templates directory
+ * @param location Directory of the template files
+ */
+void ExportTemplate::setTemplateLocation(QString location)
+{
+    m_templateLocation = location;
+}
+
 QList<ExportTemplate::ExportSection> ExportTemplate::exportSections()
 {
     return m_exportSections;
@@ -195,6 +204,8 @@ QString ExportTemplate::getTemplate(ExportTemplate::ExportSection section)
 
 QString ExportTemplate::getTemplateLocation()
 {
+    if (!m_templateLocation.isEmpty())
+        return m_templateLocation;
     return Settings::instance()->exportTemplatesDir() + "/" + identifier();
 }
 
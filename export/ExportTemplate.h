@@ -43,6 +43,7 @@ public:
     void setVersion(QString version);
     void setRemoteVersion(QString remoteVersion);
     void setExportSections(QList<ExportTemplate::ExportSection> exportSections);
+    void setTemplateLocation(QString location);
 
     static bool lessThan(ExportTemplate *a, ExportTemplate *b);
 
@@ -57,6 +58,7 @@ private:
     QString m_version;
     QString m_remoteVersion;
     QList<ExportTemplate::ExportSection> m_exportSections;
+    QString m_templateLocation;
     bool copyDir(const QString &srcPath, const QString &dstPath);
 };
 
@@ -0,0 +1,613 @@
+#include "Exporter.h"
+
+#include <QDebug>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QImage>
+#include <QtConcurrent/QtConcurrentMap>
+#include "globals/Manager.h"
+
+Exporter::Exporter(QObject *parent) :
+    QObject(parent),
+    m_canceled(false)
+{
+}
+
+/**
+ * @brief Exports the library sections into a directory
+ * @param directory Directory of the export, an export which was made into it before is updated
+ * @param exportTemplate Template to render
+ * @param sections Sections to export
+ * @return False if the export was canceled
+ */
+bool Exporter::exportTo(const QString &directory, ExportTemplate *exportTemplate, const QList<ExportTemplate::ExportSection> &sections)
+{
+    m_canceled = false;
+    m_imageJobs.clear();
+    m_queuedImages.clear();
+    m_manifest.load(directory, exportTemplate->identifier(), exportTemplate->version());
+
+    QDir dir(directory);
+
+    // Create the base structure
+    exportTemplate->copyTo(directory);
+
+    // Export movies
+    if (sections.contains(ExportTemplate::SectionMovies)) {
+        parseAndSaveMovies(dir, exportTemplate, Manager::instance()->movieModel()->movies());
+        saveImages();
+    }
+
+    // Export TV Shows
+    if (sections.contains(ExportTemplate::SectionTvShows)) {
+        if (m_canceled)
+            return false;
+        parseAndSaveTvShows(dir, exportTemplate, Manager::instance()->tvShowModel()->tvShows());
+        saveImages();
+    }
+
+    // Export Concerts
+    if (sections.contains(ExportTemplate::SectionConcerts)) {
+        if (m_canceled)
+            return false;
+        parseAndSaveConcerts(dir, exportTemplate, Manager::instance()->concertModel()->concerts());
+        saveImages();
+    }
+
+    if (m_canceled)
+        return false;
+
+    QStringList exportedDirectories;
+    if (sections.contains(ExportTemplate::SectionMovies))
+        exportedDirectories << "movies" << "movie_images";
+    if (sections.contains(ExportTemplate::SectionTvShows))
+        exportedDirectories << "tvshows" << "episodes" << "tvshow_images" << "episode_images";
+    if (sections.contains(ExportTemplate::SectionConcerts))
+        exportedDirectories << "concerts" << "concert_images";
+    m_manifest.removeStaleFiles(exportedDirectories);
+    m_manifest.save();
+    return true;
+}
+
+/**
+ * @brief Cancels a running export, the manifest of the directory is not updated
+ */
+void Exporter::cancel()
+{
+    m_canceled = true;
+}
+
+void Exporter::parseAndSaveMovies(QDir dir, ExportTemplate *exportTemplate, QList<Movie *> movies)
+{
+    qSort(movies.begin(), movies.end(), Movie::lessThan);
+    CompiledTemplate listTemplate(exportTemplate->getTemplate(ExportTemplate::SectionMovies));
+    CompiledTemplate listItemTemplate = listTemplate.block("MOVIE");
+    CompiledTemplate itemTemplate(exportTemplate->getTemplate(ExportTemplate::SectionMovie));
+    QList<CompiledTemplate::Image> images = itemTemplate.images() + listItemTemplate.images();
+
+    QStringList movieList;
+
+    dir.mkdir("movies");
+    dir.mkdir("movie_images");
+
+    foreach (Movie *movie, movies) {
+        if (m_canceled)
+            return;
+
+        CompiledTemplate::Context movieContext = context(movie, dir, images);
+        saveFile(dir.path() + QString("/movies/%1.html").arg(movie->movieId()), itemTemplate.render(movieContext, true));
+        movieList << listItemTemplate.render(movieContext, false);
+        emit sigItemExported();
+    }
+
+    CompiledTemplate::Context listContext;
+    listContext.renderedBlocks.insert("MOVIE", movieList.join("\n"));
+    saveFile(dir.path() + "/movies.html", listTemplate.render(listContext, false));
+}
+
+CompiledTemplate::Context Exporter::context(Movie *movie, const QDir &dir, const QList<CompiledTemplate::Image> &images)
+{
+    CompiledTemplate::Context c;
+    c.variables.insert("MOVIE.ID", QString::number(movie->movieId(), 'f', 0));
+    c.variables.insert("MOVIE.LINK", QString("movies/%1.html").arg(movie->movieId()));
+    c.variables.insert("MOVIE.TMDB_ID", movie->tmdbId());
+    c.variables.insert("MOVIE.TITLE", movie->name());
+    c.variables.insert("MOVIE.YEAR", movie->released().isValid() ? movie->released().toString("yyyy") : "");
+    c.variables.insert("MOVIE.ORIGINAL_TITLE", movie->originalName());
+    c.variables.insert("MOVIE.PLOT", movie->overview().replace("\n", "<br />"));
+    c.variables.insert("MOVIE.PLOT_SIMPLE", movie->outline().replace("\n", "<br />"));
+    c.variables.insert("MOVIE.SET", movie->set());
+    c.variables.insert("MOVIE.TAGLINE", movie->tagline());
+    c.variables.insert("MOVIE.GENRES", movie->genres().join(", "));
+    c.variables.insert("MOVIE.COUNTRIES", movie->countries().join(", "));
+    c.variables.insert("MOVIE.STUDIOS", movie->studios().join(", "));
+    c.variables.insert("MOVIE.TAGS", movie->tags().join(", "));
+    c.variables.insert("MOVIE.WRITER", movie->writer());
+    c.variables.insert("MOVIE.DIRECTOR", movie->director());
+    c.variables.insert("MOVIE.CERTIFICATION", movie->certification());
+    c.variables.insert("MOVIE.TRAILER", movie->trailer().toString());
+    c.variables.insert("MOVIE.RATING", QString::number(movie->rating(), 'f', 1));
+    c.variables.insert("MOVIE.VOTES", QString::number(movie->votes(), 'f', 0));
+    c.variables.insert("MOVIE.RUNTIME", QString::number(movie->runtime(), 'f', 0));
+    c.variables.insert("MOVIE.PLAY_COUNT", QString::number(movie->playcount(), 'f', 0));
+    c.variables.insert("MOVIE.LAST_PLAYED", movie->lastPlayed().isValid() ? movie->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
+    c.variables.insert("MOVIE.DATE_ADDED", movie->dateAdded().isValid() ? movie->dateAdded().toString("yyyy-MM-dd hh:mm") : "");
+    c.variables.insert("MOVIE.FILE_LAST_MODIFIED", movie->fileLastModified().isValid() ? movie->fileLastModified().toString("yyyy-MM-dd hh:mm") : "");
+
+    c.blocks.insert("TAGS", CompiledTemplate::listContexts("TAG.NAME", movie->tags()));
+    c.blocks.insert("GENRES", CompiledTemplate::listContexts("GENRE.NAME", movie->genres()));
+    c.blocks.insert("COUNTRIES", CompiledTemplate::listContexts("COUNTRY.NAME", movie->countries()));
+    c.blocks.insert("STUDIOS", CompiledTemplate::listContexts("STUDIO.NAME", movie->studios()));
+
+    QList<CompiledTemplate::Context> actors;
+    foreach (const Actor &actor, movie->actors()) {
+        CompiledTemplate::Context a;
+        a.variables.insert("ACTOR.NAME", actor.name);
+        a.variables.insert("ACTOR.ROLE", actor.role);
+        actors << a;
+    }
+    c.blocks.insert("ACTORS", actors);
+
+    addStreamDetails(c, movie->streamDetails());
+    resolveImages(c, images, dir, movie);
+    return c;
+}
+
+void Exporter::parseAndSaveConcerts(QDir dir, ExportTemplate *exportTemplate, QList<Concert *> concerts)
+{
+    qSort(concerts.begin(), concerts.end(), Concert::lessThan);
+    CompiledTemplate listTemplate(exportTemplate->getTemplate(ExportTemplate::SectionConcerts));
+    CompiledTemplate listItemTemplate = listTemplate.block("CONCERT");
+    CompiledTemplate itemTemplate(exportTemplate->getTemplate(ExportTemplate::SectionConcert));
+    QList<CompiledTemplate::Image> images = itemTemplate.images() + listItemTemplate.images();
+
+    QStringList concertList;
+
+    dir.mkdir("concerts");
+    dir.mkdir("concert_images");
+
+    foreach (Concert *concert, concerts) {
+        if (m_canceled)
+            return;
+
+        CompiledTemplate::Context concertContext = context(concert, dir, images);
+        saveFile(dir.path() + QString("/concerts/%1.html").arg(concert->concertId()), itemTemplate.render(concertContext, true));
+        concertList << listItemTemplate.render(concertContext, false);
+        emit sigItemExported();
+    }
+
+    CompiledTemplate::Context listContext;
+    listContext.renderedBlocks.insert("CONCERT", concertList.join("\n"));
+    saveFile(dir.path() + "/concerts.html", listTemplate.render(listContext, false));
+}
+
+CompiledTemplate::Context Exporter::context(Concert *concert, const QDir &dir, const QList<CompiledTemplate::Image> &images)
+{
+    CompiledTemplate::Context c;
+    c.variables.insert("CONCERT.ID", QString::number(concert->concertId(), 'f', 0));
+    c.variables.insert("CONCERT.LINK", QString("concerts/%1.html").arg(concert->concertId()));
+    c.variables.insert("CONCERT.TITLE", concert->name());
+    c.variables.insert("CONCERT.ARTIST", concert->artist());
+    c.variables.insert("CONCERT.ALBUM", concert->album());
+    c.variables.insert("CONCERT.TAGLINE", concert->tagline());
+    c.variables.insert("CONCERT.RATING", QString::number(concert->rating(), 'f', 1));
+    c.variables.insert("CONCERT.YEAR", concert->released().isValid() ? concert->released().toString("yyyy") : "");
+    c.variables.insert("CONCERT.RUNTIME", QString::number(concert->runtime(), 'f', 0));
+    c.variables.insert("CONCERT.CERTIFICATION", concert->certification());
+    c.variables.insert("CONCERT.TRAILER", concert->trailer().toString());
+    c.variables.insert("CONCERT.PLAY_COUNT", QString::number(concert->playcount(), 'f', 0));
+    c.variables.insert("CONCERT.LAST_PLAYED", concert->lastPlayed().isValid() ? concert->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
+    c.variables.insert("CONCERT.PLOT", concert->overview().replace("\n", "<br />"));
+    c.variables.insert("CONCERT.TAGS", concert->tags().join(", "));
+    c.variables.insert("CONCERT.GENRES", concert->genres().join(", "));
+
+    addStreamDetails(c, concert->streamDetails());
+    c.blocks.insert("TAGS", CompiledTemplate::listContexts("TAG.NAME", concert->tags()));
+    c.blocks.insert("GENRES", CompiledTemplate::listContexts("GENRE.NAME", concert->genres()));
+    resolveImages(c, images, dir, 0, concert);
+    return c;
+}
+
+void Exporter::parseAndSaveTvShows(QDir dir, ExportTemplate *exportTemplate, QList<TvShow *> shows)
+{
+    qSort(shows.begin(), shows.end(), TvShow::lessThan);
+    CompiledTemplate listTemplate(exportTemplate->getTemplate(ExportTemplate::SectionTvShows));
+    CompiledTemplate listItemTemplate = listTemplate.block("TVSHOW");
+    CompiledTemplate itemTemplate(exportTemplate->getTemplate(ExportTemplate::SectionTvShow));
+    CompiledTemplate episodeTemplate(exportTemplate->getTemplate(ExportTemplate::SectionEpisode));
+    QList<CompiledTemplate::Image> images = itemTemplate.images() + listItemTemplate.images();
+    QList<CompiledTemplate::Image> episodeImages = episodeTemplate.images() + itemTemplate.block("EPISODE").images();
+
+    QStringList tvShowList;
+
+    dir.mkdir("tvshows");
+    dir.mkdir("tvshow_images");
+    dir.mkdir("episodes");
+    dir.mkdir("episode_images");
+
+    foreach (TvShow *show, shows) {
+        if (m_canceled)
+            return;
+
+        QMap<TvShowEpisode*, CompiledTemplate::Context> episodeContexts;
+        foreach (TvShowEpisode *episode, show->episodes())
+            episodeContexts.insert(episode, context(episode, dir, episodeImages));
+
+        CompiledTemplate::Context showContext = context(show, dir, images);
+        QList<int> seasons = show->seasons(false);
+        qSort(seasons);
+        QList<CompiledTemplate::Context> seasonContexts;
+        foreach (const int &season, seasons) {
+            QList<TvShowEpisode*> episodes = show->episodes(season);
+            qSort(episodes.begin(), episodes.end(), TvShowEpisode::lessThan);
+            CompiledTemplate::Context seasonContext;
+            seasonContext.variables.insert("SEASON", QString::number(season));
+            seasonContext.blockSeparators.insert("EPISODE", "\n");
+            QList<CompiledTemplate::Context> episodeList;
+            foreach (TvShowEpisode *episode, episodes)
+                episodeList << episodeContexts.value(episode);
+            seasonContext.blocks.insert("EPISODE", episodeList);
+            seasonContexts << seasonContext;
+        }
+        showContext.blocks.insert("SEASON", seasonContexts);
+        showContext.blockSeparators.insert("SEASON", "\n");
+
+        saveFile(dir.path() + QString("/tvshows/%1.html").arg(show->showId()), itemTemplate.render(showContext, true));
+        tvShowList << listItemTemplate.render(showContext, false);
+        emit sigItemExported();
+
+        foreach (TvShowEpisode *episode, show->episodes()) {
+            if (episode->isDummy())
+                continue;
+            saveFile(dir.path() + QString("/episodes/%1.html").arg(episode->episodeId()), episodeTemplate.render(episodeContexts.value(episode), true));
+            emit sigItemExported();
+        }
+    }
+
+    CompiledTemplate::Context listContext;
+    listContext.renderedBlocks.insert("TVSHOW", tvShowList.join("\n"));
+    saveFile(dir.path() + "/tvshows.html", listTemplate.render(listContext, false));
+}
+
+CompiledTemplate::Context Exporter::context(TvShow *show, const QDir &dir, const QList<CompiledTemplate::Image> &images)
+{
+    CompiledTemplate::Context c;
+    c.variables.insert("TVSHOW.ID", QString::number(show->showId(), 'f', 0));
+    c.variables.insert("TVSHOW.LINK", QString("tvshows/%1.html").arg(show->showId()));
+    c.variables.insert("TVSHOW.IMDB_ID", show->imdbId());
+    c.variables.insert("TVSHOW.TITLE", show->name());
+    c.variables.insert("TVSHOW.RATING", QString::number(show->rating(), 'f', 1));
+    c.variables.insert("TVSHOW.CERTIFICATION", show->certification());
+    c.variables.insert("TVSHOW.FIRST_AIRED", show->firstAired().isValid() ? show->firstAired().toString("yyyy-MM-dd") : "");
+    c.variables.insert("TVSHOW.STUDIO", show->network());
+    c.variables.insert("TVSHOW.PLOT", show->overview().replace("\n", "<br />"));
+    c.variables.insert("TVSHOW.TAGS", show->tags().join(", "));
+    c.variables.insert("TVSHOW.GENRES", show->genres().join(", "));
+
+    QList<CompiledTemplate::Context> actors;
+    foreach (const Actor &actor, show->actors()) {
+        CompiledTemplate::Context a;
+        a.variables.insert("ACTOR.NAME", actor.name);
+        a.variables.insert("ACTOR.ROLE", actor.role);
+        actors << a;
+    }
+    c.blocks.insert("ACTORS", actors);
+    c.blocks.insert("TAGS", CompiledTemplate::listContexts("TAG.NAME", show->tags()));
+    c.blocks.insert("GENRES", CompiledTemplate::listContexts("GENRE.NAME", show->genres()));
+    resolveImages(c, images, dir, 0, 0, show);
+    return c;
+}
+
+CompiledTemplate::Context Exporter::context(TvShowEpisode *episode, const QDir &dir, const QList<CompiledTemplate::Image> &images)
+{
+    CompiledTemplate::Context c;
+    c.variables.insert("SHOW.TITLE", episode->tvShow()->name());
+    c.variables.insert("SHOW.LINK", QString("../tvshows/%1.html").arg(episode->tvShow()->showId()));
+    c.variables.insert("EPISODE.LINK", QString("../episodes/%1.html").arg(episode->episodeId()));
+    c.variables.insert("EPISODE.TITLE", episode->name());
+    c.variables.insert("EPISODE.SEASON", episode->seasonString());
+    c.variables.insert("EPISODE.EPISODE", episode->episodeString());
+    c.variables.insert("EPISODE.RATING", QString::number(episode->rating(), 'f', 1));
+    c.variables.insert("EPISODE.CERTIFICATION", episode->certification());
+    c.variables.insert("EPISODE.FIRST_AIRED", episode->firstAired().isValid() ? episode->firstAired().toString("yyyy-MM-dd") : "");
+    c.variables.insert("EPISODE.LAST_PLAYED", episode->lastPlayed().isValid() ? episode->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
+    c.variables.insert("EPISODE.STUDIO", episode->network());
+    c.variables.insert("EPISODE.PLOT", episode->overview().replace("\n", "<br />"));
+    c.variables.insert("EPISODE.WRITERS", episode->writers().join(", "));
+    c.variables.insert("EPISODE.DIRECTORS", episode->directors().join(", "));
+
+    addStreamDetails(c, episode->streamDetails());
+    c.blocks.insert("WRITERS", CompiledTemplate::listContexts("WRITER.NAME", episode->writers()));
+    c.blocks.insert("DIRECTORS", CompiledTemplate::listContexts("DIRECTOR.NAME", episode->directors()));
+    resolveImages(c, images, dir, 0, 0, 0, episode);
+    return c;
+}
+
+void Exporter::addStreamDetails(CompiledTemplate::Context &context, StreamDetails *streamDetails)
+{
+    context.variables.insert("FILEINFO.WIDTH", streamDetails->videoDetails().value("width", "0"));
+    context.variables.insert("FILEINFO.HEIGHT", streamDetails->videoDetails().value("height", "0"));
+    context.variables.insert("FILEINFO.ASPECT", streamDetails->videoDetails().value("aspect", "0"));
+    context.variables.insert("FILEINFO.CODEC", streamDetails->videoDetails().value("codec", ""));
+    context.variables.insert("FILEINFO.DURATION", streamDetails->videoDetails().value("durationinseconds", "0"));
+
+    QStringList audioCodecs;
+    QStringList audioChannels;
+    QStringList audioLanguages;
+    for (int i=0, n=streamDetails->audioDetails().count() ; i<n ; ++i) {
+        audioCodecs << streamDetails->audioDetails().at(i).value("codec");
+        audioChannels << streamDetails->audioDetails().at(i).value("channels");
+        audioLanguages << streamDetails->audioDetails().at(i).value("language");
+    }
+    context.variables.insert("FILEINFO.AUDIO.CODEC", audioCodecs.join("|"));
+    context.variables.insert("FILEINFO.AUDIO.CHANNELS", audioChannels.join("|"));
+    context.variables.insert("FILEINFO.AUDIO.LANGUAGE", audioLanguages.join("|"));
+}
+
+void Exporter::saveFile(QString fileName, QString content)
+{
+    QByteArray data = content.toUtf8();
+    QByteArray hash = ExportManifest::pageHash(data);
+    if (!m_manifest.pageChanged(fileName, hash))
+        return;
+
+    // Only a complete page is recorded, otherwise the next export writes it again
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Text)) {
+        qWarning() << "Could not open" << fileName;
+        return;
+    }
+    bool written = file.write(data) == data.size() && file.flush();
+    file.close();
+    if (!written) {
+        qWarning() << "Could not write" << fileName;
+        return;
+    }
+    m_manifest.setPage(fileName, hash);
+}
+
+void Exporter::queueImage(QSize size, QString imageFile, QString destinationFile, const char *format, int quality)
+{
+    if (m_queuedImages.contains(destinationFile))
+        return;
+    m_queuedImages.insert(destinationFile);
+
+    ImageJob job;
+    job.source = imageFile;
+    job.destination = destinationFile;
+    job.size = size;
+    job.format = format;
+    job.quality = quality;
+    job.sourceModified = 0;
+    job.written = false;
+    m_manifest.image(destinationFile, job.previousSource, job.previousSourceModified);
+    m_imageJobs.append(job);
+}
+
+void Exporter::saveImages()
+{
+    if (m_canceled)
+        m_imageJobs.clear();
+    if (m_imageJobs.isEmpty())
+        return;
+
+    emit sigImagesQueued(m_imageJobs.count());
+
+    QEventLoop loop;
+    QFutureWatcher<void> watcher;
+    connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+    connect(&watcher, SIGNAL(progressValueChanged(int)), this, SIGNAL(sigImageProgress(int)));
+    watcher.setFuture(QtConcurrent::map(m_imageJobs, &Exporter::runImageJob));
+    loop.exec(QEventLoop::ExcludeUserInputEvents);
+
+    // failed images are not recorded, so the next export writes them again
+    foreach (const ImageJob &job, m_imageJobs) {
+        if (job.written)
+            m_manifest.setImage(job.destination, job.source, job.sourceModified);
+    }
+
+    emit sigImageProgress(m_imageJobs.count());
+    m_imageJobs.clear();
+}
+
+/**
+ * @brief Saves an image job. Called from the thread pool.
+ * @param job Image job, written is set if the destination is up to date afterwards
+ */
+void Exporter::runImageJob(ImageJob &job)
+{
+    job.written = saveImage(job);
+}
+
+/**
+ * @brief Scales the source image and saves it to the destination
+ * @param job Image job
+ * @return True if the destination was written or is up to date from a previous export
+ */
+bool Exporter::saveImage(ImageJob &job)
+{
+    QFileInfo source(job.source);
+    if (!source.exists())
+        return false;
+    job.sourceModified = source.lastModified().toMSecsSinceEpoch();
+
+    // Skip images which are up to date from a previous export
+    QFileInfo destination(job.destination);
+    if (destination.exists()) {
+        if (job.previousSource == job.source && job.previousSourceModified == job.sourceModified)
+            return true;
+        if (job.previousSource.isEmpty() && destination.lastModified() >= source.lastModified())
+            return true;
+    }
+
+    QImage img(job.source);
+    if (img.isNull()) {
+        qWarning() << "Could not read image" << job.source;
+        return false;
+    }
+    img = img.scaled(job.size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    if (!img.save(job.destination, job.format.constData(), job.quality)) {
+        // a partial file would look up to date to the next export
+        qWarning() << "Could not write" << job.destination;
+        QFile::remove(job.destination);
+        return false;
+    }
+    return true;
+}
+
+void Exporter::resolveImages(CompiledTemplate::Context &context, const QList<CompiledTemplate::Image> &images, const QDir &dir, Movie *movie, Concert *concert, TvShow *tvShow, TvShowEpisode *episode)
+{
+    foreach (const CompiledTemplate::Image &image, images) {
+        QString destFile;
+        bool imageSaved = false;
+        QString typeName;
+        if (movie) {
+            imageSaved = saveImageForType(image.type, image.size, dir, destFile, movie);
+            typeName = "movie";
+        } else if (concert) {
+            imageSaved = saveImageForType(image.type, image.size, dir, destFile, concert);
+            typeName = "concert";
+        } else if (tvShow) {
+            imageSaved = saveImageForType(image.type, image.size, dir, destFile, tvShow);
+            typeName = "tvshow";
+        } else if (episode) {
+            imageSaved = saveImageForType(image.type, image.size, dir, destFile, episode);
+            typeName = "episode";
+        }
+
+        if (!imageSaved)
+            destFile = QString("defaults/%1_%2_%3x%4.png").arg(typeName).arg(image.type).arg(image.size.width()).arg(image.size.height());
+        context.images.insert(CompiledTemplate::imageKey(image.type, image.size), destFile);
+    }
+}
+
+bool Exporter::saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, Movie *movie)
+{
+    destFile = "movie_images/" + QString("%1-%2_%3x%4.jpg").arg(movie->movieId()).arg(type).arg(size.width()).arg(size.height());
+
+    if (type == "poster") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, ImageType::MoviePoster);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "fanart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, ImageType::MovieBackdrop);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "logo") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, ImageType::MovieLogo);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "clearart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, ImageType::MovieClearArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "disc") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, ImageType::MovieCdArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool Exporter::saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, Concert *concert)
+{
+    destFile = "concert_images/" + QString("%1-%2_%3x%4.jpg").arg(concert->concertId()).arg(type).arg(size.width()).arg(size.height());
+
+    if (type == "poster") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, ImageType::ConcertPoster);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "fanart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, ImageType::ConcertBackdrop);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "logo") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, ImageType::ConcertLogo);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "clearart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, ImageType::ConcertClearArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "disc") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, ImageType::ConcertCdArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool Exporter::saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, TvShow *tvShow)
+{
+    destFile = "tvshow_images/" + QString("%1-%2_%3x%4.jpg").arg(tvShow->showId()).arg(type).arg(size.width()).arg(size.height());
+
+    if (type == "poster") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowPoster);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "fanart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowBackdrop);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "banner") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowBanner);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else if (type == "logo") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowLogos);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "clearart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowClearArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else if (type == "characterart") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, ImageType::TvShowCharacterArt);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "png", -1);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool Exporter::saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, TvShowEpisode *episode)
+{
+    destFile = "episode_images/" + QString("%1-%2_%3x%4.jpg").arg(episode->episodeId()).arg(type).arg(size.width()).arg(size.height());
+
+    if (type == "thumbnail") {
+        QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(episode, ImageType::TvShowEpisodeThumb);
+        if (filename.isEmpty())
+            return false;
+        queueImage(size, filename, dir.path() + "/" + destFile, "jpg", 90);
+    } else {
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,71 @@
+#ifndef EXPORTER_H
+#define EXPORTER_H
+
+#include <QDir>
+#include <QObject>
+#include <QSet>
+#include "data/Concert.h"
+#include "data/TvShow.h"
+#include "data/TvShowEpisode.h"
+#include "export/CompiledTemplate.h"
+#include "export/ExportManifest.h"
+#include "export/ExportTemplate.h"
+#include "movies/Movie.h"
+
+/**
+ * @brief The Exporter class
+ *        Renders the pages and scales the images of an export template into a directory.
+ *        Pages and images which didn't change since the last export into the directory are not written again.
+ */
+class Exporter : public QObject
+{
+    Q_OBJECT
+public:
+    explicit Exporter(QObject *parent = 0);
+    bool exportTo(const QString &directory, ExportTemplate *exportTemplate, const QList<ExportTemplate::ExportSection> &sections);
+    void cancel();
+
+signals:
+    void sigItemExported();
+    void sigImagesQueued(int count);
+    void sigImageProgress(int value);
+
+private:
+    bool m_canceled;
+
+    struct ImageJob {
+        QString source;
+        QString destination;
+        QSize size;
+        QByteArray format;
+        int quality;
+        QString previousSource;
+        qint64 previousSourceModified;
+        qint64 sourceModified;
+        bool written;
+    };
+    QList<ImageJob> m_imageJobs;
+    QSet<QString> m_queuedImages;
+    ExportManifest m_manifest;
+
+    void parseAndSaveMovies(QDir dir, ExportTemplate *exportTemplate, QList<Movie*> movies);
+    void parseAndSaveConcerts(QDir dir, ExportTemplate *exportTemplate, QList<Concert*> concerts);
+    void parseAndSaveTvShows(QDir dir, ExportTemplate *exportTemplate, QList<TvShow*> shows);
+    void queueImage(QSize size, QString imageFile, QString destinationFile, const char *format, int quality);
+    void saveImages();
+    static void runImageJob(ImageJob &job);
+    static bool saveImage(ImageJob &job);
+    void resolveImages(CompiledTemplate::Context &context, const QList<CompiledTemplate::Image> &images, const QDir &dir, Movie *movie = 0, Concert *concert = 0, TvShow *tvShow = 0, TvShowEpisode *episode = 0);
+    bool saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, Movie *movie);
+    bool saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, Concert *concert);
+    bool saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, TvShow *tvShow);
+    bool saveImageForType(const QString &type, const QSize &size, const QDir &dir, QString &destFile, TvShowEpisode *episode);
+    CompiledTemplate::Context context(Movie *movie, const QDir &dir, const QList<CompiledTemplate::Image> &images);
+    CompiledTemplate::Context context(Concert *concert, const QDir &dir, const QList<CompiledTemplate::Image> &images);
+    CompiledTemplate::Context context(TvShow *show, const QDir &dir, const QList<CompiledTemplate::Image> &images);
+    CompiledTemplate::Context context(TvShowEpisode *episode, const QDir &dir, const QList<CompiledTemplate::Image> &images);
+    void addStreamDetails(CompiledTemplate::Context &context, StreamDetails *streamDetails);
+    void saveFile(QString fileName, QString content);
+};
+
+#endif // EXPORTER_H
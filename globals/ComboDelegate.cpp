@@ -46,12 +46,7 @@ void ComboDelegate::setEditorData(QWidget *editor, const QModelIndex &index) con
     QComboBox *box = static_cast<QComboBox*>(editor);
     QStringList items;
     if (m_widget == WidgetMovies && m_type == ComboDelegateGenres) {
-        foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-            foreach (const QString &genre, movie->genres()) {
-                if (!genre.isEmpty() && !items.contains(genre))
-                    items.append(genre);
-            }
-        }
+        items = Manager::instance()->movieModel()->movieIndex()->values(MovieIndex::Genre);
     } else if (m_widget == WidgetMovies && m_type == ComboDelegateCountries) {
         foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
             foreach (const QString &country, movie->countries()) {
@@ -0,0 +1,35 @@
+#include "DirectoryListing.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QStringList>
+
+/**
+ * @brief Checks if a file exists, the directory of the file is listed on the first check
+ * @param fileName Path of the file
+ * @return True if the file exists and is a regular file (or a link to one)
+ */
+bool DirectoryListing::isFile(const QString &fileName)
+{
+    QString file = QDir::fromNativeSeparators(fileName);
+    int index = file.lastIndexOf("/");
+    if (index == -1)
+        return false;
+    QString path = file.left(index);
+    QString name = file.mid(index+1);
+
+    if (!m_files.contains(path)) {
+        QSet<QString> &files = m_files[path];
+        QSet<QString> &lowerCaseFiles = m_lowerCaseFiles[path];
+        foreach (const QString &entry, QDir(path).entryList(QDir::Files | QDir::Hidden)) {
+            files.insert(entry);
+            lowerCaseFiles.insert(entry.toLower());
+        }
+    }
+
+    if (m_files[path].contains(name))
+        return true;
+    if (!m_lowerCaseFiles[path].contains(name.toLower()))
+        return false;
+    return QFileInfo(fileName).isFile();
+}
@@ -0,0 +1,26 @@
+#ifndef DIRECTORYLISTING_H
+#define DIRECTORYLISTING_H
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+/**
+ * @brief The DirectoryListing class
+ *        Answers file existence checks by listing every directory only once.
+ *        Checking a handful of candidate names costs a single readdir per directory instead of one stat per name,
+ *        which matters on network shares. The listing is a snapshot, so use it only for a short sequence of checks.
+ *        Names which only differ in case are checked on the file system, so case-insensitive file systems
+ *        (e.g. SMB/CIFS mounts on Linux) find them and case-sensitive ones don't.
+ */
+class DirectoryListing
+{
+public:
+    bool isFile(const QString &fileName);
+
+private:
+    QHash<QString, QSet<QString> > m_files;
+    QHash<QString, QSet<QString> > m_lowerCaseFiles;
+};
+
+#endif // DIRECTORYLISTING_H
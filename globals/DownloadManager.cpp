@@ -2,16 +2,22 @@
 
 #include <QDebug>
 #include <QFile>
+#include <QTemporaryFile>
 #include <QTimer>
 
 #include "globals/DownloadManagerElement.h"
+#include "globals/Logger.h"
 
 /**
  * @brief DownloadManager::DownloadManager
  * @param parent
  */
 DownloadManager::DownloadManager(QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    m_timer(this),
+    m_stagingFile(0),
+    m_hash(QCryptographicHash::Md5),
+    m_bytesStaged(0)
 {
     m_downloading = false;
     connect(&m_timer, SIGNAL(timeout()), this, SLOT(downloadTimeout()));
@@ -34,7 +40,7 @@ QNetworkAccessManager *DownloadManager::qnam()
  */
 void DownloadManager::addDownload(DownloadManagerElement elem)
 {
-    qDebug() << "Entered, url=" << elem.url;
+    LOG_DEBUG() << "Entered, url=" << elem.url;
     if (m_queue.isEmpty())
         QTimer::singleShot(0, this, SLOT(startNextDownload()));
     m_mutex.lock();
@@ -49,7 +55,7 @@ void DownloadManager::addDownload(DownloadManagerElement elem)
  */
 void DownloadManager::setDownloads(QList<DownloadManagerElement> elements)
 {
-    qDebug() << "Entered";
+    LOG_DEBUG() << "Entered";
     if (m_downloading)
         m_currentReply->abort();
 
@@ -102,7 +108,7 @@ void DownloadManager::startNextDownload()
     }
 
     if (m_queue.isEmpty()) {
-        qDebug() << "All downloads finished";
+        LOG_DEBUG() << "All downloads finished";
         emit allDownloadsFinished();
         return;
     }
@@ -114,6 +120,9 @@ void DownloadManager::startNextDownload()
     m_mutex.unlock();
     if (!m_currentDownloadElement.url.toString().startsWith("//")) {
         m_currentReply = qnam()->get(QNetworkRequest(m_currentDownloadElement.url));
+        if (m_currentDownloadElement.imageType != ImageType::Actor)
+            startStaging();
+        connect(m_currentReply, SIGNAL(readyRead()), this, SLOT(downloadReadyRead()));
         connect(m_currentReply, SIGNAL(finished()), this, SLOT(downloadFinished()));
         connect(m_currentReply, SIGNAL(downloadProgress(qint64,qint64)), this, SLOT(downloadProgress(qint64,qint64)));
     }
@@ -149,17 +158,74 @@ void DownloadManager::startNextDownload()
             data = file.readAll();
             file.close();
         }
-        m_currentDownloadElement.data = data;
+        if (m_currentDownloadElement.imageType == ImageType::Actor) {
+            m_currentDownloadElement.data = data;
+        } else {
+            m_currentDownloadElement.image = StagedImage(data);
+        }
         if (m_currentDownloadElement.imageType == ImageType::Actor && !m_currentDownloadElement.movie)
             m_currentDownloadElement.actor->image = data;
         else if (m_currentDownloadElement.imageType == ImageType::TvShowEpisodeThumb && !m_currentDownloadElement.directDownload)
-            m_currentDownloadElement.episode->setThumbnailImage(data);
+            m_currentDownloadElement.episode->setThumbnailImage(m_currentDownloadElement.image);
         else
             emit downloadFinished(m_currentDownloadElement);
         startNextDownload();
     }
 }
 
+/**
+ * @brief Opens a staging file for the current download.
+ *        If the file can't be created the reply is read into memory when it has finished.
+ */
+void DownloadManager::startStaging()
+{
+    discardStaging();
+    m_hash.reset();
+    m_bytesStaged = 0;
+    if (StagedImage::stagingDir().isEmpty())
+        return;
+
+    QTemporaryFile *file = new QTemporaryFile(StagedImage::stagingDir() + "/downloadXXXXXX");
+    file->setAutoRemove(false);
+    if (!file->open()) {
+        qWarning() << "Could not create a staging file, downloading into memory";
+        delete file;
+        return;
+    }
+    m_stagingFile = file;
+}
+
+/**
+ * @brief Removes the staging file of the current download
+ */
+void DownloadManager::discardStaging()
+{
+    if (!m_stagingFile)
+        return;
+    m_stagingFile->remove();
+    delete m_stagingFile;
+    m_stagingFile = 0;
+}
+
+/**
+ * @brief Called by the current network reply, appends the received data to the staging file
+ */
+void DownloadManager::downloadReadyRead()
+{
+    if (!m_stagingFile)
+        return;
+
+    QByteArray chunk = m_currentReply->readAll();
+    m_hash.addData(chunk);
+    m_bytesStaged += chunk.size();
+    if (m_stagingFile->write(chunk) != chunk.size()) {
+        qWarning() << "Could not write staging file" << m_stagingFile->fileName();
+        discardStaging();
+        if (m_currentReply->isRunning())
+            m_currentReply->abort();
+    }
+}
+
 /**
  * @brief Called by the current network reply
  * @param received Received bytes
@@ -185,10 +251,10 @@ void DownloadManager::downloadTimeout()
     m_currentReply->abort();
     m_currentReply->deleteLater();
     if (m_retries <= 2) {
-        qDebug() << "Restarting the download";
+        LOG_DEBUG() << "Restarting the download";
         m_queue.prepend(m_currentDownloadElement);
     } else {
-        qDebug() << "Giving up on this file, tried 3 times";
+        LOG_DEBUG() << "Giving up on this file, tried 3 times";
         m_retries = 0;
     }
     startNextDownload();
@@ -200,34 +266,82 @@ void DownloadManager::downloadTimeout()
  */
 void DownloadManager::downloadFinished()
 {
-    qDebug() << "Entered";
+    LOG_DEBUG() << "Entered";
 
     QNetworkReply *reply = static_cast<QNetworkReply*>(QObject::sender());
     m_downloading = false;
     m_retries = 0;
     QByteArray data;
+    m_currentDownloadElement.data = QByteArray();
+    m_currentDownloadElement.image = StagedImage();
+
+    // the rest of the reply has to be staged as well, a failed write is handled like a network error
+    bool stagingFailed = false;
+    if (m_currentReply->error() == QNetworkReply::NoError && m_stagingFile) {
+        downloadReadyRead();
+        stagingFailed = !m_stagingFile;
+    }
+
     if (m_currentReply->error() != QNetworkReply::NoError) {
         qWarning() << "Network Error" << m_currentReply->errorString();
+        discardStaging();
+    } else if (stagingFailed) {
+        qWarning() << "Download could not be staged" << m_currentDownloadElement.url;
+    } else if (m_stagingFile) {
+        if (isComplete(m_bytesStaged)) {
+            QString fileName = m_stagingFile->fileName();
+            m_stagingFile->close();
+            delete m_stagingFile;
+            m_stagingFile = 0;
+            m_currentDownloadElement.image = StagedImage::fromStagedFile(fileName, m_hash.result());
+        } else {
+            discardStaging();
+        }
     } else {
         data = m_currentReply->readAll();
+        if (!isComplete(data.size()))
+            data = QByteArray();
+        else if (m_currentDownloadElement.imageType != ImageType::Actor)
+            m_currentDownloadElement.image = StagedImage(data);
     }
-    m_currentDownloadElement.data = data;
+    LOG_DEBUG() << "Downloaded" << m_currentDownloadElement.url << m_currentDownloadElement.image.size() << "bytes, md5" << m_currentDownloadElement.image.checksum().toHex();
+    if (m_currentDownloadElement.imageType == ImageType::Actor)
+        m_currentDownloadElement.data = data;
     reply->deleteLater();
     if (m_currentDownloadElement.imageType == ImageType::Actor && !m_currentDownloadElement.movie)
         m_currentDownloadElement.actor->image = data;
     else if (m_currentDownloadElement.imageType == ImageType::TvShowEpisodeThumb && !m_currentDownloadElement.directDownload)
-        m_currentDownloadElement.episode->setThumbnailImage(data);
+        m_currentDownloadElement.episode->setThumbnailImage(m_currentDownloadElement.image);
     else
         emit downloadFinished(m_currentDownloadElement);
     startNextDownload();
 }
 
+/**
+ * @brief Checks the received bytes of the current reply against its Content-Length header.
+ *        Compressed replies are decoded by Qt, their length can't be compared.
+ * @param size Number of received bytes
+ * @return False if the reply is truncated
+ */
+bool DownloadManager::isComplete(qint64 size)
+{
+    QVariant contentLength = m_currentReply->header(QNetworkRequest::ContentLengthHeader);
+    QByteArray encoding = m_currentReply->rawHeader("Content-Encoding").trimmed().toLower();
+    if (!contentLength.isValid() || (!encoding.isEmpty() && encoding != "identity"))
+        return true;
+    if (size != contentLength.toLongLong()) {
+        qWarning() << "Download is truncated" << m_currentDownloadElement.url << size << "of" << contentLength.toLongLong() << "bytes";
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief Aborts the current download and clears the queue
  */
 void DownloadManager::abortDownloads()
 {
-    qDebug() << "Entered";
+    LOG_DEBUG() << "Entered";
     m_timer.stop();
     m_mutex.lock();
     m_queue.clear();
@@ -262,7 +376,7 @@ int DownloadManager::downloadQueueSize()
  */
 int DownloadManager::downloadsLeftForShow(TvShow *show)
 {
-    qDebug() << "Entered, show=" << show->name();
+    LOG_DEBUG() << "Entered, show=" << show->name();
     int left = 0;
     m_mutex.lock();
     for (int i=0, n=m_queue.count() ; i<n ; ++i) {
@@ -270,6 +384,6 @@ int DownloadManager::downloadsLeftForShow(TvShow *show)
             left++;
     }
     m_mutex.unlock();
-    qDebug() << "Downloads left" << left;
+    LOG_DEBUG() << "Downloads left" << left;
     return left;
 }
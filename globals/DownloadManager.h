@@ -1,6 +1,8 @@
 #ifndef DOWNLOADMANAGER_H
 #define DOWNLOADMANAGER_H
 
+#include <QCryptographicHash>
+#include <QFile>
 #include <QMutex>
 #include <QQueue>
 #include <QObject>
@@ -14,6 +16,9 @@
 
 /**
  * @brief The DownloadManager class
+ *        Images other than actor images are written to a staging file while they are downloaded,
+ *        so the reply is never buffered completely in memory. The MD5 checksum is computed while the data arrives
+ *        and downloads with less (or more) bytes than announced by Content-Length are rejected.
  */
 class DownloadManager : public QObject
 {
@@ -42,6 +47,7 @@ private slots:
     void downloadFinished();
     void startNextDownload();
     void downloadTimeout();
+    void downloadReadyRead();
 
 private:
     QNetworkReply *m_currentReply;
@@ -52,6 +58,12 @@ private:
     QMutex m_mutex;
     QTimer m_timer;
     int m_retries;
+    QFile *m_stagingFile;
+    QCryptographicHash m_hash;
+    qint64 m_bytesStaged;
+    void startStaging();
+    void discardStaging();
+    bool isComplete(qint64 size);
 };
 
 #endif // DOWNLOADMANAGER_H
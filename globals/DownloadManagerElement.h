@@ -1,6 +1,7 @@
 #ifndef DOWNLOADMANAGERELEMENT_H
 #define DOWNLOADMANAGERELEMENT_H
 
+#include "data/StagedImage.h"
 #include "globals/Globals.h"
 
 class Concert;
@@ -10,6 +11,7 @@ class TvShowEpisode;
 
 /**
  * @brief The DownloadManagerElement class
+ *        Actor images are downloaded into data, all other images are streamed to a staged image.
  */
 class DownloadManagerElement
 {
@@ -18,6 +20,7 @@ public:
     int imageType;
     QUrl url;
     QByteArray data;
+    StagedImage image;
     qint64 bytesReceived;
     qint64 bytesTotal;
     Actor *actor;
@@ -18,6 +18,7 @@ namespace Constants {
     const int TvShowWidgetSaveProgressMessageId    = 10004;
     const int ConcertFileSearcherProgressMessageId = 10005;
     const int TvShowUpdaterProgressMessageId       = 10006;
+    const int ConcertWidgetSaveProgressMessageId   = 10007;
     const int MovieProgressMessageId               = 20000;
     const int TvShowProgressMessageId              = 40000;
     const int EpisodeProgressMessageId             = 60000;
@@ -6,14 +6,18 @@
 #include <QDateTimeEdit>
 #include <QDir>
 #include <QDoubleSpinBox>
+#include <QFile>
 #include <QGraphicsDropShadowEffect>
 #include <QLabel>
 #include <QLineEdit>
 #include <QPainter>
+#include <QPixmapCache>
 #include <QPushButton>
 #include <QRegExp>
+#include <QRegularExpression>
 #include <QSpinBox>
 #include <QWidget>
+#include "data/ImageCache.h"
 #include "globals/Globals.h"
 #include "settings/Settings.h"
 
@@ -149,24 +153,24 @@ bool Helper::isBluRay(QString path)
 
 QImage &Helper::resizeBackdrop(QImage &image, bool &resized)
 {
-    resized = false;
-    if ((image.width() != 1920 || image.height() != 1080) &&
-        image.width() > 1915 && image.width() < 1925 && image.height() > 1075 && image.height() < 1085) {
-        image = image.scaled(1920, 1080, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        resized = true;
-    }
-
-    if ((image.width() != 1280 || image.height() != 720) &&
-        image.width() > 1275 && image.width() < 1285 && image.height() > 715 && image.height() < 725) {
-        image = image.scaled(1280, 720, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        resized = true;
-    }
-
+    QSize targetSize = backdropTargetSize(image.size());
+    resized = targetSize.isValid();
+    if (resized)
+        image = image.scaled(targetSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
     return image;
 }
 
+/**
+ * @brief Scales a backdrop which is a few pixels off 1080p or 720p.
+ *        The size is read from the image header, the image is only decoded if it has to be scaled.
+ * @param image Image data
+ * @return Image data
+ */
 QByteArray &Helper::resizeBackdrop(QByteArray &image)
 {
+    if (!backdropTargetSize(ImageCache::probeSize(image)).isValid())
+        return image;
+
     bool resized;
     QImage img = QImage::fromData(image);
     Helper::resizeBackdrop(img, resized);
@@ -177,6 +181,45 @@ QByteArray &Helper::resizeBackdrop(QByteArray &image)
     return image;
 }
 
+/**
+ * @brief Scales a backdrop which is a few pixels off 1080p or 720p.
+ *        A staged image is only read into memory if it has to be scaled.
+ * @param image Image
+ * @return The scaled image or the image itself
+ */
+StagedImage Helper::resizeBackdrop(const StagedImage &image)
+{
+    if (image.isNull())
+        return image;
+
+    QSize size;
+    if (image.stagedFileName().isEmpty()) {
+        size = ImageCache::probeSize(image.data());
+    } else {
+        QFile file(image.stagedFileName());
+        size = ImageCache::probeSize(&file);
+    }
+    if (!backdropTargetSize(size).isValid())
+        return image;
+
+    QByteArray data = image.data();
+    return StagedImage(resizeBackdrop(data));
+}
+
+/**
+ * @brief Returns the size a backdrop should have
+ * @param size Current size of the backdrop
+ * @return 1920x1080 or 1280x720 if the backdrop is a few pixels off, an invalid size otherwise
+ */
+QSize Helper::backdropTargetSize(const QSize &size)
+{
+    if (size != QSize(1920, 1080) && size.width() > 1915 && size.width() < 1925 && size.height() > 1075 && size.height() < 1085)
+        return QSize(1920, 1080);
+    if (size != QSize(1280, 720) && size.width() > 1275 && size.width() < 1285 && size.height() > 715 && size.height() < 725)
+        return QSize(1280, 720);
+    return QSize();
+}
+
 QString &Helper::sanitizeFileName(QString &fileName)
 {
     fileName.replace("/", " ");
@@ -194,31 +237,20 @@ QString &Helper::sanitizeFileName(QString &fileName)
 
 QString Helper::stackedBaseName(const QString &fileName)
 {
-    QString baseName = fileName;
-    QRegExp rx1a("(.*)([ _\\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _\\.-]*[0-9]+)(.*)(\\.[^.]+)$", Qt::CaseInsensitive);
-    QRegExp rx1b("(.*)([ _\\.-]+)$");
-    QRegExp rx2a("(.*)([ _\\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _.-]*[a-d])(.*)(\\.[^.]+)$", Qt::CaseInsensitive);
-    QRegExp rx2b("(.*)([ _\\.-]+)$");
-
-    QList<QList<QRegExp> > regex;
-    regex << (QList<QRegExp>() << rx1a << rx1b);
-    regex << (QList<QRegExp>() << rx2a << rx2b);
-
-    foreach (QList<QRegExp> rx, regex) {
-        if (rx.at(0).indexIn(fileName) != -1) {
-            QString title = rx.at(0).cap(1);
-            QString volume = rx.at(0).cap(2);
-            /*QString ignore = rx.at(0).cap(3);
-            QString extension = rx.at(0).cap(4);*/
-            while (rx.at(1).indexIn(title) != -1) {
-                title = rx.at(1).capturedTexts().at(1);
-                volume.prepend(rx.at(1).capturedTexts().at(2));
-            }
-            return title;
-        }
-    }
-
-    return baseName;
+    // Compiled only once, QRegularExpression can be shared between the threads loading movies
+    static const QRegularExpression rxNumbered("(.*)([ _\\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _\\.-]*[0-9]+)(.*)(\\.[^.]+)$", QRegularExpression::CaseInsensitiveOption);
+    static const QRegularExpression rxLettered("(.*)([ _\\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _.-]*[a-d])(.*)(\\.[^.]+)$", QRegularExpression::CaseInsensitiveOption);
+
+    QRegularExpressionMatch match = rxNumbered.match(fileName);
+    if (!match.hasMatch())
+        match = rxLettered.match(fileName);
+    if (!match.hasMatch())
+        return fileName;
+
+    QString title = match.captured(1);
+    while (!title.isEmpty() && QString(" _.-").contains(title.at(title.length()-1)))
+        title.chop(1);
+    return title;
 }
 
 QString Helper::appendArticle(const QString &text)
@@ -605,3 +637,31 @@ qreal Helper::devicePixelRatio(const QPixmap &pixmap)
     return 1.0;
 #endif
 }
+
+/**
+ * @brief Loads and scales a resource pixmap once, the result is shared through QPixmapCache
+ * @param resource Resource path
+ * @param size Size to scale to (keeping the aspect ratio), a width or height of 0 scales to the other value only,
+ *        an invalid size keeps the original size
+ * @param devicePixelRatio Pixel ratio of the target, the pixmap is scaled to size*devicePixelRatio
+ * @return Scaled pixmap
+ */
+QPixmap Helper::scaledPixmap(const QString &resource, const QSize &size, qreal devicePixelRatio)
+{
+    QString key = QString("scaledPixmap_%1_%2_%3_%4").arg(resource).arg(size.width()).arg(size.height()).arg(devicePixelRatio);
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap))
+        return pixmap;
+
+    pixmap = QPixmap(resource);
+    QSize targetSize = size * devicePixelRatio;
+    if (targetSize.width() > 0 && targetSize.height() > 0)
+        pixmap = pixmap.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    else if (targetSize.width() > 0)
+        pixmap = pixmap.scaledToWidth(targetSize.width(), Qt::SmoothTransformation);
+    else if (targetSize.height() > 0)
+        pixmap = pixmap.scaledToHeight(targetSize.height(), Qt::SmoothTransformation);
+    setDevicePixelRatio(pixmap, devicePixelRatio);
+    QPixmapCache::insert(key, pixmap);
+    return pixmap;
+}
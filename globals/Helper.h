@@ -5,6 +5,7 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QString>
+#include "data/StagedImage.h"
 
 /**
  * @brief Some convenience functions are bundled here
@@ -20,6 +21,8 @@ public:
     static bool isBluRay(QString path);
     static QImage &resizeBackdrop(QImage &image, bool &resized);
     static QByteArray &resizeBackdrop(QByteArray &image);
+    static StagedImage resizeBackdrop(const StagedImage &image);
+    static QSize backdropTargetSize(const QSize &size);
     static QString &sanitizeFileName(QString &fileName);
     static QString stackedBaseName(const QString &fileName);
     static QString appendArticle(const QString &text);
@@ -42,6 +45,7 @@ public:
     static qreal devicePixelRatio(const QPixmap &pixmap);
     static void setDevicePixelRatio(QPixmap &pixmap, qreal devicePixelRatio);
     static void setDevicePixelRatio(QImage &image, qreal devicePixelRatio);
+    static QPixmap scaledPixmap(const QString &resource, const QSize &size = QSize(), qreal devicePixelRatio = 1.0);
 };
 
 #endif // HELPER_H
@@ -12,7 +12,9 @@
 #include <QSize>
 #include <QStandardPaths>
 #include <QTimer>
+#include <QtConcurrent/QtConcurrentRun>
 #include "data/ImageProviderInterface.h"
+#include "data/PreviewCache.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/NameFormatter.h"
@@ -27,6 +29,9 @@ ImageDialog::ImageDialog(QWidget *parent) :
 {
     ui->setupUi(this);
     ui->searchTerm->setType(MyLineEdit::TypeLoading);
+
+    // the preview cache is used from worker threads, create it in the main thread
+    PreviewCache::instance(parent);
     ui->results->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
 
 #ifdef Q_OS_MAC
@@ -60,9 +65,13 @@ ImageDialog::ImageDialog(QWidget *parent) :
     ui->labelSpinner->setMovie(movie);
     clearSearch();
     setImageType(ImageType::MoviePoster);
-    m_currentDownloadReply = 0;
+    m_nextDownloadIndex = 0;
     m_multiSelection = false;
 
+    m_relayoutTimer.setSingleShot(true);
+    m_relayoutTimer.setInterval(100);
+    connect(&m_relayoutTimer, SIGNAL(timeout()), ui->table, SLOT(resizeRowsToContents()));
+
     QPixmap zoomOut(":/img/zoom_out.png");
     QPixmap zoomIn(":/img/zoom_in.png");
     QPainter p;
@@ -279,6 +288,8 @@ void ImageDialog::setDownloads(QList<Poster> downloads, bool initial)
         d.originalUrl = poster.originalUrl;
         d.thumbUrl = poster.thumbUrl;
         d.downloaded = false;
+        d.loading = false;
+        d.cached = false;
         d.resolution = poster.originalSize;
         d.hint = poster.hint;
         if (!poster.language.isEmpty())
@@ -303,57 +314,157 @@ QNetworkAccessManager *ImageDialog::qnam()
 }
 
 /**
- * @brief Starts the next download if there is one
+ * @brief Starts downloads until the maximum number of parallel downloads is reached
+ * Previews which are in the preview cache are loaded from disk instead
  */
 void ImageDialog::startNextDownload()
 {
-    qDebug() << "Entered";
-    int nextIndex = -1;
-    for (int i=0, n=m_elements.size() ; i<n ; i++) {
-        if (!m_elements[i].downloaded) {
-            nextIndex = i;
-            break;
+    int width = (getColumnWidth()-10) * Helper::devicePixelRatio(this);
+    while (m_nextDownloadIndex < m_elements.size()) {
+        DownloadElement &element = m_elements[m_nextDownloadIndex];
+        if (element.downloaded || element.loading) {
+            m_nextDownloadIndex++;
+            continue;
+        }
+
+        if (PreviewCache::instance()->contains(element.thumbUrl, width)) {
+            element.loading = true;
+            startDecoding(m_nextDownloadIndex, QtConcurrent::run(&ImageDialog::loadCachedPreview, element.thumbUrl, width));
+            m_nextDownloadIndex++;
+            continue;
         }
+
+        if (m_downloads.count() >= MaxParallelDownloads)
+            break;
+
+        element.loading = true;
+        QNetworkReply *reply = qnam()->get(QNetworkRequest(element.thumbUrl));
+        m_downloads.insert(reply, m_nextDownloadIndex);
+        connect(reply, SIGNAL(finished()), this, SLOT(downloadFinished()));
+        m_nextDownloadIndex++;
     }
 
-    if (nextIndex == -1) {
+    if (m_downloads.isEmpty() && m_decodings.isEmpty()) {
         ui->labelLoading->setVisible(false);
         ui->labelSpinner->setVisible(false);
-        return;
     }
-
-    m_currentDownloadIndex = nextIndex;
-    m_currentDownloadReply = qnam()->get(QNetworkRequest(m_elements[nextIndex].thumbUrl));
-    connect(m_currentDownloadReply, SIGNAL(finished()), this, SLOT(downloadFinished()));
 }
 
 /**
  * @brief Called when a download has finished
- * Renders the table and displays the downloaded image and starts the next download
+ * Decodes and scales the image in a worker thread and starts the next download
  */
 void ImageDialog::downloadFinished()
 {
-    qDebug() << "Entered";
-    if (m_currentDownloadReply->error() != QNetworkReply::NoError) {
-        qWarning() << "Network Error" << m_currentDownloadReply->errorString();
+    QNetworkReply *reply = static_cast<QNetworkReply*>(QObject::sender());
+    reply->deleteLater();
+    if (!m_downloads.contains(reply))
+        return;
+
+    int index = m_downloads.take(reply);
+    if (reply->error() != QNetworkReply::NoError) {
+        qWarning() << "Network Error" << reply->errorString();
+        m_elements[index].loading = false;
+        m_elements[index].downloaded = true;
         startNextDownload();
         return;
     }
 
-    m_elements[m_currentDownloadIndex].pixmap.loadFromData(m_currentDownloadReply->readAll());
-    Helper::setDevicePixelRatio(m_elements[m_currentDownloadIndex].pixmap, Helper::devicePixelRatio(this));
-    if (!m_elements[m_currentDownloadIndex].pixmap.isNull()) {
-        m_elements[m_currentDownloadIndex].scaledPixmap = m_elements[m_currentDownloadIndex].pixmap.scaledToWidth((getColumnWidth()-10) * Helper::devicePixelRatio(this), Qt::SmoothTransformation);
-        Helper::setDevicePixelRatio(m_elements[m_currentDownloadIndex].scaledPixmap, Helper::devicePixelRatio(this));
-        m_elements[m_currentDownloadIndex].cellWidget->setImage(m_elements[m_currentDownloadIndex].scaledPixmap);
-        m_elements[m_currentDownloadIndex].cellWidget->setHint(m_elements[m_currentDownloadIndex].resolution, m_elements[m_currentDownloadIndex].hint);
+    int width = (getColumnWidth()-10) * Helper::devicePixelRatio(this);
+    startDecoding(index, QtConcurrent::run(&ImageDialog::decodePreview, m_elements[index].thumbUrl, reply->readAll(), width));
+    startNextDownload();
+}
+
+/**
+ * @brief Watches a decoding job which runs in a worker thread
+ * @param index Index of the element
+ * @param future Result of the job
+ */
+void ImageDialog::startDecoding(int index, QFuture<PreviewImage> future)
+{
+    QFutureWatcher<PreviewImage> *watcher = new QFutureWatcher<PreviewImage>(this);
+    m_decodings.insert(watcher, index);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onPreviewDecoded()));
+    watcher->setFuture(future);
+}
+
+/**
+ * @brief Called when a downloaded image was decoded and scaled or a preview was loaded from the cache
+ * Displays the image, the table rows are resized in batches
+ */
+void ImageDialog::onPreviewDecoded()
+{
+    QFutureWatcher<PreviewImage> *watcher = static_cast<QFutureWatcher<PreviewImage>*>(QObject::sender());
+    watcher->deleteLater();
+    if (!m_decodings.contains(watcher))
+        return;
+
+    int index = m_decodings.take(watcher);
+    PreviewImage preview = watcher->result();
+    DownloadElement &element = m_elements[index];
+    element.loading = false;
+    if (preview.cached && preview.image.isNull()) {
+        // preview was removed from the cache in the meantime, download the image
+        m_nextDownloadIndex = qMin(m_nextDownloadIndex, index);
+        startNextDownload();
+        return;
+    }
+
+    element.downloaded = true;
+    element.cached = preview.cached;
+    if (!preview.image.isNull()) {
+        qreal ratio = Helper::devicePixelRatio(this);
+        int width = (getColumnWidth()-10) * ratio;
+        element.pixmap = QPixmap::fromImage(preview.image);
+        Helper::setDevicePixelRatio(element.pixmap, ratio);
+        if (preview.scaled.width() == width)
+            element.scaledPixmap = QPixmap::fromImage(preview.scaled);
+        else
+            element.scaledPixmap = element.pixmap.scaledToWidth(width, Qt::SmoothTransformation);
+        Helper::setDevicePixelRatio(element.scaledPixmap, ratio);
+        element.cellWidget->setImage(element.scaledPixmap);
+        element.cellWidget->setHint(element.resolution, element.hint);
+        if (!m_relayoutTimer.isActive())
+            m_relayoutTimer.start();
     }
-    ui->table->resizeRowsToContents();
-    m_elements[m_currentDownloadIndex].downloaded = true;
-    m_currentDownloadReply->deleteLater();
     startNextDownload();
 }
 
+/**
+ * @brief Decodes an image, scales it to the given width and stores the preview in the preview cache.
+ *        Called in a worker thread.
+ * @param url Url of the image
+ * @param data Image data
+ * @param width Width of the preview
+ * @return Decoded and scaled image
+ */
+ImageDialog::PreviewImage ImageDialog::decodePreview(QUrl url, QByteArray data, int width)
+{
+    PreviewImage preview;
+    preview.cached = false;
+    preview.image.loadFromData(data);
+    if (!preview.image.isNull() && width > 0) {
+        preview.scaled = preview.image.scaledToWidth(width, Qt::SmoothTransformation);
+        PreviewCache::instance()->insert(url, width, preview.scaled);
+    }
+    return preview;
+}
+
+/**
+ * @brief Loads a preview from the preview cache, called in a worker thread
+ * @param url Url of the image
+ * @param width Width of the preview
+ * @return Cached preview, a null image if it was removed from the cache
+ */
+ImageDialog::PreviewImage ImageDialog::loadCachedPreview(QUrl url, int width)
+{
+    PreviewImage preview;
+    preview.cached = true;
+    preview.image = PreviewCache::instance()->image(url, width);
+    preview.scaled = preview.image;
+    return preview;
+}
+
 /**
  * @brief Renders the table
  */
@@ -367,6 +478,8 @@ void ImageDialog::renderTable()
     for (int i=0, n=ui->table->columnCount() ; i<n ; i++)
         ui->table->setColumnWidth(i, getColumnWidth());
 
+    int width = (getColumnWidth()-10) * Helper::devicePixelRatio(this);
+    bool reload = false;
     for (int i=0, n=m_elements.size() ; i<n ; i++) {
         int row = (i-(i%cols))/cols;
         if (i%cols == 0)
@@ -374,10 +487,20 @@ void ImageDialog::renderTable()
         QTableWidgetItem *item = new QTableWidgetItem;
         item->setData(Qt::UserRole, m_elements[i].originalUrl);
         ImageLabel *label = new ImageLabel(ui->table);
+        if (m_elements[i].cached && m_elements[i].pixmap.width() < width) {
+            // the cached preview is too small for the new size, load the image again
+            m_elements[i].cached = false;
+            m_elements[i].downloaded = false;
+            m_elements[i].pixmap = QPixmap();
+            m_nextDownloadIndex = qMin(m_nextDownloadIndex, i);
+            reload = true;
+        }
         if (!m_elements[i].pixmap.isNull()) {
-            QPixmap pixmap = m_elements[i].pixmap.scaledToWidth((getColumnWidth()-10) * Helper::devicePixelRatio(this), Qt::SmoothTransformation);
-            Helper::setDevicePixelRatio(pixmap, Helper::devicePixelRatio(this));
-            label->setImage(pixmap);
+            if (m_elements[i].scaledPixmap.width() != width) {
+                m_elements[i].scaledPixmap = m_elements[i].pixmap.scaledToWidth(width, Qt::SmoothTransformation);
+                Helper::setDevicePixelRatio(m_elements[i].scaledPixmap, Helper::devicePixelRatio(this));
+            }
+            label->setImage(m_elements[i].scaledPixmap);
             label->setHint(m_elements[i].resolution, m_elements[i].hint);
         }
         m_elements[i].cellWidget = label;
@@ -385,6 +508,12 @@ void ImageDialog::renderTable()
         ui->table->setCellWidget(row, i%cols, label);
         ui->table->resizeRowToContents(row);
     }
+
+    if (reload) {
+        ui->labelLoading->setVisible(true);
+        ui->labelSpinner->setVisible(true);
+        startNextDownload();
+    }
 }
 
 /**
@@ -502,16 +631,14 @@ void ImageDialog::cancelDownloads()
     qDebug() << "Entered";
     ui->labelLoading->setVisible(false);
     ui->labelSpinner->setVisible(false);
-    bool running = false;
-    foreach (const DownloadElement &d, m_elements) {
-        if (!d.downloaded) {
-            running = true;
-            break;
-        }
-    }
+    QList<QNetworkReply*> replies = m_downloads.keys();
+    m_downloads.clear();
+    m_decodings.clear();
+    m_relayoutTimer.stop();
     m_elements.clear();
-    if (running)
-        m_currentDownloadReply->abort();
+    m_nextDownloadIndex = 0;
+    foreach (QNetworkReply *reply, replies)
+        reply->abort();
 }
 
 /**
@@ -535,6 +662,8 @@ void ImageDialog::chooseLocalImage()
         d.originalUrl = fileName;
         d.thumbUrl = fileName;
         d.downloaded = false;
+        d.loading = false;
+        d.cached = false;
         m_elements.append(d);
         renderTable();
         m_elements[index].pixmap = QPixmap(fileName);
@@ -572,6 +701,8 @@ void ImageDialog::onImageDropped(QUrl url)
     d.originalUrl = url;
     d.thumbUrl = url;
     d.downloaded = false;
+    d.loading = false;
+    d.cached = false;
     m_elements.append(d);
     renderTable();
     if (url.toString().startsWith("file://")) {
@@ -2,6 +2,9 @@
 #define IMAGEDIALOG_H
 
 #include <QDialog>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
 #include <QLabel>
 #include <QTableWidgetItem>
 #include <QUrl>
@@ -9,6 +12,7 @@
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
 #include <QResizeEvent>
+#include <QTimer>
 
 #include "data/ImageProviderInterface.h"
 #include "data/Concert.h"
@@ -60,6 +64,7 @@ protected:
 private slots:
     void downloadFinished();
     void startNextDownload();
+    void onPreviewDecoded();
     void imageClicked(int row, int col);
     void chooseLocalImage();
     void onImageDropped(QUrl url);
@@ -85,14 +90,30 @@ private:
         QPixmap pixmap;
         QPixmap scaledPixmap;
         bool downloaded;
+        bool loading;
+        bool cached;
         ImageLabel *cellWidget;
         QSize resolution;
         QString hint;
     };
 
+    /**
+     * @brief A downloaded image and its preview, decoded in a worker thread
+     * If cached is true the image was loaded from the preview cache
+     */
+    struct PreviewImage {
+        QImage image;
+        QImage scaled;
+        bool cached;
+    };
+
+    static const int MaxParallelDownloads = 4;
+
     QNetworkAccessManager m_qnam;
-    int m_currentDownloadIndex;
-    QNetworkReply *m_currentDownloadReply;
+    int m_nextDownloadIndex;
+    QHash<QNetworkReply*, int> m_downloads;
+    QHash<QFutureWatcher<PreviewImage>*, int> m_decodings;
+    QTimer m_relayoutTimer;
     int m_imageType;
     QList<DownloadElement> m_elements;
     QUrl m_imageUrl;
@@ -117,6 +138,9 @@ private:
     void loadImagesFromProvider(QString id);
     void clearSearch();
     QString formatSearchText(const QString &text);
+    void startDecoding(int index, QFuture<PreviewImage> future);
+    static PreviewImage decodePreview(QUrl url, QByteArray data, int width);
+    static PreviewImage loadCachedPreview(QUrl url, int width);
 };
 
 #endif // IMAGEDIALOG_H
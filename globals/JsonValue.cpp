@@ -0,0 +1,188 @@
+#include "JsonValue.h"
+
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtCore/qmath.h>
+
+/**
+ * @brief Constructs an invalid value
+ */
+JsonValue::JsonValue() :
+    m_value(QJsonValue::Undefined)
+{
+}
+
+/**
+ * @brief JsonValue::JsonValue
+ * @param value
+ */
+JsonValue::JsonValue(const QJsonValue &value) :
+    m_value(value)
+{
+}
+
+/**
+ * @brief Parses a JSON document
+ * @param json JSON data (UTF-8)
+ * @return Root value, invalid if the data could not be parsed
+ */
+JsonValue JsonValue::parse(const QByteArray &json)
+{
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+    if (error.error != QJsonParseError::NoError) {
+        qWarning() << "Could not parse JSON:" << error.errorString() << "at offset" << error.offset;
+        return JsonValue();
+    }
+    if (doc.isArray())
+        return JsonValue(QJsonValue(doc.array()));
+    return JsonValue(QJsonValue(doc.object()));
+}
+
+/**
+ * @brief Parses a JSON document
+ * @param json JSON data
+ * @return Root value, invalid if the data could not be parsed
+ */
+JsonValue JsonValue::parse(const QString &json)
+{
+    return parse(json.toUtf8());
+}
+
+/**
+ * @brief Checks if the value exists
+ * @return False for missing properties
+ */
+bool JsonValue::isValid() const
+{
+    return !m_value.isUndefined();
+}
+
+bool JsonValue::isNull() const
+{
+    return m_value.isNull();
+}
+
+bool JsonValue::isArray() const
+{
+    return m_value.isArray();
+}
+
+bool JsonValue::isObject() const
+{
+    return m_value.isObject();
+}
+
+/**
+ * @brief Returns a property of an object
+ * @param name Name of the property
+ * @return Value of the property, invalid if this is not an object or the property does not exist
+ */
+JsonValue JsonValue::property(const QString &name) const
+{
+    if (!m_value.isObject())
+        return JsonValue();
+    return JsonValue(m_value.toObject().value(name));
+}
+
+/**
+ * @brief Returns the elements of an array or the property values of an object
+ * @return List of values
+ */
+QList<JsonValue> JsonValue::elements() const
+{
+    QList<JsonValue> elements;
+    if (m_value.isArray()) {
+        foreach (const QJsonValue &value, m_value.toArray())
+            elements.append(JsonValue(value));
+    } else if (m_value.isObject()) {
+        QJsonObject object = m_value.toObject();
+        for (QJsonObject::const_iterator it = object.constBegin(), end = object.constEnd() ; it != end ; ++it)
+            elements.append(JsonValue(it.value()));
+    }
+    return elements;
+}
+
+/**
+ * @brief Returns the property names of an object
+ * @return List of property names
+ */
+QStringList JsonValue::keys() const
+{
+    if (!m_value.isObject())
+        return QStringList();
+    return m_value.toObject().keys();
+}
+
+/**
+ * @brief Converts the value to a string
+ *        Integral numbers are returned without decimals, e.g. ids
+ * @return String, empty for null, missing values, arrays and objects
+ */
+QString JsonValue::toString() const
+{
+    switch (m_value.type()) {
+    case QJsonValue::String:
+        return m_value.toString();
+    case QJsonValue::Double: {
+        double number = m_value.toDouble();
+        if (number == qFloor(number) && qAbs(number) < 1e15)
+            return QString::number(static_cast<qint64>(number));
+        return QString::number(number, 'g', 15);
+    }
+    case QJsonValue::Bool:
+        return m_value.toBool() ? "true" : "false";
+    default:
+        return QString();
+    }
+}
+
+/**
+ * @brief Converts the value to an integer, strings are parsed
+ * @return Integer, 0 if the value can not be converted
+ */
+qint64 JsonValue::toInteger() const
+{
+    return static_cast<qint64>(toNumber());
+}
+
+/**
+ * @brief Converts the value to a number, strings are parsed
+ * @return Number, 0 if the value can not be converted
+ */
+qreal JsonValue::toNumber() const
+{
+    switch (m_value.type()) {
+    case QJsonValue::Double:
+        return m_value.toDouble();
+    case QJsonValue::String:
+        return m_value.toString().trimmed().toDouble();
+    case QJsonValue::Bool:
+        return m_value.toBool() ? 1 : 0;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Converts the value to a bool
+ * @return Bool
+ */
+bool JsonValue::toBool() const
+{
+    switch (m_value.type()) {
+    case QJsonValue::Bool:
+        return m_value.toBool();
+    case QJsonValue::Double:
+        return m_value.toDouble() != 0;
+    case QJsonValue::String:
+        return !m_value.toString().isEmpty();
+    case QJsonValue::Array:
+    case QJsonValue::Object:
+        return true;
+    default:
+        return false;
+    }
+}
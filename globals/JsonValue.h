@@ -0,0 +1,40 @@
+#ifndef JSONVALUE_H
+#define JSONVALUE_H
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The JsonValue class
+ *        Read-only wrapper around QJsonValue used by the scrapers and image providers.
+ *        Accessing missing properties is always safe and conversions behave like
+ *        JavaScript (numbers can be read as strings and vice versa).
+ */
+class JsonValue
+{
+public:
+    JsonValue();
+    explicit JsonValue(const QJsonValue &value);
+    static JsonValue parse(const QByteArray &json);
+    static JsonValue parse(const QString &json);
+
+    bool isValid() const;
+    bool isNull() const;
+    bool isArray() const;
+    bool isObject() const;
+    JsonValue property(const QString &name) const;
+    QList<JsonValue> elements() const;
+    QStringList keys() const;
+    QString toString() const;
+    qint64 toInteger() const;
+    qreal toNumber() const;
+    bool toBool() const;
+
+private:
+    QJsonValue m_value;
+};
+
+#endif // JSONVALUE_H
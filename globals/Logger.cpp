@@ -0,0 +1,337 @@
+#include "Logger.h"
+
+#include <QMutexLocker>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+Logger::Logger(QObject *parent) :
+    QThread(parent),
+    m_enqueuePos(0),
+    m_dequeuePos(0),
+    m_dropped(0),
+    m_running(0),
+    m_defaultLevel(LevelDebug),
+    m_writeMutex(QMutex::Recursive)
+{
+    for (int i=0 ; i<BufferSize ; ++i)
+        m_slots[i].sequence.store(i);
+}
+
+Logger::~Logger()
+{
+    stop();
+}
+
+/**
+ * @brief Returns an instance of the logger
+ * @param parent Parent object
+ * @return Instance of the logger
+ */
+Logger *Logger::instance(QObject *parent)
+{
+    static Logger *m_instance = 0;
+    if (!m_instance)
+        m_instance = new Logger(parent);
+    return m_instance;
+}
+
+/**
+ * @brief Opens the log file, messages are written to stderr if no log file is set.
+ *        Has to be called before the logger is started.
+ * @param fileName Path to the log file
+ * @return True if the file could be opened
+ */
+bool Logger::setLogFile(const QString &fileName)
+{
+    m_file.setFileName(fileName);
+    return m_file.open(QFile::WriteOnly | QFile::Truncate);
+}
+
+/**
+ * @brief Sets the minimum level (debug, warning, critical, off) of messages per class.
+ *        The class "*" sets the level for all other messages.
+ *        Has to be called before the logger is started.
+ * @param levels Map of class names to level names
+ */
+void Logger::setCategoryLevels(const QHash<QString, QString> &levels)
+{
+    m_categoryLevels.clear();
+    m_defaultLevel = LevelDebug;
+    QHashIterator<QString, QString> it(levels);
+    while (it.hasNext()) {
+        it.next();
+        if (it.key() == "*")
+            m_defaultLevel = level(it.value());
+        else
+            m_categoryLevels.insert(it.key().toLatin1(), level(it.value()));
+    }
+}
+
+/**
+ * @brief Queues a message, called by the Qt message handler from any thread
+ *        Fatal messages are written immediately and abort the application.
+ * @param type Type of the message
+ * @param context Context of the message
+ * @param msg Message
+ */
+void Logger::log(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    if (!isEnabled(type, context.function))
+        return;
+
+    Message message;
+    message.type = type;
+    message.function = context.function;
+    message.text = msg;
+
+    if (type == QtFatalMsg)
+        stop();
+
+    if (!m_running.load()) {
+        QMutexLocker locker(&m_writeMutex);
+        write(message);
+        if (m_file.isOpen())
+            m_file.flush();
+        else
+            fflush(stderr);
+        if (type == QtFatalMsg)
+            abort();
+        return;
+    }
+
+    if (!enqueue(message))
+        return;
+
+    // the logger may have been stopped after the check above, don't leave the message in the buffer
+    if (!m_running.load()) {
+        flush();
+        return;
+    }
+
+    if (type != QtDebugMsg)
+        m_waitCondition.wakeOne();
+}
+
+/**
+ * @brief Starts the background thread, messages logged before are written immediately
+ */
+void Logger::startWriting()
+{
+    if (!m_running.testAndSetOrdered(0, 1))
+        return;
+    start(QThread::LowPriority);
+}
+
+/**
+ * @brief Writes all queued messages and stops the background thread
+ *        Messages logged afterwards are written immediately.
+ *        When called from the background thread itself (e.g. a fatal message while writing) it does not wait for it.
+ */
+void Logger::stop()
+{
+    if (!m_running.testAndSetOrdered(1, 0))
+        return;
+    m_waitCondition.wakeOne();
+    if (QThread::currentThread() != this)
+        wait();
+    flush();
+}
+
+void Logger::run()
+{
+    while (m_running.load()) {
+        flush();
+        m_waitMutex.lock();
+        m_waitCondition.wait(&m_waitMutex, 100);
+        m_waitMutex.unlock();
+    }
+    flush();
+}
+
+/**
+ * @brief Checks if messages of this type from this function should be logged, may be called from any thread
+ * @param type Type of the message
+ * @param function Function which logged the message, only set in debug builds for plain qDebug
+ * @return True if the message should be logged
+ */
+bool Logger::isEnabled(QtMsgType type, const char *function) const
+{
+    if (type == QtFatalMsg)
+        return true;
+    if (m_categoryLevels.isEmpty() || !function)
+        return level(type) >= m_defaultLevel;
+
+    // "void MovieFileSearcher::scanDir(QString, ...)" belongs to MovieFileSearcher
+    const char *end = strchr(function, '(');
+    if (!end)
+        end = function + strlen(function);
+    const char *separator = 0;
+    for (const char *c=function ; c+1<end ; ++c) {
+        if (c[0] == ':' && c[1] == ':')
+            separator = c;
+    }
+    if (!separator)
+        return level(type) >= m_defaultLevel;
+    const char *begin = separator;
+    while (begin > function && begin[-1] != ' ' && begin[-1] != '*' && begin[-1] != '&' && begin[-1] != ':')
+        --begin;
+
+    QHash<QByteArray, int>::const_iterator it = m_categoryLevels.constFind(QByteArray::fromRawData(begin, separator-begin));
+    if (it == m_categoryLevels.constEnd())
+        return level(type) >= m_defaultLevel;
+    return level(type) >= it.value();
+}
+
+/**
+ * @brief Stores a message in the ring buffer, may be called from multiple threads
+ *        Debug messages are dropped if the buffer is full, other messages wait for free space.
+ * @param message Message to store
+ * @return True if the message was stored
+ */
+bool Logger::enqueue(const Message &message)
+{
+    int pos = m_enqueuePos.load();
+    Slot *slot;
+    forever {
+        slot = &m_slots[pos & (BufferSize-1)];
+        int diff = static_cast<int>(static_cast<uint>(slot->sequence.loadAcquire()) - static_cast<uint>(pos));
+        if (diff == 0) {
+            if (m_enqueuePos.testAndSetRelaxed(pos, pos+1))
+                break;
+            pos = m_enqueuePos.load();
+        } else if (diff < 0) {
+            // buffer is full
+            if (message.type == QtDebugMsg) {
+                m_dropped.ref();
+                return false;
+            }
+            m_waitCondition.wakeOne();
+            QThread::yieldCurrentThread();
+            pos = m_enqueuePos.load();
+        } else {
+            pos = m_enqueuePos.load();
+        }
+    }
+
+    slot->message = message;
+    slot->sequence.storeRelease(pos+1);
+
+    // wake the writer regularly if many messages are logged at once
+    if ((pos & (BufferSize/4-1)) == 0)
+        m_waitCondition.wakeOne();
+    return true;
+}
+
+/**
+ * @brief Takes the oldest message from the ring buffer, only called by one thread at a time
+ * @param message Taken message
+ * @return False if the buffer is empty
+ */
+bool Logger::dequeue(Message &message)
+{
+    Slot *slot = &m_slots[m_dequeuePos & (BufferSize-1)];
+    if (slot->sequence.loadAcquire() != m_dequeuePos+1)
+        return false;
+    message = slot->message;
+    slot->message.text.clear();
+    slot->sequence.storeRelease(m_dequeuePos+BufferSize);
+    m_dequeuePos++;
+    return true;
+}
+
+/**
+ * @brief Writes all queued messages, the write mutex allows only one thread at a time
+ */
+void Logger::flush()
+{
+    QMutexLocker locker(&m_writeMutex);
+    bool written = false;
+    Message message;
+    while (dequeue(message)) {
+        write(message);
+        written = true;
+    }
+
+    int dropped = m_dropped.fetchAndStoreOrdered(0);
+    if (dropped > 0) {
+        writeLine(QString("WARNING: %1 debug messages were dropped").arg(dropped));
+        written = true;
+    }
+
+    if (written) {
+        if (m_file.isOpen())
+            m_file.flush();
+        else
+            fflush(stderr);
+    }
+}
+
+/**
+ * @brief Formats and writes a message
+ * @param message Message to write
+ */
+void Logger::write(const Message &message)
+{
+    QString f = QString("%1").arg(message.function, -70, QChar(' '));
+    QString prefix;
+    switch (message.type) {
+    case QtWarningMsg:
+        prefix = "WARNING: ";
+        break;
+    case QtCriticalMsg:
+        prefix = "CRITICAL: ";
+        break;
+    case QtFatalMsg:
+        prefix = "FATAL: ";
+        break;
+    default:
+        break;
+    }
+
+    if (m_file.isOpen())
+        writeLine("[" + f + "] " + prefix + message.text);
+    else
+        writeLine(f + " " + prefix + message.text);
+}
+
+void Logger::writeLine(const QString &line)
+{
+#ifdef Q_OS_WIN32
+    QByteArray data = (line + "\r\n").toLocal8Bit();
+#else
+    QByteArray data = (line + "\n").toLocal8Bit();
+#endif
+    if (m_file.isOpen())
+        m_file.write(data);
+    else
+        fputs(data.constData(), stderr);
+}
+
+int Logger::level(QtMsgType type)
+{
+    switch (type) {
+    case QtDebugMsg:
+        return LevelDebug;
+    case QtWarningMsg:
+        return LevelWarning;
+    case QtCriticalMsg:
+        return LevelCritical;
+    case QtFatalMsg:
+        return LevelFatal;
+    default:
+        return LevelDebug;
+    }
+}
+
+int Logger::level(const QString &name)
+{
+    QString n = name.trimmed().toLower();
+    if (n == "warning")
+        return LevelWarning;
+    if (n == "critical")
+        return LevelCritical;
+    if (n == "off")
+        return LevelOff;
+    return LevelDebug;
+}
@@ -0,0 +1,91 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QDebug>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+
+/**
+ * @brief Like qDebug(), but the message is only built if debug messages of the calling class are enabled.
+ *        Plain qDebug() formats the whole message before the logger can drop it, use this in frequently called code.
+ */
+#define LOG_DEBUG() \
+    for (bool logEnabled = Logger::instance()->isEnabled(QtDebugMsg, Q_FUNC_INFO) ; logEnabled ; logEnabled = false) \
+        qDebug()
+
+/**
+ * @brief The Logger class
+ *        Writes the messages of the Qt message handler to the log file or stderr in a background thread.
+ *        Messages are passed through a lock free ring buffer, the logging thread only checks
+ *        the level of the message and stores it. Writing happens in the background.
+ *        Levels can be set per class, the class is taken from the function which logged the message.
+ *        Messages of disabled classes are dropped by the message handler after Qt has built them,
+ *        LOG_DEBUG checks the level before the message is built.
+ */
+class Logger : public QThread
+{
+    Q_OBJECT
+public:
+    explicit Logger(QObject *parent = 0);
+    ~Logger();
+    static Logger *instance(QObject *parent = 0);
+    bool setLogFile(const QString &fileName);
+    void setCategoryLevels(const QHash<QString, QString> &levels);
+    void log(QtMsgType type, const QMessageLogContext &context, const QString &msg);
+    bool isEnabled(QtMsgType type, const char *function) const;
+    void startWriting();
+    void stop();
+
+protected:
+    void run();
+
+private:
+    struct Message {
+        QtMsgType type;
+        const char *function;
+        QString text;
+    };
+
+    struct Slot {
+        QAtomicInt sequence;
+        Message message;
+    };
+
+    enum Level {
+        LevelDebug = 0,
+        LevelWarning,
+        LevelCritical,
+        LevelFatal,
+        LevelOff
+    };
+
+    static const int BufferSize = 8192;
+
+    Slot m_slots[BufferSize];
+    QAtomicInt m_enqueuePos;
+    int m_dequeuePos;
+    QAtomicInt m_dropped;
+    QAtomicInt m_running;
+    int m_defaultLevel;
+    QHash<QByteArray, int> m_categoryLevels;
+    QFile m_file;
+    QMutex m_writeMutex;
+    QMutex m_waitMutex;
+    QWaitCondition m_waitCondition;
+
+    bool enqueue(const Message &message);
+    bool dequeue(Message &message);
+    void flush();
+    void write(const Message &message);
+    void writeLine(const QString &line);
+    static int level(QtMsgType type);
+    static int level(const QString &name);
+};
+
+#endif // LOGGER_H
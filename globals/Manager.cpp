@@ -4,6 +4,7 @@
 #include <QDesktopServices>
 #include <QSqlQuery>
 #include "globals/Globals.h"
+#include "globals/Tracer.h"
 #include "imageProviders/FanartTv.h"
 #include "imageProviders/FanartTvMusicArtists.h"
 #include "imageProviders/MediaPassionImages.h"
@@ -32,6 +33,7 @@
 Manager::Manager(QObject *parent) :
     QObject(parent)
 {
+    ScopedTrace trace("Manager::Manager");
     m_scrapers.append(Manager::constructNativeScrapers(this));
     m_scrapers.append(CustomMovieScraper::instance(this));
     m_scrapers.append(new AEBN(parent));
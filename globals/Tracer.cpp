@@ -0,0 +1,178 @@
+#include "Tracer.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+
+Tracer::Tracer(QObject *parent) :
+    QObject(parent),
+    m_enabled(false)
+{
+    m_timer.start();
+}
+
+/**
+ * @brief Returns an instance of the tracer, the first call starts the clock
+ * @param parent Parent object
+ * @return Instance of the tracer
+ */
+Tracer *Tracer::instance(QObject *parent)
+{
+    static Tracer *m_instance = 0;
+    if (!m_instance)
+        m_instance = new Tracer(parent);
+    return m_instance;
+}
+
+/**
+ * @brief Enables tracing, events added before are dropped.
+ *        Has to be called before other threads add events.
+ * @param fileName File the trace is written to, tracing is disabled if empty
+ */
+void Tracer::setFileName(const QString &fileName)
+{
+    m_fileName = fileName;
+    m_enabled = !fileName.isEmpty();
+}
+
+/**
+ * @brief Checks if events are collected
+ * @return True if a trace file is set
+ */
+bool Tracer::isEnabled() const
+{
+    return m_enabled;
+}
+
+/**
+ * @brief Returns the time since the tracer was created
+ * @return Elapsed time in microseconds
+ */
+qint64 Tracer::elapsed() const
+{
+    return m_timer.nsecsElapsed()/1000;
+}
+
+/**
+ * @brief Adds an event which lasted for a duration, may be called from any thread
+ * @param name Name of the event, has to be a string literal
+ * @param start Start time in microseconds
+ * @param duration Duration in microseconds
+ */
+void Tracer::addEvent(const char *name, qint64 start, qint64 duration)
+{
+    if (!m_enabled)
+        return;
+
+    QMutexLocker locker(&m_mutex);
+    Event event;
+    event.name = name;
+    event.start = start;
+    event.duration = duration;
+    event.thread = threadNumber();
+    m_events.append(event);
+}
+
+/**
+ * @brief Adds an event without duration at the current time, may be called from any thread
+ * @param name Name of the event, has to be a string literal
+ */
+void Tracer::addInstantEvent(const char *name)
+{
+    addEvent(name, elapsed(), -1);
+}
+
+void Tracer::onEventLoopStarted()
+{
+    addInstantEvent("Event loop started");
+}
+
+/**
+ * @brief Writes all events to the trace file
+ * @return True if the file was written
+ */
+bool Tracer::save()
+{
+    if (!m_enabled)
+        return false;
+
+    QMutexLocker locker(&m_mutex);
+    QJsonArray events;
+    foreach (const Event &event, m_events) {
+        QJsonObject obj;
+        obj.insert("name", QString::fromLatin1(event.name));
+        obj.insert("cat", QString("startup"));
+        obj.insert("pid", 1);
+        obj.insert("tid", event.thread);
+        obj.insert("ts", static_cast<double>(event.start));
+        if (event.duration < 0) {
+            obj.insert("ph", QString("i"));
+            obj.insert("s", QString("g"));
+        } else {
+            obj.insert("ph", QString("X"));
+            obj.insert("dur", static_cast<double>(event.duration));
+        }
+        events.append(obj);
+    }
+
+    QHashIterator<quintptr, int> it(m_threads);
+    while (it.hasNext()) {
+        it.next();
+        QJsonObject args;
+        args.insert("name", it.value() == 0 ? QString("Main thread") : QString("Thread %1").arg(it.value()));
+        QJsonObject obj;
+        obj.insert("name", QString("thread_name"));
+        obj.insert("ph", QString("M"));
+        obj.insert("pid", 1);
+        obj.insert("tid", it.value());
+        obj.insert("args", args);
+        events.append(obj);
+    }
+
+    QJsonObject trace;
+    trace.insert("traceEvents", events);
+    trace.insert("displayTimeUnit", QString("ms"));
+
+    QFile file(m_fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        qWarning() << "Could not write trace file" << m_fileName;
+        return false;
+    }
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+    file.close();
+    qDebug() << "Wrote" << m_events.count() << "trace events to" << m_fileName;
+    return true;
+}
+
+/**
+ * @brief Returns a small number for the current thread, the main thread is 0.
+ *        Has to be called with the mutex locked.
+ * @return Number of the thread
+ */
+int Tracer::threadNumber()
+{
+    quintptr id = reinterpret_cast<quintptr>(QThread::currentThreadId());
+    QHash<quintptr, int>::const_iterator it = m_threads.constFind(id);
+    if (it != m_threads.constEnd())
+        return it.value();
+    int number = (QThread::currentThread() == thread()) ? 0 : m_threads.count() + 1;
+    m_threads.insert(id, number);
+    return number;
+}
+
+ScopedTrace::ScopedTrace(const char *name) :
+    m_name(name),
+    m_start(Tracer::instance()->isEnabled() ? Tracer::instance()->elapsed() : 0)
+{
+}
+
+ScopedTrace::~ScopedTrace()
+{
+    Tracer *tracer = Tracer::instance();
+    if (tracer->isEnabled())
+        tracer->addEvent(m_name, m_start, tracer->elapsed() - m_start);
+}
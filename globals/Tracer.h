@@ -0,0 +1,67 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+
+/**
+ * @brief The Tracer class
+ *        Collects the durations of startup phases and writes them as a Chrome trace
+ *        (chrome://tracing, JSON object format) when a trace file is set.
+ *        Times are measured relative to the first call of instance.
+ */
+class Tracer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit Tracer(QObject *parent = 0);
+    static Tracer *instance(QObject *parent = 0);
+    void setFileName(const QString &fileName);
+    bool isEnabled() const;
+    qint64 elapsed() const;
+    void addEvent(const char *name, qint64 start, qint64 duration);
+    void addInstantEvent(const char *name);
+    bool save();
+
+public slots:
+    void onEventLoopStarted();
+
+private:
+    struct Event {
+        const char *name;
+        qint64 start;
+        qint64 duration;
+        int thread;
+    };
+
+    QElapsedTimer m_timer;
+    QString m_fileName;
+    bool m_enabled;
+    QList<Event> m_events;
+    QHash<quintptr, int> m_threads;
+    QMutex m_mutex;
+
+    int threadNumber();
+};
+
+/**
+ * @brief The ScopedTrace class
+ *        Adds an event with the lifetime of the object to the tracer.
+ *        The name has to be a string literal.
+ */
+class ScopedTrace
+{
+public:
+    explicit ScopedTrace(const char *name);
+    ~ScopedTrace();
+
+private:
+    const char *m_name;
+    qint64 m_start;
+};
+
+#endif // TRACER_H
@@ -3,10 +3,8 @@
 #include <QGridLayout>
 #include <QLabel>
 #include <QSettings>
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include "data/Storage.h"
+#include "globals/JsonValue.h"
 #include "main/MainWindow.h"
 #include "scrapers/TMDb.h"
 
@@ -391,20 +389,12 @@ QList<Poster> FanartTv::parseMovieData(QString json, int type)
     map.insert(ImageType::ConcertClearArt, QStringList() << "hdmovieclearart" << "movieart");
     map.insert(ImageType::ConcertCdArt, QStringList() << "moviedisc");
     QList<Poster> posters;
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
-
-    QScriptValueIterator it(sc);
-    while (it.hasNext()) {
-        it.next();
-        QScriptValue v = it.value();
+    JsonValue sc = JsonValue::parse(json);
+
+    foreach (const JsonValue &v, sc.elements()) {
         foreach (const QString &section, map.value(type)) {
             if (v.property(section).isArray()) {
-                QScriptValueIterator itB(v.property(section));
-                while (itB.hasNext()) {
-                    itB.next();
-                    QScriptValue vB = itB.value();
+                foreach (const JsonValue &vB, v.property(section).elements()) {
                     if (vB.property("url").toString().isEmpty())
                         continue;
                     Poster b;
@@ -654,20 +644,12 @@ QList<Poster> FanartTv::parseTvShowData(QString json, int type, int season)
     map.insert(ImageType::TvShowThumb, QStringList() << "tvthumb");
     map.insert(ImageType::TvShowSeasonThumb, QStringList() << "seasonthumb");
     QList<Poster> posters;
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
-
-    QScriptValueIterator it(sc);
-    while (it.hasNext()) {
-        it.next();
-        QScriptValue v = it.value();
+    JsonValue sc = JsonValue::parse(json);
+
+    foreach (const JsonValue &v, sc.elements()) {
         foreach (const QString &section, map.value(type)) {
             if (v.property(section).isArray()) {
-                QScriptValueIterator itB(v.property(section));
-                while (itB.hasNext()) {
-                    itB.next();
-                    QScriptValue vB = itB.value();
+                foreach (const JsonValue &vB, v.property(section).elements()) {
                     if (vB.property("url").toString().isEmpty())
                         continue;
 
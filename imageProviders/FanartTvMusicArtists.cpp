@@ -1,10 +1,8 @@
 #include "FanartTvMusicArtists.h"
 #include <QDebug>
 #include <QSettings>
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include "data/Storage.h"
+#include "globals/JsonValue.h"
 #include "imageProviders/FanartTv.h"
 #include "scrapers/TMDb.h"
 
@@ -142,20 +140,12 @@ QList<Poster> FanartTvMusicArtists::parseData(QString json, int type)
     map.insert(ImageType::ConcertBackdrop, QStringList() << "artistbackground");
     map.insert(ImageType::ConcertLogo, QStringList() << "hdmusiclogo" << "musiclogo");
     QList<Poster> posters;
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
-
-    QScriptValueIterator it(sc);
-    while (it.hasNext()) {
-        it.next();
-        QScriptValue v = it.value();
+    JsonValue sc = JsonValue::parse(json);
+
+    foreach (const JsonValue &v, sc.elements()) {
         foreach (const QString &section, map.value(type)) {
             if (v.property(section).isArray()) {
-                QScriptValueIterator itB(v.property(section));
-                while (itB.hasNext()) {
-                    itB.next();
-                    QScriptValue vB = itB.value();
+                foreach (const JsonValue &vB, v.property(section).elements()) {
                     if (vB.property("url").toString().isEmpty())
                         continue;
                     Poster b;
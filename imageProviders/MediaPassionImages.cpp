@@ -1,8 +1,5 @@
 #include "MediaPassionImages.h"
 
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include <QSettings>
 #include "scrapers/TMDb.h"
 #include "settings/Settings.h"
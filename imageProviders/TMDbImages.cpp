@@ -1,8 +1,5 @@
 #include "TMDbImages.h"
 
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include "scrapers/TMDb.h"
 #include "settings/Settings.h"
 
@@ -8,56 +8,19 @@
 #include <QTextStream>
 #include <QTimer>
 #include <QTranslator>
+#include "globals/Logger.h"
+#include "globals/Tracer.h"
 #include "main/MainWindow.h"
 #include "settings/Settings.h"
 
-static QFile data;
-
 void messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
-    bool toFile = data.isOpen();
-
-    QByteArray localMsg = msg.toLocal8Bit();
-    QTextStream out;
-    if (toFile)
-        out.setDevice(&data);
-    QString newLine = "\n";
-    #ifdef Q_OS_WIN32
-        newLine = "\r\n";
-    #endif
-
-    QString f = QString("%1").arg(context.function, -70, QChar(' '));
-
-    switch (type) {
-    case QtDebugMsg:
-        if (toFile)
-            out << "[" << f << "] " << localMsg << newLine;
-        else
-            fprintf(stderr, "%s %s%s", qPrintable(f), qPrintable(localMsg), qPrintable(newLine));
-        break;
-    case QtWarningMsg:
-        if (toFile)
-            out << "[" << f << "] " << "WARNING: " << localMsg << newLine;
-        else
-            fprintf(stderr, "%s WARNING: %s%s", qPrintable(f), qPrintable(localMsg), qPrintable(newLine));
-        break;
-    case QtCriticalMsg:
-        if (toFile)
-            out << "[" << f << "] " << "CRITICAL: " << localMsg << newLine;
-        else
-            fprintf(stderr, "%s CRITICAL: %s%s", qPrintable(f), qPrintable(localMsg), qPrintable(newLine));
-        break;
-    case QtFatalMsg:
-        if (toFile)
-            out << "[" << f << "] " << "FATAL: " << localMsg << newLine;
-        else
-            fprintf(stderr, "%s FATAL: %s%s", qPrintable(f), qPrintable(localMsg), qPrintable(newLine));
-        abort();
-    }
+    Logger::instance()->log(type, context, msg);
 }
 
 int main(int argc, char *argv[])
 {
+    Tracer::instance();
     QApplication a(argc, argv);
 
     // Qt localization
@@ -86,21 +49,30 @@ int main(int argc, char *argv[])
     QCoreApplication::setAttribute(Qt::AA_UseHighDpiPixmaps, true);
 #endif
 
+    qint64 settingsStart = Tracer::instance()->elapsed();
     Settings::instance(qApp)->loadSettings();
+    qint64 settingsDuration = Tracer::instance()->elapsed() - settingsStart;
+    Logger::instance()->setCategoryLevels(Settings::instance()->advanced()->logLevels());
     if (Settings::instance()->advanced()->debugLog() && !Settings::instance()->advanced()->logFile().isEmpty()) {
-        data.setFileName(Settings::instance()->advanced()->logFile());
-        if (!data.open(QFile::WriteOnly | QFile::Truncate))
+        if (!Logger::instance()->setLogFile(Settings::instance()->advanced()->logFile()))
             QMessageBox::critical(0, QObject::tr("Logfile could not be openened"),
                                   QObject::tr("The logfile %1 could not be openend for writing.").arg(Settings::instance()->advanced()->logFile()));
     }
+    Logger::instance()->startWriting();
     qInstallMessageHandler(messageOutput);
 
+    Tracer::instance()->setFileName(Settings::instance()->advanced()->traceFile());
+    Tracer::instance()->addEvent("Settings::loadSettings", settingsStart, settingsDuration);
+
+    qint64 mainWindowStart = Tracer::instance()->elapsed();
     MainWindow w;
     w.show();
+    Tracer::instance()->addEvent("MainWindow::MainWindow", mainWindowStart, Tracer::instance()->elapsed() - mainWindowStart);
+    QTimer::singleShot(0, Tracer::instance(), SLOT(onEventLoopStarted()));
     int ret = a.exec();
 
-    if (data.isOpen())
-        data.close();
+    Logger::instance()->stop();
+    Tracer::instance()->save();
 
     return ret;
 }
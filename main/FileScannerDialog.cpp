@@ -4,6 +4,8 @@
 
 #include <QTimer>
 #include "data/ImageCache.h"
+#include "data/LibraryCacheLoader.h"
+#include "globals/Tracer.h"
 
 /**
  * @brief FileScannerDialog::FileScannerDialog
@@ -29,7 +31,11 @@ FileScannerDialog::FileScannerDialog(QWidget *parent) :
     ui->currentDir->setFont(font);
 
     m_forceReload = false;
+    m_traceStart = 0;
     m_reloadType = TypeAll;
+    m_cacheLoader = new LibraryCacheLoader(this);
+    connect(m_cacheLoader, SIGNAL(progress(int,int)), this, SLOT(onProgress(int,int)));
+    connect(m_cacheLoader, SIGNAL(finished()), this, SLOT(onStartMovieScanner()));
 
     Manager::instance()->setFileScannerDialog(this);
 
@@ -66,6 +72,7 @@ int FileScannerDialog::exec()
     Manager::instance()->tvShowFileSearcher()->setMovieDirectories(Settings::instance()->tvShowDirectories());
     Manager::instance()->concertFileSearcher()->setConcertDirectories(Settings::instance()->concertDirectories());
 
+    m_traceStart = Tracer::instance()->elapsed();
     ui->status->setText("");
     ui->progressBar->setValue(0);
     ui->currentDir->setText("");
@@ -75,7 +82,9 @@ int FileScannerDialog::exec()
     if (m_forceReload)
         ImageCache::instance()->clearCache();
 
-    if (m_reloadType == TypeMovies || m_reloadType == TypeAll)
+    if (m_reloadType == TypeAll && !m_forceReload)
+        onStartCacheLoader();
+    else if (m_reloadType == TypeMovies || m_reloadType == TypeAll)
         onStartMovieScanner();
     else if (m_reloadType == TypeTvShows)
         onStartTvShowScanner();
@@ -102,6 +111,7 @@ void FileScannerDialog::setReloadType(ReloadType type)
  */
 void FileScannerDialog::reject()
 {
+    m_cacheLoader->abort();
     if (m_reloadType == TypeMovies || m_reloadType == TypeAll) {
         Manager::instance()->movieFileSearcher()->abort();
         Manager::instance()->movieModel()->clear();
@@ -119,6 +129,16 @@ void FileScannerDialog::reject()
     QDialog::reject();
 }
 
+/**
+ * @brief Loads all libraries from the cache database at the same time,
+ *        the file searchers are started afterwards and use the loaded items
+ */
+void FileScannerDialog::onStartCacheLoader()
+{
+    ui->status->setText(tr("Loading Library..."));
+    m_cacheLoader->load(Settings::instance()->movieDirectories(), Settings::instance()->tvShowDirectories(), Settings::instance()->concertDirectories());
+}
+
 /**
  * @brief Starts the movie file searcher
  */
@@ -219,6 +239,7 @@ void FileScannerDialog::onCurrentDir(QString dir)
 void FileScannerDialog::onLoadDone(int msgId)
 {
     if (m_reloadType != TypeAll) {
+        Tracer::instance()->addEvent("FileScannerDialog::exec", m_traceStart, Tracer::instance()->elapsed() - m_traceStart);
         accept();
         return;
     }
@@ -228,6 +249,7 @@ void FileScannerDialog::onLoadDone(int msgId)
     } else if (msgId == Constants::TvShowSearcherProgressMessageId) {
         onStartConcertScanner();
     } else if (msgId == Constants::ConcertFileSearcherProgressMessageId) {
+        Tracer::instance()->addEvent("FileScannerDialog::exec", m_traceStart, Tracer::instance()->elapsed() - m_traceStart);
         accept();
     }
 }
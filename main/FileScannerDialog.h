@@ -3,6 +3,8 @@
 
 #include <QDialog>
 
+class LibraryCacheLoader;
+
 namespace Ui {
 class FileScannerDialog;
 }
@@ -32,6 +34,7 @@ public slots:
 private slots:
     void onProgress(int current, int max);
     void onCurrentDir(QString dir);
+    void onStartCacheLoader();
     void onStartMovieScanner();
     void onStartMovieScannerForce();
     void onStartMovieScannerCache();
@@ -50,6 +53,8 @@ private:
     bool m_forceReload;
     ReloadType m_reloadType;
     QString m_scanDir;
+    LibraryCacheLoader *m_cacheLoader;
+    qint64 m_traceStart;
 };
 
 #endif // FILESCANNERDIALOG_H
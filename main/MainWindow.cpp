@@ -11,9 +11,11 @@
 
 #include "concerts/ConcertSearch.h"
 #include "data/MediaCenterInterface.h"
+#include "data/StreamDetailsService.h"
 #include "globals/NameFormatter.h"
 #include "data/ScraperInterface.h"
 #include "globals/Globals.h"
+#include "globals/Helper.h"
 #include "globals/ImageDialog.h"
 #include "globals/ImagePreviewDialog.h"
 #include "globals/Manager.h"
@@ -152,6 +154,7 @@ MainWindow::MainWindow(QWidget *parent) :
 
     connect(Update::instance(this), SIGNAL(sigNewVersion(QString)), this, SLOT(onNewVersion(QString)));
 
+    StreamDetailsService::instance(this);
     MovieSearch::instance(this);
     TvShowSearch::instance(this);
     ImageDialog::instance(this);
@@ -615,7 +618,7 @@ void MainWindow::setNewMarks()
     bool newTvShows = Manager::instance()->tvShowModel()->hasNewShowOrEpisode();
 
     QPainter painter;
-    QPixmap star(":/img/star.png");
+    QPixmap star = Helper::scaledPixmap(":/img/star.png");
     QIcon movies = m_icons.value(WidgetMovies);
     QIcon concerts = m_icons.value(WidgetConcerts);
     QIcon shows = m_icons.value(WidgetTvShows);
@@ -654,7 +657,7 @@ void MainWindow::setNewMarks()
 void MainWindow::setNewMarkForImports(bool hasItems)
 {
     QPainter painter;
-    QPixmap star(":/img/star.png");
+    QPixmap star = Helper::scaledPixmap(":/img/star.png");
     QIcon downloads = m_icons.value(WidgetDownloads);
     if (hasItems) {
         QPixmap pixmap = downloads.pixmap(64, 64);
@@ -720,7 +723,7 @@ void MainWindow::onNewVersion(QString version)
     msgBox.setWindowTitle(tr("Updates available"));
     msgBox.setText(tr("%1 is now available.<br>Get it now on %2").arg(version).arg("<a href=\"http://www.mediaelch.de\">http://www.mediaelch.de</a>"));
     msgBox.setStandardButtons(QMessageBox::Ok);
-    msgBox.setIconPixmap(QPixmap(":/img/MediaElch.png").scaledToWidth(64, Qt::SmoothTransformation));
+    msgBox.setIconPixmap(Helper::scaledPixmap(":/img/MediaElch.png", QSize(64, 0)));
     QCheckBox dontCheck(QObject::tr("Don't check for updates"), &msgBox);
     dontCheck.blockSignals(true);
     msgBox.addButton(&dontCheck, QMessageBox::ActionRole);
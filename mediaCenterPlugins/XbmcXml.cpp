@@ -5,18 +5,26 @@
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QSet>
 #include <QXmlStreamWriter>
+#include <QtConcurrent/QtConcurrentMap>
 
+#include "data/BatchSaver.h"
+#include "data/SafeFileWriter.h"
+#include "globals/DirectoryListing.h"
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "globals/Logger.h"
 #include "globals/Manager.h"
+#include "globals/Tracer.h"
 #include "settings/Settings.h"
 
 /**
  * @brief XbmcXml::XbmcXml
  * @param parent
  */
-XbmcXml::XbmcXml(QObject *parent)
+XbmcXml::XbmcXml(QObject *parent) :
+    m_batchSaver(0)
 {
     setParent(parent);
 }
@@ -46,7 +54,7 @@ bool XbmcXml::hasFeature(int feature)
  */
 void XbmcXml::writeMovieXml(QXmlStreamWriter &xml, Movie *movie)
 {
-    qDebug() << "Entered, movie=" << movie->name();
+    LOG_DEBUG() << "Entered, movie=" << movie->name();
     xml.writeStartElement("movie");
     xml.writeTextElement("title", movie->name());
     xml.writeTextElement("originaltitle", movie->originalName());
@@ -117,81 +125,65 @@ void XbmcXml::writeMovieXml(QXmlStreamWriter &xml, Movie *movie)
  */
 bool XbmcXml::saveMovie(Movie *movie)
 {
-    qDebug() << "Entered, movie=" << movie->name();
-    QByteArray xmlContent;
-    QXmlStreamWriter xml(&xmlContent);
-    xml.setAutoFormatting(true);
-    xml.writeStartDocument("1.0", true);
-    writeMovieXml(xml, movie);
-    xml.writeEndDocument();
+    LOG_DEBUG() << "Entered, movie=" << movie->name();
+    QByteArray xmlContent = m_batchSaver ? m_batchSaver->nfoContent(movie) : nfoXml(movie);
 
     if (movie->files().size() == 0) {
         qWarning() << "Movie has no files";
         return false;
     }
 
-    movie->setNfoContent(xmlContent);
-    Manager::instance()->database()->update(movie);
+    // a batch save sets the nfo content, image flags and database entry once the files were written
+    if (!m_batchSaver)
+        movie->setNfoContent(xmlContent);
 
     bool saved = false;
     QFileInfo fi(movie->files().at(0));
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
         QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, movie->files().count() > 1);
-        QFile file(fi.absolutePath() + "/" + saveFileName);
-        qDebug() << "Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        LOG_DEBUG() << "Saving to" << fi.absolutePath() + "/" + saveFileName;
+        if (!saveFile(fi.absolutePath() + "/" + saveFileName, xmlContent, true))
             qWarning() << "File could not be openend";
-        } else {
-            file.write(xmlContent);
-            file.close();
+        else
             saved = true;
-        }
     }
     if (!saved)
         return false;
 
     foreach (const int &imageType, Movie::imageTypes()) {
         int dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (movie->imageHasChanged(imageType) && !movie->image(imageType).isNull()) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+        if (movie->imageHasChanged(imageType) && !movie->stagedImage(imageType).isNull()) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, movie->files().count() > 1);
                 if (imageType == ImageType::MoviePoster && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
                     saveFileName = "poster.jpg";
                 if (imageType == ImageType::MovieBackdrop && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
                     saveFileName = "fanart.jpg";
                 QString path = getPath(movie);
-                saveFile(path + "/" + saveFileName, movie->image(imageType));
+                if (saveImage(path + "/" + saveFileName, movie->stagedImage(imageType), imageType) && !m_batchSaver)
+                    movie->setHasImage(imageType, true);
             }
         }
 
         if (movie->imagesToRemove().contains(imageType)) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, movie->files().count() > 1);
                 if (imageType == ImageType::MoviePoster && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
                     saveFileName = "poster.jpg";
                 if (imageType == ImageType::MovieBackdrop && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
                     saveFileName = "fanart.jpg";
                 QString path = getPath(movie);
-                QFile(path + "/" + saveFileName).remove();
+                removeFile(path + "/" + saveFileName);
             }
+            movie->setHasImage(imageType, false);
         }
     }
 
     if (movie->inSeparateFolder() && !movie->files().isEmpty()) {
-        foreach (const QString &file, movie->extraFanartsToRemove())
-            QFile::remove(file);
-        QDir dir(QFileInfo(movie->files().first()).absolutePath() + "/extrafanart");
-        if (!dir.exists() && !movie->extraFanartImagesToAdd().isEmpty())
-            QDir(QFileInfo(movie->files().first()).absolutePath()).mkdir("extrafanart");
-        foreach (QByteArray img, movie->extraFanartImagesToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists())
-                ++num;
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
-        }
+        if (!movie->extraFanartsToRemove().isEmpty() || !movie->extraFanartImagesToAdd().isEmpty())
+            movie->setHasExtraFanarts(saveExtraFanarts(QFileInfo(movie->files().first()).absolutePath(), movie->extraFanartsToRemove(), movie->extraFanartImagesToAdd(), ImageType::MovieExtraFanart));
     }
 
-
     foreach (const Actor &actor, movie->actors()) {
         if (!actor.image.isNull()) {
             QDir dir;
@@ -202,6 +194,9 @@ bool XbmcXml::saveMovie(Movie *movie)
         }
     }
 
+    if (!m_batchSaver)
+        Manager::instance()->database()->update(movie);
+
     return true;
 }
 
@@ -223,7 +218,7 @@ QString XbmcXml::nfoFilePath(Movie *movie)
         return nfoFile;
     }
 
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
         QString file = dataFile.saveFileName(fi.fileName(), -1, movie->files().count() > 1);
         QFileInfo nfoFi(fi.absolutePath() + "/" + file);
         if (nfoFi.exists()) {
@@ -248,7 +243,7 @@ QString XbmcXml::nfoFilePath(TvShowEpisode *episode)
         return nfoFile;
     }
 
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo)) {
         QString file = dataFile.saveFileName(fi.fileName(), -1, episode->files().count() > 1);
         QFileInfo nfoFi(fi.absolutePath() + "/" + file);
         if (nfoFi.exists()) {
@@ -278,7 +273,7 @@ QString XbmcXml::nfoFilePath(Concert *concert)
         return nfoFile;
     }
 
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::ConcertNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::ConcertNfo)) {
         QString file = dataFile.saveFileName(fi.fileName(), -1, concert->files().count() > 1);
         QFileInfo nfoFi(fi.absolutePath() + "/" + file);
         if (nfoFi.exists()) {
@@ -297,6 +292,7 @@ QString XbmcXml::nfoFilePath(Concert *concert)
  */
 bool XbmcXml::loadMovie(Movie *movie, QString initialNfoContent)
 {
+    ScopedTrace trace("XbmcXml::loadMovie");
     movie->clear();
     movie->setChanged(false);
 
@@ -416,8 +412,9 @@ bool XbmcXml::loadMovie(Movie *movie, QString initialNfoContent)
 
     // Existence of images
     if (initialNfoContent.isEmpty()) {
+        QList<int> existingTypes = existingImageTypes(movie);
         foreach (const int &imageType, Movie::imageTypes())
-            movie->setHasImage(imageType, !imageFileName(movie, imageType).isEmpty());
+            movie->setHasImage(imageType, existingTypes.contains(imageType));
         movie->setHasExtraFanarts(!extraFanartNames(movie).isEmpty());
     }
 
@@ -441,6 +438,11 @@ bool XbmcXml::loadStreamDetails(StreamDetails* streamDetails, QDomDocument domDo
     return false;
 }
 
+/**
+ * @brief Loads the stream details from a <streamdetails> element
+ * @param streamDetails StreamDetails object
+ * @param elem Streamdetails element
+ */
 void XbmcXml::loadStreamDetails(StreamDetails* streamDetails, QDomElement elem)
 {
     if (!elem.elementsByTagName("video").isEmpty()) {
@@ -563,7 +565,7 @@ QString XbmcXml::actorImageName(Movie *movie, Actor actor)
  */
 void XbmcXml::writeConcertXml(QXmlStreamWriter &xml, Concert *concert)
 {
-    qDebug() << "Entered, concert=" << concert->name();
+    LOG_DEBUG() << "Entered, concert=" << concert->name();
     xml.writeStartElement("musicvideo");
     xml.writeTextElement("title", concert->name());
     xml.writeTextElement("artist", concert->artist());
@@ -613,79 +615,67 @@ void XbmcXml::writeConcertXml(QXmlStreamWriter &xml, Concert *concert)
  */
 bool XbmcXml::saveConcert(Concert *concert)
 {
-    qDebug() << "Entered, concert=" << concert->name();
-    QByteArray xmlContent;
-    QXmlStreamWriter xml(&xmlContent);
-    xml.setAutoFormatting(true);
-    xml.writeStartDocument("1.0", true);
-    writeConcertXml(xml, concert);
-    xml.writeEndDocument();
+    LOG_DEBUG() << "Entered, concert=" << concert->name();
+    QByteArray xmlContent = m_batchSaver ? m_batchSaver->nfoContent(concert) : nfoXml(concert);
 
     if (concert->files().size() == 0) {
         qWarning() << "Concert has no files";
         return false;
     }
 
-    concert->setNfoContent(xmlContent);
-    Manager::instance()->database()->update(concert);
+    // a batch save sets the nfo content, image flags and database entry once the files were written
+    if (!m_batchSaver)
+        concert->setNfoContent(xmlContent);
 
     bool saved = false;
     QFileInfo fi(concert->files().at(0));
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::ConcertNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::ConcertNfo)) {
         QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, concert->files().count() > 1);
-        QFile file(fi.absolutePath() + "/" + saveFileName);
-        qDebug() << "Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        LOG_DEBUG() << "Saving to" << fi.absolutePath() + "/" + saveFileName;
+        if (!saveFile(fi.absolutePath() + "/" + saveFileName, xmlContent, true))
             qWarning() << "File could not be openend";
-        } else {
-            file.write(xmlContent);
-            file.close();
+        else
             saved = true;
-        }
     }
     if (!saved)
         return false;
 
     foreach (const int &imageType, Concert::imageTypes()) {
         int dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (concert->imageHasChanged(imageType) && !concert->image(imageType).isNull()) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+        if (concert->imageHasChanged(imageType) && !concert->stagedImage(imageType).isNull()) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, concert->files().count() > 1);
                 if (imageType == ImageType::ConcertPoster && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
                     saveFileName = "poster.jpg";
                 if (imageType == ImageType::ConcertBackdrop && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
                     saveFileName = "fanart.jpg";
                 QString path = getPath(concert);
-                saveFile(path + "/" + saveFileName, concert->image(imageType));
+                if (saveImage(path + "/" + saveFileName, concert->stagedImage(imageType), imageType) && !m_batchSaver)
+                    concert->setHasImage(imageType, true);
             }
         }
         if (concert->imagesToRemove().contains(imageType)) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(imageType)) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(imageType)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, concert->files().count() > 1);
                 if (imageType == ImageType::ConcertPoster && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
                     saveFileName = "poster.jpg";
                 if (imageType == ImageType::ConcertBackdrop && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
                     saveFileName = "fanart.jpg";
                 QString path = getPath(concert);
-                QFile(path + "/" + saveFileName).remove();
+                removeFile(path + "/" + saveFileName);
             }
+            concert->setHasImage(imageType, false);
         }
     }
 
     if (concert->inSeparateFolder() && !concert->files().isEmpty()) {
-        foreach (const QString &file, concert->extraFanartsToRemove())
-            QFile::remove(file);
-        QDir dir(QFileInfo(concert->files().first()).absolutePath() + "/extrafanart");
-        if (!dir.exists() && !concert->extraFanartImagesToAdd().isEmpty())
-            QDir(QFileInfo(concert->files().first()).absolutePath()).mkdir("extrafanart");
-        foreach (QByteArray img, concert->extraFanartImagesToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists())
-                ++num;
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
-        }
+        if (!concert->extraFanartsToRemove().isEmpty() || !concert->extraFanartImagesToAdd().isEmpty())
+            concert->setHasExtraFanarts(saveExtraFanarts(QFileInfo(concert->files().first()).absolutePath(), concert->extraFanartsToRemove(), concert->extraFanartImagesToAdd(), ImageType::ConcertExtraFanart));
     }
 
+    if (!m_batchSaver)
+        Manager::instance()->database()->update(concert);
+
     return true;
 }
 
@@ -696,6 +686,7 @@ bool XbmcXml::saveConcert(Concert *concert)
  */
 bool XbmcXml::loadConcert(Concert *concert, QString initialNfoContent)
 {
+    ScopedTrace trace("XbmcXml::loadConcert");
     concert->clear();
     concert->setChanged(false);
 
@@ -775,8 +766,9 @@ bool XbmcXml::loadConcert(Concert *concert, QString initialNfoContent)
 
     // Existence of images
     if (initialNfoContent.isEmpty()) {
+        QList<int> existingTypes = existingImageTypes(concert);
         foreach (const int &imageType, Concert::imageTypes())
-            concert->setHasImage(imageType, !imageFileName(concert, imageType).isEmpty());
+            concert->setHasImage(imageType, existingTypes.contains(imageType));
         concert->setHasExtraFanarts(!extraFanartNames(concert).isEmpty());
     }
 
@@ -823,6 +815,7 @@ QString XbmcXml::actorImageName(TvShowEpisode *episode, Actor actor)
  */
 bool XbmcXml::loadTvShow(TvShow *show, QString initialNfoContent)
 {
+    ScopedTrace trace("XbmcXml::loadTvShow");
     show->clear();
     show->setChanged(false);
 
@@ -832,7 +825,7 @@ bool XbmcXml::loadTvShow(TvShow *show, QString initialNfoContent)
             return false;
 
         QString nfoFile;
-        foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
+        foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
             QString file = dataFile.saveFileName("");
             QFileInfo nfoFi(show->dir() + "/" + file);
             if (nfoFi.exists()) {
@@ -934,6 +927,7 @@ bool XbmcXml::loadTvShow(TvShow *show, QString initialNfoContent)
  */
 bool XbmcXml::loadTvShowEpisode(TvShowEpisode *episode, QString initialNfoContent)
 {
+    ScopedTrace trace("XbmcXml::loadTvShowEpisode");
     episode->clear();
     episode->setChanged(false);
 
@@ -1055,75 +1049,61 @@ bool XbmcXml::loadTvShowEpisode(TvShowEpisode *episode, QString initialNfoConten
  */
 bool XbmcXml::saveTvShow(TvShow *show)
 {
-    QByteArray xmlContent;
-    QXmlStreamWriter xml(&xmlContent);
-    xml.setAutoFormatting(true);
-    xml.writeStartDocument("1.0", true);
-    writeTvShowXml(xml, show);
-    xml.writeEndDocument();
+    QByteArray xmlContent = m_batchSaver ? m_batchSaver->nfoContent(show) : nfoXml(show);
 
     if (show->dir().isEmpty())
         return false;
 
-    show->setNfoContent(xmlContent);
-    Manager::instance()->database()->update(show);
+    // a batch save sets the nfo content, image flags and database entry once the files were written
+    if (!m_batchSaver)
+        show->setNfoContent(xmlContent);
 
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
-        QFile file(show->dir() + "/" + dataFile.saveFileName(""));
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "Nfo file could not be openend for writing" << file.fileName();
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
+        if (!saveFile(show->dir() + "/" + dataFile.saveFileName(""), xmlContent, true)) {
+            qWarning() << "Nfo file could not be openend for writing" << show->dir() + "/" + dataFile.saveFileName("");
             return false;
         }
-        file.write(xmlContent);
-        file.close();
     }
 
     foreach (const int &imageType, TvShow::imageTypes()) {
         int dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (show->imageHasChanged(imageType) && !show->image(imageType).isNull()) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+        if (show->imageHasChanged(imageType) && !show->stagedImage(imageType).isNull()) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName("");
-                saveFile(show->dir() + "/" + saveFileName, show->image(imageType));
+                if (saveImage(show->dir() + "/" + saveFileName, show->stagedImage(imageType), imageType) && !m_batchSaver)
+                    show->setHasImage(imageType, true);
             }
         }
         if (show->imagesToRemove().contains(imageType)) {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName("");
-                QFile(show->dir() + "/" + saveFileName).remove();
+                removeFile(show->dir() + "/" + saveFileName);
             }
+            show->setHasImage(imageType, false);
         }
     }
 
     foreach (const int &imageType, TvShow::seasonImageTypes()) {
         int dataFileType = DataFile::dataFileTypeForImageType(imageType);
         foreach (int season, show->seasons()) {
-            if (show->seasonImageHasChanged(season, imageType) && !show->seasonImage(season, imageType).isNull()) {
-                foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+            if (show->seasonImageHasChanged(season, imageType) && !show->stagedSeasonImage(season, imageType).isNull()) {
+                foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    saveFile(show->dir() + "/" + saveFileName, show->seasonImage(season, imageType));
+                    saveImage(show->dir() + "/" + saveFileName, show->stagedSeasonImage(season, imageType));
                 }
             }
             if (show->imagesToRemove().contains(imageType) && show->imagesToRemove().value(imageType).contains(season)) {
-                foreach (DataFile dataFile, Settings::instance()->dataFiles(dataFileType)) {
+                foreach (const DataFile &dataFile, Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    QFile(show->dir() + "/" + saveFileName).remove();
+                    removeFile(show->dir() + "/" + saveFileName);
                 }
             }
         }
     }
 
     if (!show->dir().isEmpty()) {
-        foreach (const QString &file, show->extraFanartsToRemove())
-            QFile::remove(file);
-        QDir dir(show->dir() + "/extrafanart");
-        if (!dir.exists() && !show->extraFanartImagesToAdd().isEmpty())
-            QDir(show->dir()).mkdir("extrafanart");
-        foreach (QByteArray img, show->extraFanartImagesToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists())
-                ++num;
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
-        }
+        if (!show->extraFanartsToRemove().isEmpty() || !show->extraFanartImagesToAdd().isEmpty())
+            show->setHasImage(ImageType::TvShowExtraFanart, saveExtraFanarts(show->dir(), show->extraFanartsToRemove(), show->extraFanartImagesToAdd(), ImageType::TvShowExtraFanart));
     }
 
     foreach (const Actor &actor, show->actors()) {
@@ -1136,6 +1116,9 @@ bool XbmcXml::saveTvShow(TvShow *show)
         }
     }
 
+    if (!m_batchSaver)
+        Manager::instance()->database()->update(show);
+
     return true;
 }
 
@@ -1147,62 +1130,47 @@ bool XbmcXml::saveTvShow(TvShow *show)
  */
 bool XbmcXml::saveTvShowEpisode(TvShowEpisode *episode)
 {
-    qDebug() << "Entered, episode=" << episode->name();
-
-    // Multi-Episode handling
-    QList<TvShowEpisode*> episodes;
-    foreach (TvShowEpisode *subEpisode, episode->tvShow()->episodes()) {
-        if (subEpisode->isDummy())
-            continue;
-        if (episode->files() == subEpisode->files())
-            episodes.append(subEpisode);
-    }
-
-    QByteArray xmlContent;
-    QXmlStreamWriter xml(&xmlContent);
-    xml.setAutoFormatting(true);
-    xml.writeStartDocument("1.0", true);
-    foreach (TvShowEpisode *subEpisode, episodes) {
-        writeTvShowEpisodeXml(xml, subEpisode);
-        subEpisode->setChanged(false);
-        subEpisode->setSyncNeeded(true);
-    }
-    xml.writeEndDocument();
+    LOG_DEBUG() << "Entered, episode=" << episode->name();
+    QByteArray xmlContent = m_batchSaver ? m_batchSaver->nfoContent(episode) : nfoXml(episode);
 
     if (episode->files().isEmpty()) {
         qWarning() << "Episode has no files";
         return false;
     }
 
-    foreach (TvShowEpisode *subEpisode, episodes) {
+    // a batch save marks the episodes of a multi episode file as saved once the files were written
+    foreach (TvShowEpisode *subEpisode, multiEpisodes(episode)) {
+        if (m_batchSaver) {
+            m_batchSaver->addSibling(subEpisode);
+            continue;
+        }
+        subEpisode->setChanged(false);
+        subEpisode->setSyncNeeded(true);
         subEpisode->setNfoContent(xmlContent);
         Manager::instance()->database()->update(subEpisode);
     }
 
     QFileInfo fi(episode->files().at(0));
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo)) {
         QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, episode->files().count() > 1);
-        QFile file(fi.absolutePath() + "/" + saveFileName);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        if (!saveFile(fi.absolutePath() + "/" + saveFileName, xmlContent, true)) {
             qWarning() << "Nfo file could not be opened for writing" << saveFileName;
             return false;
         }
-        file.write(xmlContent);
-        file.close();
     }
 
     fi.setFile(episode->files().at(0));
-    if (episode->thumbnailImageChanged() && !episode->thumbnailImage().isNull()) {
+    if (episode->thumbnailImageChanged() && !episode->stagedThumbnailImage().isNull()) {
         if (Helper::isBluRay(episode->files().at(0)) || Helper::isDvd(episode->files().at(0))) {
             QDir dir = fi.dir();
             dir.cdUp();
-            saveFile(dir.absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            saveImage(dir.absolutePath() + "/thumb.jpg", episode->stagedThumbnailImage());
         } else if (Helper::isDvd(episode->files().at(0), true)) {
-            saveFile(fi.dir().absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            saveImage(fi.dir().absolutePath() + "/thumb.jpg", episode->stagedThumbnailImage());
         } else {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, episode->files().count() > 1);
-                saveFile(fi.absolutePath() + "/" + saveFileName, episode->thumbnailImage());
+                saveImage(fi.absolutePath() + "/" + saveFileName, episode->stagedThumbnailImage());
             }
         }
     }
@@ -1212,13 +1180,13 @@ bool XbmcXml::saveTvShowEpisode(TvShowEpisode *episode)
         if (Helper::isBluRay(episode->files().at(0)) || Helper::isDvd(episode->files().at(0))) {
             QDir dir = fi.dir();
             dir.cdUp();
-            QFile(dir.absolutePath() + "/thumb.jpg").remove();
+            removeFile(dir.absolutePath() + "/thumb.jpg");
         } else if (Helper::isDvd(episode->files().at(0), true)) {
-            QFile(fi.dir().absolutePath() + "/thumb.jpg").remove();
+            removeFile(fi.dir().absolutePath() + "/thumb.jpg");
         } else {
-            foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
+            foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName = dataFile.saveFileName(fi.fileName(), -1, episode->files().count() > 1);
-                QFile(fi.absolutePath() + "/" + saveFileName).remove();
+                removeFile(fi.absolutePath() + "/" + saveFileName);
             }
         }
     }
@@ -1244,7 +1212,7 @@ bool XbmcXml::saveTvShowEpisode(TvShowEpisode *episode)
  */
 void XbmcXml::writeTvShowXml(QXmlStreamWriter &xml, TvShow *show)
 {
-    qDebug() << "Entered, show=" << show->name();
+    LOG_DEBUG() << "Entered, show=" << show->name();
     xml.writeStartElement("tvshow");
     xml.writeTextElement("title", show->name());
     xml.writeTextElement("showtitle", show->showTitle());
@@ -1326,7 +1294,7 @@ void XbmcXml::writeTvShowXml(QXmlStreamWriter &xml, TvShow *show)
  */
 void XbmcXml::writeTvShowEpisodeXml(QXmlStreamWriter &xml, TvShowEpisode *episode)
 {
-    qDebug() << "Entered, episode=" << episode->name();
+    LOG_DEBUG() << "Entered, episode=" << episode->name();
     xml.writeStartElement("episodedetails");
     xml.writeTextElement("title", episode->name());
     xml.writeTextElement("showtitle", episode->showTitle());
@@ -1371,43 +1339,119 @@ QStringList XbmcXml::extraFanartNames(Movie *movie)
 {
     if (movie->files().isEmpty() || !movie->inSeparateFolder())
         return QStringList();
-    QFileInfo fi(movie->files().first());
-    QDir dir(fi.absolutePath() + "/extrafanart");
-    QStringList files;
-    QStringList filters = QStringList() << "*.jpg" << "*.jpeg" << "*.JPEG" << "*.Jpeg" << "*.JPeg";
-    foreach (const QString &file, dir.entryList(filters, QDir::Files | QDir::NoDotAndDotDot, QDir::Name))
-        files << QDir::toNativeSeparators(dir.path() + "/" + file);
-    return files;
+    return extraFanartNames(QFileInfo(movie->files().first()).absolutePath());
 }
 
 QStringList XbmcXml::extraFanartNames(Concert *concert)
 {
     if (concert->files().isEmpty() || !concert->inSeparateFolder())
         return QStringList();
-    QFileInfo fi(concert->files().first());
-    QDir dir(fi.absolutePath() + "/extrafanart");
-    QStringList files;
-    QStringList filters = QStringList() << "*.jpg" << "*.jpeg" << "*.JPEG" << "*.Jpeg" << "*.JPeg";
-    foreach (const QString &file, dir.entryList(filters, QDir::Files | QDir::NoDotAndDotDot, QDir::Name))
-        files << QDir::toNativeSeparators(dir.path() + "/" + file);
-    return files;
+    return extraFanartNames(QFileInfo(concert->files().first()).absolutePath());
 }
 
 QStringList XbmcXml::extraFanartNames(TvShow *show)
 {
     if (show->dir().isEmpty())
         return QStringList();
-    QDir dir(show->dir() + "/extrafanart");
+    return extraFanartNames(show->dir());
+}
+
+/**
+ * @brief Lists the extra fanarts of an item
+ * @param path Folder which contains the extrafanart folder
+ * @return Extra fanart files
+ */
+QStringList XbmcXml::extraFanartNames(QString path)
+{
+    QDir dir(path + "/extrafanart");
     QStringList files;
-    QStringList filters = QStringList() << "*.jpg" << "*.jpeg" << "*.JPEG" << "*.Jpeg" << "*.JPeg";
-    foreach (const QString &file, dir.entryList(filters, QDir::Files | QDir::NoDotAndDotDot, QDir::Name))
-        files << QDir::toNativeSeparators(dir.path() + "/" + file);
+    foreach (const QString &file, dir.entryList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name)) {
+        if (isExtraFanart(file))
+            files << QDir::toNativeSeparators(dir.path() + "/" + file);
+    }
     return files;
 }
 
+bool XbmcXml::isExtraFanart(const QString &fileName)
+{
+    return fileName.endsWith(".jpg", Qt::CaseInsensitive) || fileName.endsWith(".jpeg", Qt::CaseInsensitive);
+}
+
+/**
+ * @brief Removes extra fanarts and adds new ones.
+ *        The extrafanart folder is listed once: the new images get the free fanartN.jpg names in ascending order
+ *        and are written concurrently, the remaining extra fanarts are taken from the same listing.
+ * @param path Folder which contains the extrafanart folder
+ * @param filesToRemove Extra fanarts to remove
+ * @param images New extra fanarts
+ * @param imageType Extra fanart image type of the item, a batch save sets it once a new extra fanart was written
+ * @return True if the item has extra fanarts afterwards, new extra fanarts which could not be written don't count
+ */
+bool XbmcXml::saveExtraFanarts(QString path, QStringList filesToRemove, QList<StagedImage> images, int imageType)
+{
+    QSet<QString> removedFiles;
+    foreach (const QString &file, filesToRemove) {
+        removeFile(file);
+        removedFiles.insert(QFileInfo(file).fileName().toLower());
+    }
+
+    QDir dir(path + "/extrafanart");
+    if (!dir.exists() && !images.isEmpty())
+        QDir(path).mkdir("extrafanart");
+
+    // removals of a batch save are still queued, so their files are filtered out of the listing
+    QSet<QString> usedNames;
+    int extraFanartCount = 0;
+    foreach (const QString &file, dir.entryList(QDir::Files | QDir::NoDotAndDotDot)) {
+        if (removedFiles.contains(file.toLower()))
+            continue;
+        usedNames.insert(file.toLower());
+        if (isExtraFanart(file))
+            extraFanartCount++;
+    }
+
+    QList<ExtraFanartFile> newFiles;
+    int num = 1;
+    foreach (const StagedImage &image, images) {
+        while (usedNames.contains(QString("fanart%1.jpg").arg(num)))
+            ++num;
+        ExtraFanartFile file;
+        file.fileName = dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num++);
+        file.image = image;
+        file.written = false;
+        newFiles.append(file);
+    }
+
+    // queued images of a batch save are not counted, the BatchSaver sets the image type once they were written
+    int newFileCount = 0;
+    if (m_batchSaver) {
+        foreach (const ExtraFanartFile &file, newFiles)
+            m_batchSaver->queueImage(file.fileName, file.image, imageType);
+    } else {
+        QtConcurrent::blockingMap(newFiles, &XbmcXml::writeExtraFanart);
+        foreach (const ExtraFanartFile &file, newFiles) {
+            if (file.written)
+                newFileCount++;
+        }
+    }
+
+    return extraFanartCount + newFileCount > 0;
+}
+
+/**
+ * @brief Writes a new extra fanart. Called from the thread pool.
+ * @param file Extra fanart file, written is set if the image landed on disk
+ */
+void XbmcXml::writeExtraFanart(ExtraFanartFile &file)
+{
+    file.written = writeImage(file.fileName, file.image);
+    if (!file.written)
+        qWarning() << "File could not be written" << file.fileName;
+}
+
 QImage XbmcXml::movieSetPoster(QString setName)
 {
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetPoster)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetPoster)) {
         QString fileName = movieSetFileName(setName, &dataFile);
         QFileInfo fi(fileName);
         if (fi.exists())
@@ -1418,7 +1462,7 @@ QImage XbmcXml::movieSetPoster(QString setName)
 
 QImage XbmcXml::movieSetBackdrop(QString setName)
 {
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetBackdrop)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetBackdrop)) {
         QString fileName = movieSetFileName(setName, &dataFile);
         QFileInfo fi(fileName);
         if (fi.exists())
@@ -1434,7 +1478,7 @@ QImage XbmcXml::movieSetBackdrop(QString setName)
  */
 void XbmcXml::saveMovieSetPoster(QString setName, QImage poster)
 {
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetPoster)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetPoster)) {
         QString fileName = movieSetFileName(setName, &dataFile);
         if (!fileName.isEmpty())
             poster.save(fileName, "jpg", 100);
@@ -1448,22 +1492,172 @@ void XbmcXml::saveMovieSetPoster(QString setName, QImage poster)
  */
 void XbmcXml::saveMovieSetBackdrop(QString setName, QImage backdrop)
 {
-    foreach (DataFile dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetBackdrop)) {
+    foreach (const DataFile &dataFile, Settings::instance()->dataFiles(DataFileType::MovieSetBackdrop)) {
         QString fileName = movieSetFileName(setName, &dataFile);
         if (!fileName.isEmpty())
             backdrop.save(fileName, "jpg", 100);
     }
 }
 
-bool XbmcXml::saveFile(QString filename, QByteArray data)
+/**
+ * @brief Writes data to a file if its content has changed. While a batch save is running the write is queued in the BatchSaver.
+ * @param filename File to write
+ * @param data Content
+ * @param text Open the file in text mode
+ * @return Success, queued writes return true and a failure keeps the item marked as changed
+ */
+bool XbmcXml::saveFile(QString filename, QByteArray data, bool text)
 {
-    QFile file(filename);
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(data);
-        file.close();
-        return true;
+    if (m_batchSaver)
+        return m_batchSaver->queueWrite(filename, data, text);
+    return SafeFileWriter::write(filename, data, text);
+}
+
+/**
+ * @brief Removes a file. While a batch save is running the removal is queued in the BatchSaver.
+ * @param filename File to remove
+ */
+void XbmcXml::removeFile(QString filename)
+{
+    if (m_batchSaver)
+        m_batchSaver->queueRemove(filename);
+    else
+        QFile::remove(filename);
+}
+
+/**
+ * @brief Writes an image if it has changed. While a batch save is running the write is queued in the BatchSaver.
+ * @param filename File to write
+ * @param image Image, a staged image is copied from its file
+ * @param imageType Image type which the BatchSaver marks as existing once the image was written, -1 for none
+ * @return Success, queued writes return true and a failure keeps the item marked as changed
+ */
+bool XbmcXml::saveImage(QString filename, StagedImage image, int imageType)
+{
+    if (m_batchSaver)
+        return m_batchSaver->queueImage(filename, image, imageType);
+    return writeImage(filename, image);
+}
+
+/**
+ * @brief Writes an image if it has changed, staged images are copied without reading them into memory
+ * @param filename File to write
+ * @param image Image
+ * @return Success
+ */
+bool XbmcXml::writeImage(QString filename, StagedImage image)
+{
+    return SafeFileWriter::writeImage(filename, image);
+}
+
+/**
+ * @brief Checks if an image file exists
+ * @param filename File to check
+ * @param listing Listing of the directory or 0 to check the file directly
+ * @return File exists
+ */
+bool XbmcXml::isFile(QString filename, DirectoryListing *listing)
+{
+    if (listing)
+        return listing->isFile(filename);
+    return QFileInfo(filename).isFile();
+}
+
+/**
+ * @brief Sets the BatchSaver which collects all file operations while saving multiple items.
+ *        Pass 0 to write files directly again.
+ * @param batchSaver BatchSaver or 0
+ */
+void XbmcXml::setBatchSaver(BatchSaver *batchSaver)
+{
+    m_batchSaver = batchSaver;
+}
+
+/**
+ * @brief Generates the nfo content of a movie. Only reads the movie, so it can run on the thread pool.
+ * @param movie Movie
+ * @return Nfo content
+ * @see XbmcXml::writeMovieXml
+ */
+QByteArray XbmcXml::nfoXml(Movie *movie)
+{
+    QByteArray xmlContent;
+    QXmlStreamWriter xml(&xmlContent);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    writeMovieXml(xml, movie);
+    xml.writeEndDocument();
+    return xmlContent;
+}
+
+/**
+ * @brief Generates the nfo content of a concert. Only reads the concert, so it can run on the thread pool.
+ * @param concert Concert
+ * @return Nfo content
+ * @see XbmcXml::writeConcertXml
+ */
+QByteArray XbmcXml::nfoXml(Concert *concert)
+{
+    QByteArray xmlContent;
+    QXmlStreamWriter xml(&xmlContent);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    writeConcertXml(xml, concert);
+    xml.writeEndDocument();
+    return xmlContent;
+}
+
+/**
+ * @brief Generates the nfo content of a tv show. Only reads the show, so it can run on the thread pool.
+ * @param show Tv show
+ * @return Nfo content
+ * @see XbmcXml::writeTvShowXml
+ */
+QByteArray XbmcXml::nfoXml(TvShow *show)
+{
+    QByteArray xmlContent;
+    QXmlStreamWriter xml(&xmlContent);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    writeTvShowXml(xml, show);
+    xml.writeEndDocument();
+    return xmlContent;
+}
+
+/**
+ * @brief Generates the nfo content of an episode, it contains all episodes of a multi episode file.
+ *        Only reads the episodes, so it can run on the thread pool.
+ * @param episode Episode
+ * @return Nfo content
+ * @see XbmcXml::writeTvShowEpisodeXml
+ */
+QByteArray XbmcXml::nfoXml(TvShowEpisode *episode)
+{
+    QByteArray xmlContent;
+    QXmlStreamWriter xml(&xmlContent);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    foreach (TvShowEpisode *subEpisode, multiEpisodes(episode))
+        writeTvShowEpisodeXml(xml, subEpisode);
+    xml.writeEndDocument();
+    return xmlContent;
+}
+
+/**
+ * @brief Multi-Episode handling: returns all episodes which share the files of the episode
+ * @param episode Episode
+ * @return List of episodes, including the episode itself
+ */
+QList<TvShowEpisode*> XbmcXml::multiEpisodes(TvShowEpisode *episode)
+{
+    QList<TvShowEpisode*> episodes;
+    foreach (TvShowEpisode *subEpisode, episode->tvShow()->episodes()) {
+        if (subEpisode->isDummy())
+            continue;
+        if (episode->files() == subEpisode->files())
+            episodes.append(subEpisode);
     }
-    return false;
+    return episodes;
 }
 
 QString XbmcXml::getPath(Movie *movie)
@@ -1504,7 +1698,7 @@ QString XbmcXml::getPath(Concert *concert)
     return fi.absolutePath();
 }
 
-QString XbmcXml::movieSetFileName(QString setName, DataFile *dataFile)
+QString XbmcXml::movieSetFileName(QString setName, const DataFile *dataFile)
 {
     if (Settings::instance()->movieSetArtworkType() == MovieSetArtworkSingleArtworkFolder) {
         QDir dir(Settings::instance()->movieSetArtworkDirectory());
@@ -1527,7 +1721,28 @@ QString XbmcXml::movieSetFileName(QString setName, DataFile *dataFile)
     return QString();
 }
 
-QString XbmcXml::imageFileName(Movie *movie, int type, QList<DataFile> dataFiles, bool constructName)
+QString XbmcXml::imageFileName(Movie *movie, int type, const QList<DataFile> &dataFiles, bool constructName)
+{
+    return imageFileName(movie, type, dataFiles, constructName, 0);
+}
+
+/**
+ * @brief Returns the image types which have a file, the folder of the movie is listed only once
+ * @param movie Movie object
+ * @return List of image types
+ */
+QList<int> XbmcXml::existingImageTypes(Movie *movie)
+{
+    DirectoryListing listing;
+    QList<int> types;
+    foreach (const int &imageType, Movie::imageTypes()) {
+        if (!imageFileName(movie, imageType, QList<DataFile>(), false, &listing).isEmpty())
+            types << imageType;
+    }
+    return types;
+}
+
+QString XbmcXml::imageFileName(Movie *movie, int type, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing)
 {
     int fileType;
     switch (type) {
@@ -1563,18 +1778,16 @@ QString XbmcXml::imageFileName(Movie *movie, int type, QList<DataFile> dataFiles
     }
     QFileInfo fi(movie->files().at(0));
 
-    if (!constructName)
-        dataFiles = Settings::instance()->dataFiles(fileType);
+    const QList<DataFile> &files = constructName ? dataFiles : Settings::instance()->dataFiles(fileType);
 
-    foreach (DataFile dataFile, dataFiles) {
+    QString path = getPath(movie);
+    foreach (const DataFile &dataFile, files) {
         QString file = dataFile.saveFileName(fi.fileName(), -1, movie->files().count() > 1);
         if (type == ImageType::MoviePoster && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
             file = "poster.jpg";
         if (type == ImageType::MovieBackdrop && (movie->discType() == DiscBluRay || movie->discType() == DiscDvd))
             file = "fanart.jpg";
-        QString path = getPath(movie);
-        QFileInfo pFi(path + "/" + file);
-        if (pFi.isFile() || constructName) {
+        if (constructName || isFile(path + "/" + file, listing)) {
             fileName = path + "/" + file;
             break;
         }
@@ -1583,7 +1796,28 @@ QString XbmcXml::imageFileName(Movie *movie, int type, QList<DataFile> dataFiles
     return fileName;
 }
 
-QString XbmcXml::imageFileName(Concert *concert, int type, QList<DataFile> dataFiles, bool constructName)
+QString XbmcXml::imageFileName(Concert *concert, int type, const QList<DataFile> &dataFiles, bool constructName)
+{
+    return imageFileName(concert, type, dataFiles, constructName, 0);
+}
+
+/**
+ * @brief Returns the image types which have a file, the folder of the concert is listed only once
+ * @param concert Concert object
+ * @return List of image types
+ */
+QList<int> XbmcXml::existingImageTypes(Concert *concert)
+{
+    DirectoryListing listing;
+    QList<int> types;
+    foreach (const int &imageType, Concert::imageTypes()) {
+        if (!imageFileName(concert, imageType, QList<DataFile>(), false, &listing).isEmpty())
+            types << imageType;
+    }
+    return types;
+}
+
+QString XbmcXml::imageFileName(Concert *concert, int type, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing)
 {
     int fileType;
     switch (type) {
@@ -1613,18 +1847,16 @@ QString XbmcXml::imageFileName(Concert *concert, int type, QList<DataFile> dataF
     }
     QFileInfo fi(concert->files().at(0));
 
-    if (!constructName)
-        dataFiles = Settings::instance()->dataFiles(fileType);
+    const QList<DataFile> &files = constructName ? dataFiles : Settings::instance()->dataFiles(fileType);
 
-    foreach (DataFile dataFile, dataFiles) {
+    QString path = getPath(concert);
+    foreach (const DataFile &dataFile, files) {
         QString file = dataFile.saveFileName(fi.fileName(), -1, concert->files().count() > 1);
         if (type == ImageType::ConcertPoster && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
             file = "poster.jpg";
         if (type == ImageType::ConcertBackdrop && (concert->discType() == DiscBluRay || concert->discType() == DiscDvd))
             file = "fanart.jpg";
-        QString path = getPath(concert);
-        QFileInfo pFi(path + "/" + file);
-        if (pFi.isFile() || constructName) {
+        if (constructName || isFile(path + "/" + file, listing)) {
             fileName = path + "/" + file;
             break;
         }
@@ -1633,7 +1865,28 @@ QString XbmcXml::imageFileName(Concert *concert, int type, QList<DataFile> dataF
     return fileName;
 }
 
-QString XbmcXml::imageFileName(TvShow *show, int type, int season, QList<DataFile> dataFiles, bool constructName)
+QString XbmcXml::imageFileName(TvShow *show, int type, int season, const QList<DataFile> &dataFiles, bool constructName)
+{
+    return imageFileName(show, type, season, dataFiles, constructName, 0);
+}
+
+/**
+ * @brief Returns the image types of the show (not of its seasons) which have a file, the folder of the show is listed only once
+ * @param show Tv show object
+ * @return List of image types
+ */
+QList<int> XbmcXml::existingImageTypes(TvShow *show)
+{
+    DirectoryListing listing;
+    QList<int> types;
+    foreach (const int &imageType, TvShow::imageTypes()) {
+        if (!imageFileName(show, imageType, -2, QList<DataFile>(), false, &listing).isEmpty())
+            types << imageType;
+    }
+    return types;
+}
+
+QString XbmcXml::imageFileName(TvShow *show, int type, int season, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing)
 {
     int fileType;
     switch (type) {
@@ -1677,14 +1930,12 @@ QString XbmcXml::imageFileName(TvShow *show, int type, int season, QList<DataFil
     if (show->dir().isEmpty())
         return QString();
 
-    if (!constructName)
-        dataFiles = Settings::instance()->dataFiles(fileType);
+    const QList<DataFile> &files = constructName ? dataFiles : Settings::instance()->dataFiles(fileType);
 
     QString fileName;
-    foreach (DataFile dataFile, dataFiles) {
+    foreach (const DataFile &dataFile, files) {
         QString loadFileName = dataFile.saveFileName("", season);
-        QFileInfo fi(show->dir() + "/" + loadFileName);
-        if (fi.isFile() || constructName) {
+        if (constructName || isFile(show->dir() + "/" + loadFileName, listing)) {
             fileName = show->dir() + "/" + loadFileName;
             break;
         }
@@ -1692,7 +1943,7 @@ QString XbmcXml::imageFileName(TvShow *show, int type, int season, QList<DataFil
     return fileName;
 }
 
-QString XbmcXml::imageFileName(TvShowEpisode *episode, int type, QList<DataFile> dataFiles, bool constructName)
+QString XbmcXml::imageFileName(TvShowEpisode *episode, int type, const QList<DataFile> &dataFiles, bool constructName)
 {
     int fileType;
     switch (type) {
@@ -1721,10 +1972,9 @@ QString XbmcXml::imageFileName(TvShowEpisode *episode, int type, QList<DataFile>
         return fi.exists() ? fi.absoluteFilePath() : "";
     }
 
-    if (!constructName)
-        dataFiles = Settings::instance()->dataFiles(fileType);
+    const QList<DataFile> &files = constructName ? dataFiles : Settings::instance()->dataFiles(fileType);
 
-    foreach (DataFile dataFile, dataFiles) {
+    foreach (const DataFile &dataFile, files) {
         QString file = dataFile.saveFileName(fi.fileName());
         QFileInfo pFi(fi.absolutePath() + "/" + file);
         if (pFi.isFile() || constructName) {
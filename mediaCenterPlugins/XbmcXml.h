@@ -11,6 +11,8 @@
 #include "data/TvShow.h"
 #include "data/TvShowEpisode.h"
 
+class DirectoryListing;
+
 /**
  * @brief The XbmcXml class
  */
@@ -43,28 +45,57 @@ public:
     QString actorImageName(TvShow *show, Actor actor);
     QString actorImageName(TvShowEpisode *episode, Actor actor);
 
-    QString imageFileName(Movie *movie, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false);
-    QString imageFileName(Concert *concert, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false);
-    QString imageFileName(TvShowEpisode *episode, int type, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false);
-    QString imageFileName(TvShow *show, int type, int season = -1, QList<DataFile> dataFiles = QList<DataFile>(), bool constructName = false);
+    QString imageFileName(Movie *movie, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false);
+    QString imageFileName(Concert *concert, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false);
+    QString imageFileName(TvShowEpisode *episode, int type, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false);
+    QString imageFileName(TvShow *show, int type, int season = -1, const QList<DataFile> &dataFiles = QList<DataFile>(), bool constructName = false);
+    QList<int> existingImageTypes(Movie *movie);
+    QList<int> existingImageTypes(Concert *concert);
+    QList<int> existingImageTypes(TvShow *show);
 
     QString nfoFilePath(Movie *movie);
     QString nfoFilePath(Concert *concert);
     QString nfoFilePath(TvShowEpisode *episode);
 
+    void setBatchSaver(BatchSaver *batchSaver);
+    QByteArray nfoXml(Movie *movie);
+    QByteArray nfoXml(Concert *concert);
+    QByteArray nfoXml(TvShow *show);
+    QByteArray nfoXml(TvShowEpisode *episode);
+
     static void writeTvShowEpisodeXml(QXmlStreamWriter &xml, TvShowEpisode *episode);
     static void writeStreamDetails(QXmlStreamWriter &xml, StreamDetails *streamDetails);
+    static void loadStreamDetails(StreamDetails *streamDetails, QDomElement elem);
 
 private:
+    struct ExtraFanartFile {
+        QString fileName;
+        StagedImage image;
+        bool written;
+    };
+
     void writeMovieXml(QXmlStreamWriter &xml, Movie *movie);
     void writeConcertXml(QXmlStreamWriter &xml, Concert *concert);
     void writeTvShowXml(QXmlStreamWriter &xml, TvShow *show);
     bool loadStreamDetails(StreamDetails *streamDetails, QDomDocument domDoc);
-    void loadStreamDetails(StreamDetails *streamDetails, QDomElement elem);
-    bool saveFile(QString filename, QByteArray data);
+    bool saveFile(QString filename, QByteArray data, bool text = false);
+    bool saveImage(QString filename, StagedImage image, int imageType = -1);
+    void removeFile(QString filename);
+    bool isFile(QString filename, DirectoryListing *listing);
+    QString imageFileName(Movie *movie, int type, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing);
+    QString imageFileName(Concert *concert, int type, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing);
+    QString imageFileName(TvShow *show, int type, int season, const QList<DataFile> &dataFiles, bool constructName, DirectoryListing *listing);
     QString getPath(Movie *movie);
     QString getPath(Concert *concert);
-    QString movieSetFileName(QString setName, DataFile *dataFile);
+    QString movieSetFileName(QString setName, const DataFile *dataFile);
+    QStringList extraFanartNames(QString path);
+    bool saveExtraFanarts(QString path, QStringList filesToRemove, QList<StagedImage> images, int imageType);
+    static QList<TvShowEpisode*> multiEpisodes(TvShowEpisode *episode);
+    static bool isExtraFanart(const QString &fileName);
+    static void writeExtraFanart(ExtraFanartFile &file);
+    static bool writeImage(QString filename, StagedImage image);
+
+    BatchSaver *m_batchSaver;
 };
 
 #endif // XBMCXML_H
@@ -95,19 +95,15 @@ void CertificationWidget::loadCertifications()
     emit setActionSaveEnabled(false, WidgetCertifications);
     ui->certifications->blockSignals(true);
     clear();
-    QStringList certifications;
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (!movie->certification().isEmpty() && !certifications.contains(movie->certification()))
-            certifications.append(movie->certification());
-    }
-
-    foreach (const QString &certification, m_addedCertifications) {
-        if (!certification.isEmpty() && !certifications.contains(certification))
-            certifications.append(certification);
+    QStringList certifications = Manager::instance()->movieModel()->movieIndex()->values(MovieIndex::Certification);
+    if (!m_addedCertifications.isEmpty()) {
+        foreach (const QString &certification, m_addedCertifications) {
+            if (!certification.isEmpty() && !certifications.contains(certification))
+                certifications.append(certification);
+        }
+        qSort(certifications.begin(), certifications.end(), LocaleStringCompare());
     }
 
-    qSort(certifications.begin(), certifications.end(), LocaleStringCompare());
-
     foreach (const QString &certification, certifications) {
         QTableWidgetItem *item = new QTableWidgetItem(certification);
         item->setData(Qt::UserRole, certification);
@@ -135,14 +131,12 @@ void CertificationWidget::onCertificationSelected()
     ui->movies->setSortingEnabled(false);
 
     QString certificationName = ui->certifications->item(ui->certifications->currentRow(), 0)->text();
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->certification() == certificationName) {
-            int row = ui->movies->rowCount();
-            QTableWidgetItem *item = new QTableWidgetItem(movie->name());
-            item->setData(Qt::UserRole, QVariant::fromValue(movie));
-            ui->movies->insertRow(row);
-            ui->movies->setItem(row, 0, item);
-        }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Certification, certificationName)) {
+        int row = ui->movies->rowCount();
+        QTableWidgetItem *item = new QTableWidgetItem(movie->name());
+        item->setData(Qt::UserRole, QVariant::fromValue(movie));
+        ui->movies->insertRow(row);
+        ui->movies->setItem(row, 0, item);
     }
     ui->certificationName->setText(certificationName);
     ui->movies->setSortingEnabled(true);
@@ -160,10 +154,8 @@ void CertificationWidget::onCertificationNameChanged(QTableWidgetItem *item)
     if (newName == origName)
         return;
 
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->certification() == origName)
-            movie->setCertification(newName);
-    }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Certification, origName))
+        movie->setCertification(newName);
     ui->certificationName->setText(newName);
     item->setData(Qt::UserRole, newName);
     if (m_addedCertifications.contains(origName)) {
@@ -221,10 +213,8 @@ void CertificationWidget::deleteCertification()
     QString origCertificationName = ui->certifications->item(ui->certifications->currentRow(), 0)->data(Qt::UserRole).toString();
     ui->certifications->removeRow(ui->certifications->currentRow());
 
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->certification() == certificationName)
-            movie->setCertification("");
-    }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Certification, certificationName))
+        movie->setCertification("");
     m_addedCertifications.removeOne(origCertificationName);
 }
 
@@ -95,19 +95,14 @@ void GenreWidget::loadGenres()
     emit setActionSaveEnabled(false, WidgetGenres);
     ui->genres->blockSignals(true);
     clear();
-    QStringList genres;
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        foreach (const QString &genre, movie->genres()) {
+    QStringList genres = Manager::instance()->movieModel()->movieIndex()->values(MovieIndex::Genre);
+    if (!m_addedGenres.isEmpty()) {
+        foreach (const QString &genre, m_addedGenres) {
             if (!genre.isEmpty() && !genres.contains(genre))
-                genres.append(genre);;
+                genres.append(genre);
         }
+        qSort(genres.begin(), genres.end(), LocaleStringCompare());
     }
-    foreach (const QString &genre, m_addedGenres) {
-        if (!genre.isEmpty() && !genres.contains(genre))
-            genres.append(genre);
-    }
-
-    qSort(genres.begin(), genres.end(), LocaleStringCompare());
 
     foreach (const QString &genre, genres) {
         QTableWidgetItem *item = new QTableWidgetItem(genre);
@@ -136,14 +131,12 @@ void GenreWidget::onGenreSelected()
     ui->movies->setSortingEnabled(false);
 
     QString genreName = ui->genres->item(ui->genres->currentRow(), 0)->text();
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->genres().contains(genreName)) {
-            int row = ui->movies->rowCount();
-            QTableWidgetItem *item = new QTableWidgetItem(movie->name());
-            item->setData(Qt::UserRole, QVariant::fromValue(movie));
-            ui->movies->insertRow(row);
-            ui->movies->setItem(row, 0, item);
-        }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Genre, genreName)) {
+        int row = ui->movies->rowCount();
+        QTableWidgetItem *item = new QTableWidgetItem(movie->name());
+        item->setData(Qt::UserRole, QVariant::fromValue(movie));
+        ui->movies->insertRow(row);
+        ui->movies->setItem(row, 0, item);
     }
     ui->genreName->setText(genreName);
     ui->movies->setSortingEnabled(true);
@@ -161,12 +154,10 @@ void GenreWidget::onGenreNameChanged(QTableWidgetItem *item)
     if (newName == origName)
         return;
 
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->genres().contains(origName)) {
-            movie->removeGenre(origName);
-            if (!movie->genres().contains(newName))
-                movie->addGenre(newName);
-        }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Genre, origName)) {
+        movie->removeGenre(origName);
+        if (!movie->genres().contains(newName))
+            movie->addGenre(newName);
     }
     ui->genreName->setText(newName);
     item->setData(Qt::UserRole, newName);
@@ -225,10 +216,8 @@ void GenreWidget::deleteGenre()
     QString origGenreName = ui->genres->item(ui->genres->currentRow(), 0)->data(Qt::UserRole).toString();
     ui->genres->removeRow(ui->genres->currentRow());
 
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->genres().contains(genreName))
-            movie->removeGenre(genreName);
-    }
+    foreach (Movie *movie, Manager::instance()->movieModel()->movieIndex()->movies(MovieIndex::Genre, genreName))
+        movie->removeGenre(genreName);
 
     m_addedGenres.removeOne(origGenreName);
 }
@@ -109,25 +109,25 @@ void Movie::clear(QList<int> infos)
         m_actors.clear();
     if (infos.contains(MovieScraperInfos::Backdrop)) {
         m_backdrops.clear();
-        m_images.insert(ImageType::MovieBackdrop, QByteArray());
+        m_images.insert(ImageType::MovieBackdrop, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieBackdrop, false);
         m_imagesToRemove.removeOne(ImageType::MovieBackdrop);
     }
     if (infos.contains(MovieScraperInfos::CdArt)) {
         m_discArts.clear();
-        m_images.insert(ImageType::MovieCdArt, QByteArray());
+        m_images.insert(ImageType::MovieCdArt, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieCdArt, false);
         m_imagesToRemove.removeOne(ImageType::MovieCdArt);
     }
     if (infos.contains(MovieScraperInfos::ClearArt)) {
         m_clearArts.clear();
-        m_images.insert(ImageType::MovieClearArt, QByteArray());
+        m_images.insert(ImageType::MovieClearArt, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieClearArt, false);
         m_imagesToRemove.removeOne(ImageType::MovieClearArt);
     }
     if (infos.contains(MovieScraperInfos::Logo)) {
         m_logos.clear();
-        m_images.insert(ImageType::MovieLogo, QByteArray());
+        m_images.insert(ImageType::MovieLogo, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieLogo, false);
         m_imagesToRemove.removeOne(ImageType::MovieLogo);
     }
@@ -137,7 +137,7 @@ void Movie::clear(QList<int> infos)
         m_genres.clear();
     if (infos.contains(MovieScraperInfos::Poster)){
         m_posters.clear();
-        m_images.insert(ImageType::MoviePoster, QByteArray());
+        m_images.insert(ImageType::MoviePoster, StagedImage());
         m_hasImageChanged.insert(ImageType::MoviePoster, false);
         m_numPrimaryLangPosters = 0;
         m_imagesToRemove.removeOne(ImageType::MoviePoster);
@@ -174,12 +174,12 @@ void Movie::clear(QList<int> infos)
         m_tags.clear();
 
     if (infos.contains(MovieScraperInfos::Banner)) {
-        m_images.insert(ImageType::MovieBanner, QByteArray());
+        m_images.insert(ImageType::MovieBanner, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieBanner, false);
         m_imagesToRemove.removeOne(ImageType::MovieBanner);
     }
     if (infos.contains(MovieScraperInfos::Thumb)) {
-        m_images.insert(ImageType::MovieThumb, QByteArray());
+        m_images.insert(ImageType::MovieThumb, StagedImage());
         m_hasImageChanged.insert(ImageType::MovieThumb, false);
         m_imagesToRemove.removeOne(ImageType::MovieThumb);
     }
@@ -1256,6 +1256,11 @@ bool Movie::hasLocalTrailer() const
 }
 
 void Movie::addExtraFanart(QByteArray fanart)
+{
+    addExtraFanart(StagedImage(fanart));
+}
+
+void Movie::addExtraFanart(StagedImage fanart)
 {
     m_extraFanartImagesToAdd.append(fanart);
     setChanged(true);
@@ -1263,7 +1268,13 @@ void Movie::addExtraFanart(QByteArray fanart)
 
 void Movie::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i=0, n=m_extraFanartImagesToAdd.count() ; i<n ; ++i) {
+        const StagedImage &image = m_extraFanartImagesToAdd.at(i);
+        if (image.size() == fanart.size() && image.data() == fanart) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setChanged(true);
 }
 
@@ -1286,9 +1297,9 @@ QList<ExtraFanart> Movie::extraFanarts(MediaCenterInterface *mediaCenterInterfac
         f.path = file;
         fanarts.append(f);
     }
-    foreach (const QByteArray &img, m_extraFanartImagesToAdd) {
+    foreach (const StagedImage &img, m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -1299,7 +1310,7 @@ QStringList Movie::extraFanartsToRemove()
     return m_extraFanartsToRemove;
 }
 
-QList<QByteArray> Movie::extraFanartImagesToAdd()
+QList<StagedImage> Movie::extraFanartImagesToAdd()
 {
     return m_extraFanartImagesToAdd;
 }
@@ -1348,7 +1359,7 @@ QList<int> Movie::imagesToRemove() const
 
 void Movie::removeImage(int type)
 {
-    if (!m_images.value(type, QByteArray()).isNull()) {
+    if (!m_images.value(type).isNull()) {
         m_images.remove(type);
         m_hasImageChanged.insert(type, false);
     } else if (!m_imagesToRemove.contains(type)) {
@@ -1359,7 +1370,17 @@ void Movie::removeImage(int type)
 
 QByteArray Movie::image(int imageType)
 {
-    return m_images.value(imageType, QByteArray());
+    return m_images.value(imageType).data();
+}
+
+/**
+ * @brief Returns the image without reading a staged image into memory
+ * @param imageType Type of the image
+ * @return Image handle, null if there is no new image
+ */
+StagedImage Movie::stagedImage(int imageType)
+{
+    return m_images.value(imageType);
 }
 
 bool Movie::imageHasChanged(int imageType)
@@ -1378,6 +1399,11 @@ void Movie::setHasImage(int imageType, bool has)
 }
 
 void Movie::setImage(int imageType, QByteArray image)
+{
+    setImage(imageType, StagedImage(image));
+}
+
+void Movie::setImage(int imageType, StagedImage image)
 {
     m_images.insert(imageType, image);
     m_hasImageChanged.insert(imageType, true);
@@ -11,6 +11,7 @@
 #include "globals/Globals.h"
 #include "data/MediaCenterInterface.h"
 #include "data/ScraperInterface.h"
+#include "data/StagedImage.h"
 #include "data/StreamDetails.h"
 #include "movies/MovieController.h"
 
@@ -142,7 +143,7 @@ public:
     QList<Poster> logos() const;
     QList<ExtraFanart> extraFanarts(MediaCenterInterface *mediaCenterInterface);
     QStringList extraFanartsToRemove();
-    QList<QByteArray> extraFanartImagesToAdd();
+    QList<StagedImage> extraFanartImagesToAdd();
     QList<int> imagesToRemove() const;
 
     void addPoster(Poster poster, bool primaryLang = false);
@@ -151,6 +152,7 @@ public:
     void addClearArt(Poster poster);
     void addLogo(Poster poster);
     void addExtraFanart(QByteArray fanart);
+    void addExtraFanart(StagedImage fanart);
     void removeExtraFanart(QByteArray fanart);
     void removeExtraFanart(QString file);
     void clearExtraFanartData();
@@ -164,10 +166,12 @@ public:
     bool hasExtraFanarts() const;
     void setHasExtraFanarts(bool has);
     QByteArray image(int imageType);
+    StagedImage stagedImage(int imageType);
     bool imageHasChanged(int imageType);
     void setHasImage(int imageType, bool has);
     bool hasImage(int imageType);
     void setImage(int imageType, QByteArray image);
+    void setImage(int imageType, StagedImage image);
 
     DiscType discType();
     void setDiscType(DiscType type);
@@ -236,10 +240,10 @@ private:
     int m_label;
 
     // Images
-    QMap<int, QByteArray> m_images;
+    QMap<int, StagedImage> m_images;
     QMap<int, bool> m_hasImage;
     QMap<int, bool> m_hasImageChanged;
-    QList<QByteArray> m_extraFanartImagesToAdd;
+    QList<StagedImage> m_extraFanartImagesToAdd;
     QList<int> m_imagesToRemove;
 };
 
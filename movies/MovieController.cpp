@@ -2,8 +2,10 @@
 
 #include <QDir>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QtCore/qmath.h>
 #include "data/ImageCache.h"
+#include "data/StreamDetailsService.h"
 #include "globals/DownloadManagerElement.h"
 #include "globals/Helper.h"
 #include "globals/NameFormatter.h"
@@ -43,13 +45,25 @@ bool MovieController::saveData(MediaCenterInterface *mediaCenterInterface)
         loadStreamDetailsFromFile();
     bool saved = mediaCenterInterface->saveMovie(m_movie);
     qDebug() << "Saved" << saved;
+    setSaved(saved);
+    return saved;
+}
+
+/**
+ * @brief Marks the movie as saved, clears its changed state and the staged images.
+ *        A BatchSaver calls this only after all files of the movie were written.
+ * @param saved The nfo file was saved
+ */
+void MovieController::setSaved(bool saved)
+{
     if (!m_infoLoaded)
         m_infoLoaded = saved;
+    if (saved)
+        m_infoFromNfoLoaded = true;
     m_movie->setChanged(false);
     m_movie->clearImages();
     m_movie->clearExtraFanartData();
     m_movie->setSyncNeeded(true);
-    return saved;
 }
 
 /**
@@ -135,10 +149,55 @@ void MovieController::loadData(QMap<ScraperInterface*, QString> ids, ScraperInte
 
 /**
  * @brief Tries to load streamdetails from the file
+ *        Unchanged files are served from the cache, otherwise this blocks until the probe has finished.
+ *        Interactive code should use loadStreamDetailsInBackground instead.
+ * @see StreamDetailsService::load
  */
 void MovieController::loadStreamDetailsFromFile()
 {
-    m_movie->streamDetails()->loadStreamDetails();
+    setStreamDetails(StreamDetailsService::instance()->load(m_movie->files()).result());
+}
+
+/**
+ * @brief Loads streamdetails from the file without blocking
+ *        Cached results are applied immediately, otherwise they are applied
+ *        when the probe has finished and sigStreamDetailsLoaded is emitted.
+ * @see StreamDetailsService::load
+ */
+void MovieController::loadStreamDetailsInBackground()
+{
+    QFuture<QString> future = StreamDetailsService::instance()->load(m_movie->files());
+    if (future.isFinished()) {
+        setStreamDetails(future.result());
+        return;
+    }
+
+    QFutureWatcher<QString> *watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onStreamDetailsLoaded()));
+    watcher->setFuture(future);
+}
+
+/**
+ * @brief Applies the result of a background probe
+ *        Streamdetails which were loaded in the meantime (e.g. while saving) are kept.
+ */
+void MovieController::onStreamDetailsLoaded()
+{
+    QFutureWatcher<QString> *watcher = static_cast<QFutureWatcher<QString>*>(QObject::sender());
+    watcher->deleteLater();
+    if (m_movie->streamDetailsLoaded())
+        return;
+    setStreamDetails(watcher->result());
+    emit sigStreamDetailsLoaded(m_movie);
+}
+
+/**
+ * @brief Assigns the result of a probe to the movie and updates its runtime
+ * @param content <streamdetails> xml
+ */
+void MovieController::setStreamDetails(const QString &content)
+{
+    StreamDetailsService::instance()->assign(m_movie->streamDetails(), content);
     m_movie->setRuntime(qFloor(m_movie->streamDetails()->videoDetails().value("durationinseconds").toInt()/60));
     m_movie->setStreamDetailsLoaded(true);
     m_movie->setChanged(true);
@@ -309,18 +368,18 @@ void MovieController::onDownloadFinished(DownloadManagerElement elem)
 
     if (!elem.data.isEmpty() && elem.imageType == ImageType::Actor) {
         elem.actor->image = elem.data;
-    } else if (!elem.data.isEmpty() && elem.imageType == ImageType::MovieExtraFanart) {
-        Helper::resizeBackdrop(elem.data);
-        m_movie->addExtraFanart(elem.data);
-    } else if (!elem.data.isEmpty()) {
+    } else if (!elem.image.isNull() && elem.imageType == ImageType::MovieExtraFanart) {
+        elem.image = Helper::resizeBackdrop(elem.image);
+        m_movie->addExtraFanart(elem.image);
+    } else if (!elem.image.isNull()) {
         ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(m_movie, elem.imageType));
         if (elem.imageType == ImageType::MovieBackdrop)
-            Helper::resizeBackdrop(elem.data);
-        m_movie->setImage(elem.imageType, elem.data);
+            elem.image = Helper::resizeBackdrop(elem.image);
+        m_movie->setImage(elem.imageType, elem.image);
     }
 
     if (elem.imageType != ImageType::Actor)
-        emit sigImage(m_movie, elem.imageType, elem.data);
+        emit sigImage(m_movie, elem.imageType, elem.image);
 }
 
 void MovieController::loadImage(int type, QUrl url)
@@ -22,9 +22,11 @@ public:
     explicit MovieController(Movie *parent = 0);
 
     bool saveData(MediaCenterInterface *mediaCenterInterface);
+    void setSaved(bool saved);
     bool loadData(MediaCenterInterface *mediaCenterInterface, bool force = false, bool reloadFromNfo = true);
     void loadData(QMap<ScraperInterface*, QString> ids, ScraperInterface *scraperInterface, QList<int> infos);
     void loadStreamDetailsFromFile();
+    void loadStreamDetailsInBackground();
     void scraperLoadDone(ScraperInterface *scraper);
     QList<int> infosToLoad();
     bool infoLoaded() const;
@@ -47,14 +49,18 @@ signals:
     void sigLoadImagesStarted(Movie*);
     void sigDownloadProgress(Movie*, int, int);
     void sigLoadingImages(Movie*, QList<int>);
-    void sigImage(Movie*,int,QByteArray);
+    void sigImage(Movie*,int,StagedImage);
+    void sigStreamDetailsLoaded(Movie*);
 
 private slots:
     void onFanartLoadDone(Movie* movie, QMap<int, QList<Poster> > posters);
     void onAllDownloadsFinished();
     void onDownloadFinished(DownloadManagerElement elem);
+    void onStreamDetailsLoaded();
 
 private:
+    void setStreamDetails(const QString &content);
+
     Movie *m_movie;
     bool m_infoLoaded;
     bool m_infoFromNfoLoaded;
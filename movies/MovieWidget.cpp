@@ -68,13 +68,13 @@ MovieWidget::MovieWidget(QWidget *parent) :
 
     m_movie = 0;
 
-    ui->poster->setDefaultPixmap(QPixmap(":/img/film_reel.png"));
-    ui->backdrop->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->logo->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->clearArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->cdArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->thumb->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->banner->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(48, 48, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->poster->setDefaultPixmap(Helper::scaledPixmap(":/img/film_reel.png"));
+    ui->backdrop->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->logo->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->clearArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->cdArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->thumb->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->banner->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(48, 48)));
 
     ui->genreCloud->setText(tr("Genres"));
     ui->genreCloud->setPlaceholder(tr("Add Genre"));
@@ -383,11 +383,8 @@ void MovieWidget::setMovie(Movie *movie)
 {
     qDebug() << "Entered, movie=" << movie->name();
     movie->controller()->loadData(Manager::instance()->mediaCenterInterface());
-    if (!movie->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails()) {
-        movie->controller()->loadStreamDetailsFromFile();
-        if (movie->streamDetailsLoaded() && movie->streamDetails()->videoDetails().value("durationinseconds").toInt() != 0)
-            movie->setRuntime(qFloor(movie->streamDetails()->videoDetails().value("durationinseconds").toInt()/60));
-    }
+    if (!movie->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails())
+        movie->controller()->loadStreamDetailsInBackground();
     m_movie = movie;
     updateMovieInfo();
 
@@ -396,7 +393,8 @@ void MovieWidget::setMovie(Movie *movie)
     connect(m_movie->controller(), SIGNAL(sigDownloadProgress(Movie*,int, int)), this, SLOT(onDownloadProgress(Movie*,int,int)), Qt::UniqueConnection);
     connect(m_movie->controller(), SIGNAL(sigLoadingImages(Movie*,QList<int>)), this, SLOT(onLoadingImages(Movie*,QList<int>)), Qt::UniqueConnection);
     connect(m_movie->controller(), SIGNAL(sigLoadImagesStarted(Movie*)), this, SLOT(onLoadImagesStarted(Movie*)), Qt::UniqueConnection);
-    connect(m_movie->controller(), SIGNAL(sigImage(Movie*,int,QByteArray)), this, SLOT(onSetImage(Movie*,int,QByteArray)), Qt::UniqueConnection);
+    connect(m_movie->controller(), SIGNAL(sigImage(Movie*,int,StagedImage)), this, SLOT(onSetImage(Movie*,int,StagedImage)), Qt::UniqueConnection);
+    connect(m_movie->controller(), SIGNAL(sigStreamDetailsLoaded(Movie*)), this, SLOT(onStreamDetailsLoaded(Movie*)), Qt::UniqueConnection);
 
     ui->btnAddExtraFanart->setEnabled(movie->inSeparateFolder());
     ui->labelSepFoldersWarning->setVisible(!movie->inSeparateFolder());
@@ -481,11 +479,12 @@ void MovieWidget::onLoadingImages(Movie *movie, QList<int> imageTypes)
     ui->groupBox_3->update();
 }
 
-void MovieWidget::onSetImage(Movie *movie, int type, QByteArray data)
+void MovieWidget::onSetImage(Movie *movie, int type, StagedImage image)
 {
     if (movie != m_movie)
         return;
 
+    QByteArray data = image.data();
     if (type == ImageType::MovieExtraFanart) {
         ui->fanarts->addImage(data);
         return;
@@ -548,18 +547,11 @@ void MovieWidget::updateMovieInfo()
     ui->writer->setText(m_movie->writer());
     ui->director->setText(m_movie->director());
 
-    QStringList certifications;
-    QStringList sets;
-    sets.append("");
-    certifications.append("");
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (!sets.contains(movie->set()) && !movie->set().isEmpty())
-            sets.append(movie->set());
-        if (!certifications.contains(movie->certification()) && !movie->certification().isEmpty())
-            certifications.append(movie->certification());
-    }
-    qSort(sets.begin(), sets.end(), LocaleStringCompare());
-    qSort(certifications.begin(), certifications.end(), LocaleStringCompare());
+    MovieIndex *movieIndex = Manager::instance()->movieModel()->movieIndex();
+    QStringList certifications = movieIndex->values(MovieIndex::Certification);
+    QStringList sets = movieIndex->values(MovieIndex::Set);
+    sets.prepend("");
+    certifications.prepend("");
     ui->certification->addItems(certifications);
     ui->set->addItems(sets);
 
@@ -580,19 +572,15 @@ void MovieWidget::updateMovieInfo()
     }
     ui->actors->blockSignals(false);
 
-    QStringList genres;
-    QStringList tags;
     QStringList countries;
     QStringList studios;
     foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        genres << movie->genres();
-        tags << movie->tags();
         countries << movie->countries();
         studios << movie->studios();
     }
     studios.removeDuplicates();
-    ui->genreCloud->setTags(genres, m_movie->genres());
-    ui->tagCloud->setTags(tags, m_movie->tags());
+    ui->genreCloud->setTags(movieIndex->values(MovieIndex::Genre), m_movie->genres());
+    ui->tagCloud->setTags(movieIndex->values(MovieIndex::Tag), m_movie->tags());
     ui->countryCloud->setTags(countries, m_movie->countries());
     ui->studioCloud->setTags(m_movie->studios(), m_movie->studios());
     QCompleter *completer = new QCompleter(studios, this);
@@ -643,7 +631,7 @@ void MovieWidget::updateImages(QList<int> images)
 
 void MovieWidget::updateImage(const int &imageType, ClosableImage *image)
 {
-    if (!m_movie->image(imageType).isNull()) {
+    if (!m_movie->stagedImage(imageType).isNull()) {
         image->setImage(m_movie->image(imageType));
     } else if (!m_movie->imagesToRemove().contains(imageType) && m_movie->hasImage(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_movie, imageType);
@@ -776,7 +764,6 @@ void MovieWidget::saveInformation()
     int id = NotificationBox::instance()->showMessage(tr("Saving movie..."));
     m_savingWidget->show();
     m_movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-    m_movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
     updateMovieInfo();
     setEnabledTrue();
     m_savingWidget->hide();
@@ -791,34 +778,54 @@ void MovieWidget::saveInformation()
 void MovieWidget::saveAll()
 {
     qDebug() << "Entered";
+    if (m_batchSaver)
+        return;
+
     setDisabledTrue();
     m_savingWidget->show();
 
-    int counter = 0;
-    int moviesToSave = 0;
+    QList<Movie*> moviesToSave;
     foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
         if (movie->hasChanged())
-            moviesToSave++;
+            moviesToSave.append(movie);
     }
 
     NotificationBox::instance()->showProgressBar(tr("Saving movies..."), Constants::MovieWidgetProgressMessageId);
-    NotificationBox::instance()->progressBarProgress(0, moviesToSave, Constants::MovieWidgetProgressMessageId);
     qApp->processEvents();
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (movie->hasChanged()) {
-            NotificationBox::instance()->progressBarProgress(counter++, moviesToSave, Constants::MovieWidgetProgressMessageId);
-            qApp->processEvents();
-            movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-            movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-            if (m_movie == movie)
-                updateMovieInfo();
-        }
-    }
+    m_batchSaver = new BatchSaver(this);
+    connect(m_batchSaver, SIGNAL(sigProgress(int,int)), this, SLOT(onSaveAllProgress(int,int)));
+    connect(m_batchSaver, SIGNAL(sigFinished()), this, SLOT(onSaveAllFinished()));
+    m_batchSaver->saveMovies(moviesToSave);
+}
+
+/**
+ * @brief Called when all movies were saved
+ */
+void MovieWidget::onSaveAllFinished()
+{
+    if (m_movie)
+        updateMovieInfo();
     setEnabledTrue();
     m_savingWidget->hide();
     NotificationBox::instance()->hideProgressBar(Constants::MovieWidgetProgressMessageId);
-    NotificationBox::instance()->showMessage(tr("All Movies Saved"));
-    ui->buttonRevert->setVisible(false);
+    if (m_batchSaver->failedItemCount() > 0) {
+        NotificationBox::instance()->showMessage(tr("%n Movie(s) could not be saved", "", m_batchSaver->failedItemCount()));
+    } else {
+        NotificationBox::instance()->showMessage(tr("All Movies Saved"));
+        ui->buttonRevert->setVisible(false);
+    }
+    m_batchSaver->deleteLater();
+    m_batchSaver = 0;
+}
+
+/**
+ * @brief Updates the progress bar while saving all movies
+ * @param current Current progress
+ * @param max Maximum progress
+ */
+void MovieWidget::onSaveAllProgress(int current, int max)
+{
+    NotificationBox::instance()->progressBarProgress(current, max, Constants::MovieWidgetProgressMessageId);
 }
 
 /**
@@ -1145,6 +1152,21 @@ void MovieWidget::onReleasedChange(QDate date)
     ui->buttonRevert->setVisible(true);
 }
 
+/**
+ * @brief Shows the streamdetails and runtime once the background probe has finished
+ * @param movie Movie whose streamdetails were loaded
+ */
+void MovieWidget::onStreamDetailsLoaded(Movie *movie)
+{
+    if (movie != m_movie)
+        return;
+    ui->runtime->blockSignals(true);
+    ui->runtime->setValue(m_movie->runtime());
+    ui->runtime->blockSignals(false);
+    updateStreamDetails();
+    ui->buttonRevert->setVisible(true);
+}
+
 /**
  * @brief Marks the movie as changed when the runtime has changed
  */
@@ -10,6 +10,7 @@
 #include <QTableWidgetItem>
 #include <QWidget>
 
+#include "data/BatchSaver.h"
 #include "globals/DownloadManager.h"
 #include "movies/Movie.h"
 #include "smallWidgets/ClosableImage.h"
@@ -52,10 +53,13 @@ signals:
 private slots:
     void onInfoLoadDone(Movie *movie);
     void onLoadDone(Movie *movie);
+    void onSaveAllProgress(int current, int max);
+    void onSaveAllFinished();
     void onLoadImagesStarted(Movie *movie);
     void onLoadingImages(Movie *movie, QList<int> imageTypes);
     void onDownloadProgress(Movie *movie, int current, int maximum);
-    void onSetImage(Movie *movie, int type, QByteArray data);
+    void onSetImage(Movie *movie, int type, StagedImage image);
+    void onStreamDetailsLoaded(Movie *movie);
 
     void onChooseImage();
     void onDeleteImage();
@@ -113,6 +117,7 @@ private slots:
 private:
     Ui::MovieWidget *ui;
     QPointer<Movie> m_movie;
+    QPointer<BatchSaver> m_batchSaver;
     QMovie *m_loadingMovie;
     QLabel *m_savingWidget;
     QList<QWidget*> m_streamDetailsWidgets;
@@ -277,7 +277,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename nfo
             if (!nfo.isEmpty()) {
                 QString nfoFileName = QFileInfo(nfo).fileName();
-                QList<DataFile> nfoFiles = Settings::instance()->dataFiles(DataFileType::MovieNfo);
+                const QList<DataFile> &nfoFiles = Settings::instance()->dataFiles(DataFileType::MovieNfo);
                 if (!nfoFiles.isEmpty()) {
                     QString newNfoFileName = nfoFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newNfoFileName);
@@ -294,7 +294,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename Poster
             if (!poster.isEmpty()) {
                 QString posterFileName = QFileInfo(poster).fileName();
-                QList<DataFile> posterFiles = Settings::instance()->dataFiles(DataFileType::MoviePoster);
+                const QList<DataFile> &posterFiles = Settings::instance()->dataFiles(DataFileType::MoviePoster);
                 if (!posterFiles.isEmpty()) {
                     QString newPosterFileName = posterFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newPosterFileName);
@@ -311,7 +311,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename Fanart
             if (!fanart.isEmpty()) {
                 QString fanartFileName = QFileInfo(fanart).fileName();
-                QList<DataFile> fanartFiles = Settings::instance()->dataFiles(DataFileType::MovieBackdrop);
+                const QList<DataFile> &fanartFiles = Settings::instance()->dataFiles(DataFileType::MovieBackdrop);
                 if (!fanartFiles.isEmpty()) {
                     QString newFanartFileName = fanartFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newFanartFileName);
@@ -328,7 +328,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename Banner
             if (!banner.isEmpty()) {
                 QString bannerFileName = QFileInfo(banner).fileName();
-                QList<DataFile> bannerFiles = Settings::instance()->dataFiles(DataFileType::MovieBanner);
+                const QList<DataFile> &bannerFiles = Settings::instance()->dataFiles(DataFileType::MovieBanner);
                 if (!bannerFiles.isEmpty()) {
                     QString newBannerFileName = bannerFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newBannerFileName);
@@ -345,7 +345,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename Thumb
             if (!thumb.isEmpty()) {
                 QString thumbFileName = QFileInfo(thumb).fileName();
-                QList<DataFile> thumbFiles = Settings::instance()->dataFiles(DataFileType::MovieThumb);
+                const QList<DataFile> &thumbFiles = Settings::instance()->dataFiles(DataFileType::MovieThumb);
                 if (!thumbFiles.isEmpty()) {
                     QString newThumbFileName = thumbFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newThumbFileName);
@@ -362,7 +362,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename Logo
             if (!logo.isEmpty()) {
                 QString logoFileName = QFileInfo(logo).fileName();
-                QList<DataFile> logoFiles = Settings::instance()->dataFiles(DataFileType::MovieLogo);
+                const QList<DataFile> &logoFiles = Settings::instance()->dataFiles(DataFileType::MovieLogo);
                 if (!logoFiles.isEmpty()) {
                     QString newLogoFileName = logoFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newLogoFileName);
@@ -379,7 +379,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename ClearArt
             if (!clearArt.isEmpty()) {
                 QString clearArtFileName = QFileInfo(clearArt).fileName();
-                QList<DataFile> clearArtFiles = Settings::instance()->dataFiles(DataFileType::MovieClearArt);
+                const QList<DataFile> &clearArtFiles = Settings::instance()->dataFiles(DataFileType::MovieClearArt);
                 if (!clearArtFiles.isEmpty()) {
                     QString newClearArtFileName = clearArtFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newClearArtFileName);
@@ -396,7 +396,7 @@ void Renamer::renameMovies(QList<Movie*> movies, const QString &filePattern, con
             // Rename CdArt
             if (!cdArt.isEmpty()) {
                 QString cdArtFileName = QFileInfo(cdArt).fileName();
-                QList<DataFile> cdArtFiles = Settings::instance()->dataFiles(DataFileType::MovieCdArt);
+                const QList<DataFile> &cdArtFiles = Settings::instance()->dataFiles(DataFileType::MovieCdArt);
                 if (!cdArtFiles.isEmpty()) {
                     QString newCdArtFileName = cdArtFiles.first().saveFileName(newFileName, -1, movie->files().count() > 1);
                     Helper::sanitizeFileName(newCdArtFileName);
@@ -518,7 +518,7 @@ void Renamer::renameEpisodes(QList<TvShowEpisode *> episodes, const QString &fil
             // Rename nfo
             if (!nfo.isEmpty()) {
                 QString nfoFileName = QFileInfo(nfo).fileName();
-                QList<DataFile> nfoFiles = Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo);
+                const QList<DataFile> &nfoFiles = Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo);
                 if (!nfoFiles.isEmpty()) {
                     newNfoFileName = nfoFiles.first().saveFileName(newFileName);
                     Helper::sanitizeFileName(newNfoFileName);
@@ -535,7 +535,7 @@ void Renamer::renameEpisodes(QList<TvShowEpisode *> episodes, const QString &fil
             // Rename Thumbnail
             if (!thumbnail.isEmpty()) {
                 QString thumbnailFileName = QFileInfo(thumbnail).fileName();
-                QList<DataFile> thumbnailFiles = Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb);
+                const QList<DataFile> &thumbnailFiles = Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb);
                 if (!thumbnailFiles.isEmpty()) {
                     newThumbnailFileName = thumbnailFiles.first().saveFileName(newFileName, -1, episode->files().count() > 1);
                     Helper::sanitizeFileName(newThumbnailFileName);
@@ -703,7 +703,7 @@ void Renamer::renameConcerts(QList<Concert*> concerts, const QString &filePatter
             // Rename nfo
             if (!nfo.isEmpty()) {
                 QString nfoFileName = QFileInfo(nfo).fileName();
-                QList<DataFile> nfoFiles = Settings::instance()->dataFiles(DataFileType::ConcertNfo);
+                const QList<DataFile> &nfoFiles = Settings::instance()->dataFiles(DataFileType::ConcertNfo);
                 if (!nfoFiles.isEmpty()) {
                     QString newNfoFileName = nfoFiles.first().saveFileName(newFileName, -1, concert->files().count() > 1);
                     Helper::sanitizeFileName(newNfoFileName);
@@ -720,7 +720,7 @@ void Renamer::renameConcerts(QList<Concert*> concerts, const QString &filePatter
             // Rename Poster
             if (!poster.isEmpty()) {
                 QString posterFileName = QFileInfo(poster).fileName();
-                QList<DataFile> posterFiles = Settings::instance()->dataFiles(DataFileType::ConcertPoster);
+                const QList<DataFile> &posterFiles = Settings::instance()->dataFiles(DataFileType::ConcertPoster);
                 if (!posterFiles.isEmpty()) {
                     QString newPosterFileName = posterFiles.first().saveFileName(newFileName, -1, concert->files().count() > 1);
                     Helper::sanitizeFileName(newPosterFileName);
@@ -737,7 +737,7 @@ void Renamer::renameConcerts(QList<Concert*> concerts, const QString &filePatter
             // Rename Fanart
             if (!fanart.isEmpty()) {
                 QString fanartFileName = QFileInfo(fanart).fileName();
-                QList<DataFile> fanartFiles = Settings::instance()->dataFiles(DataFileType::ConcertBackdrop);
+                const QList<DataFile> &fanartFiles = Settings::instance()->dataFiles(DataFileType::ConcertBackdrop);
                 if (!fanartFiles.isEmpty()) {
                     QString newFanartFileName = fanartFiles.first().saveFileName(newFileName, -1, concert->files().count() > 1);
                     Helper::sanitizeFileName(newFanartFileName);
@@ -2,7 +2,7 @@
 
 #include <QDebug>
 #include <QGridLayout>
-#include <QRegExp>
+#include <QSet>
 #include "data/Storage.h"
 #include "main/MainWindow.h"
 
@@ -55,6 +55,31 @@ AEBN::AEBN(QObject *parent)
                       << MovieScraperInfos::Director
                       << MovieScraperInfos::Set
                       << MovieScraperInfos::Tags;
+    setupExtractors();
+}
+
+void AEBN::setupExtractors()
+{
+    m_searchExtractor.addField("result", "<a id=\"FTSMovieSearch_link_image_detail_[0-9]+\" href=\"/dispatcher/movieDetail\\?movieId=([0-9]+)([^\"]*)\" title=\"([^\"]*)\"><img src=\"([^\"]*)\" alt=\"([^\"]*)\" /></a>",
+                               HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "<h1 itemprop=\"name\"  class=\"md-movieTitle\"  >(.*)</h1>");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "<span class=\"runTime\"><span itemprop=\"duration\" content=\"([^\"]*)\">([0-9]+)</span>");
+    m_infoExtractor.addField("released", MovieScraperInfos::Released, "<span class=\"detailsLink\" itemprop=\"datePublished\" content=\"([0-9]{4})(.*)\">");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "<span itemprop=\"about\">(.*)</span>");
+    m_infoExtractor.addField("poster", MovieScraperInfos::Poster, "<div id=\"md-boxCover\"><a href=\"([^\"]*)\" target=\"_blank\" onclick=\"([^\"]*)\"><img itemprop=\"thumbnailUrl\" src=\"([^\"]*)\" alt=\"([^\"]*)\" name=\"boxImage\" id=\"boxImage\" /></a>");
+    m_infoExtractor.addField("set", MovieScraperInfos::Set, "<span class=\"detailsLink\"><a href=\"([^\"]*)\" class=\"series\">(.*)</a>");
+    m_infoExtractor.addField("director", MovieScraperInfos::Director, "<span class=\"detailsLink\" itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\">(.*)<a href=\"(.*)\" itemprop=\"name\">(.*)</a>");
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "<a href=\"(.*)\" itemprop=\"productionCompany\">(.*)</a>");
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "<a href=\"(.*)\"(.*) itemprop=\"genre\">(.*)</a>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("sexAct", MovieScraperInfos::Tags, "<a href=\"(.*)sexActs=[0-9]*(.*)\" (.*)>(.*)</a>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("position", MovieScraperInfos::Tags, "<a href=\"(.*)positions=[0-9]*(.*)\" (.*)>(.*)</a>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("star", MovieScraperInfos::Actors, "<a href=\"/dispatcher/starDetail\\?(.*)starId=([0-9]*)&amp;(.*)\"  class=\"linkWithPopup\" onmouseover=\"(.*)\" onmouseout=\"killPopUp\\(\\)\"   itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>",
+                             HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("actor", MovieScraperInfos::Actors, "<a href=\"([^\"]*)\"   itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>",
+                             HtmlExtractor::AllMatches);
+
+    m_actorExtractor.addField("image", "<img itemprop=\"image\" src=\"([^\"]*)\" alt=\"([^\"]*)\" class=\"star\" />");
 }
 
 QString AEBN::name()
@@ -115,15 +140,11 @@ void AEBN::onSearchFinished()
 QList<ScraperSearchResult> AEBN::parseSearch(QString html)
 {
     QList<ScraperSearchResult> results;
-    int offset = 0;
-    QRegExp rx("<a id=\"FTSMovieSearch_link_image_detail_[0-9]+\" href=\"/dispatcher/movieDetail\\?movieId=([0-9]+)([^\"]*)\" title=\"([^\"]*)\"><img src=\"([^\"]*)\" alt=\"([^\"]*)\" /></a>");
-    rx.setMinimal(true);
-    while ((offset = rx.indexIn(html, offset)) != -1) {
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.id = rx.cap(1);
-        result.name = rx.cap(3);
+        result.id = match.at(0);
+        result.name = match.at(2);
         results << result;
-        offset += rx.matchedLength();
     }
 
     return results;
@@ -162,112 +183,70 @@ void AEBN::onLoadFinished()
 
 void AEBN::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos, QStringList &actorIds)
 {
-    QRegExp rx;
-    rx.setMinimal(true);
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
-    rx.setPattern("<h1 itemprop=\"name\"  class=\"md-movieTitle\"  >(.*)</h1>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setName(rx.cap(1));
+    if (fields.contains("title"))
+        movie->setName(fields.value("title"));
 
-    rx.setPattern("<span class=\"runTime\"><span itemprop=\"duration\" content=\"([^\"]*)\">([0-9]+)</span>");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1)
-        movie->setRuntime(rx.cap(2).toInt());
+    if (fields.contains("runtime"))
+        movie->setRuntime(fields.value("runtime", 2).toInt());
 
-    rx.setPattern("<span class=\"detailsLink\" itemprop=\"datePublished\" content=\"([0-9]{4})(.*)\">");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1), "yyyy"));
+    if (fields.contains("released"))
+        movie->setReleased(QDate::fromString(fields.value("released"), "yyyy"));
 
-    rx.setPattern("<span itemprop=\"about\">(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1) {
-        movie->setOverview(rx.cap(1));
+    if (fields.contains("overview")) {
+        movie->setOverview(fields.value("overview"));
         if (Settings::instance()->usePlotForOutline())
-            movie->setOutline(rx.cap(1));
+            movie->setOutline(fields.value("overview"));
     }
 
-    rx.setPattern("<div id=\"md-boxCover\"><a href=\"([^\"]*)\" target=\"_blank\" onclick=\"([^\"]*)\"><img itemprop=\"thumbnailUrl\" src=\"([^\"]*)\" alt=\"([^\"]*)\" name=\"boxImage\" id=\"boxImage\" /></a>");
-    if (infos.contains(MovieScraperInfos::Poster) && rx.indexIn(html) != -1) {
+    if (fields.contains("poster")) {
         Poster p;
-        p.thumbUrl = rx.cap(3);
-        p.originalUrl = rx.cap(1);
+        p.thumbUrl = fields.value("poster", 3);
+        p.originalUrl = fields.value("poster");
         movie->addPoster(p);
     }
 
-    rx.setPattern("<span class=\"detailsLink\"><a href=\"([^\"]*)\" class=\"series\">(.*)</a>");
-    if (infos.contains(MovieScraperInfos::Set) && rx.indexIn(html) != -1)
-        movie->setSet(rx.cap(2));
-
-    rx.setPattern("<span class=\"detailsLink\" itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\">(.*)<a href=\"(.*)\" itemprop=\"name\">(.*)</a>");
-    if (infos.contains(MovieScraperInfos::Director) && rx.indexIn(html) != -1)
-        movie->setDirector(rx.cap(3));
-
-    rx.setPattern("<a href=\"(.*)\" itemprop=\"productionCompany\">(.*)</a>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1)
-        movie->addStudio(rx.cap(2));
-
-    if (infos.contains(MovieScraperInfos::Genres)) {
-        int offset = 0;
-        rx.setPattern("<a href=\"(.*)\"(.*) itemprop=\"genre\">(.*)</a>");
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            movie->addGenre(rx.cap(3));
-            offset += rx.matchedLength();
-        }
-    }
-
-    if (infos.contains(MovieScraperInfos::Tags)) {
-        int offset = 0;
-        rx.setPattern("<a href=\"(.*)sexActs=[0-9]*(.*)\" (.*)>(.*)</a>");
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            movie->addTag(rx.cap(4));
-            offset += rx.matchedLength();
-        }
-        offset = 0;
-        rx.setPattern("<a href=\"(.*)positions=[0-9]*(.*)\" (.*)>(.*)</a>");
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            movie->addTag(rx.cap(4));
-            offset += rx.matchedLength();
-        }
+    if (fields.contains("set"))
+        movie->setSet(fields.value("set", 2));
+
+    if (fields.contains("director"))
+        movie->setDirector(fields.value("director", 3));
+
+    if (fields.contains("studio"))
+        movie->addStudio(fields.value("studio", 2));
+
+    foreach (const QString &genre, fields.values("genre", 3))
+        movie->addGenre(genre);
+
+    foreach (const QString &tag, fields.values("sexAct", 4))
+        movie->addTag(tag);
+    foreach (const QString &tag, fields.values("position", 4))
+        movie->addTag(tag);
+
+    QSet<QString> actorNames;
+    foreach (const Actor &a, movie->actors())
+        actorNames.insert(a.name);
+
+    foreach (const QStringList &star, fields.matches("star")) {
+        if (actorNames.contains(star.at(4)))
+            continue;
+        actorNames.insert(star.at(4));
+        Actor a;
+        a.name = star.at(4);
+        a.id = star.at(1);
+        movie->addActor(a);
+        if (Settings::instance()->downloadActorImages() && !actorIds.contains(star.at(1)))
+            actorIds.append(star.at(1));
     }
 
-    if (infos.contains(MovieScraperInfos::Actors)) {
-        int offset = 0;
-        rx.setPattern("<a href=\"/dispatcher/starDetail\\?(.*)starId=([0-9]*)&amp;(.*)\"  class=\"linkWithPopup\" onmouseover=\"(.*)\" onmouseout=\"killPopUp\\(\\)\"   itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>");
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            offset += rx.matchedLength();
-            bool skip = false;
-            foreach (Actor a, movie->actors()) {
-                if (a.name == rx.cap(5)) {
-                    skip = true;
-                    break;
-                }
-            }
-            if (skip)
-                continue;
-            Actor a;
-            a.name = rx.cap(5);
-            a.id = rx.cap(2);
-            movie->addActor(a);
-            if (Settings::instance()->downloadActorImages() && !actorIds.contains(rx.cap(2)))
-                actorIds.append(rx.cap(2));
-        }
-
-        offset = 0;
-        rx.setPattern("<a href=\"([^\"]*)\"   itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>");
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            offset += rx.matchedLength();
-            bool skip = false;
-            foreach (Actor a, movie->actors()) {
-                if (a.name == rx.cap(2)) {
-                    skip = true;
-                    break;
-                }
-            }
-            if (skip)
-                continue;
-
-            Actor a;
-            a.name = rx.cap(2);
-            movie->addActor(a);
-        }
+    foreach (const QStringList &actor, fields.matches("actor")) {
+        if (actorNames.contains(actor.at(1)))
+            continue;
+        actorNames.insert(actor.at(1));
+        Actor a;
+        a.name = actor.at(1);
+        movie->addActor(a);
     }
 }
 
@@ -306,12 +285,11 @@ void AEBN::onActorLoadFinished()
 
 void AEBN::parseAndAssignActor(QString html, Movie *movie, QString id)
 {
-    QRegExp rx("<img itemprop=\"image\" src=\"([^\"]*)\" alt=\"([^\"]*)\" class=\"star\" />");
-    rx.setMinimal(true);
-    if (rx.indexIn(html) != -1) {
+    HtmlExtractor::Result fields = m_actorExtractor.extract(html);
+    if (fields.contains("image")) {
         foreach (Actor *a, movie->actorsPointer()) {
             if (a->id == id)
-                a->thumb = rx.cap(1);
+                a->thumb = fields.value("image");
         }
     }
 }
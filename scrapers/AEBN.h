@@ -6,6 +6,7 @@
 #include <QObject>
 #include <QWidget>
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 class AEBN : public ScraperInterface
 {
@@ -38,12 +39,16 @@ private:
     QString m_language;
     QWidget *m_widget;
     QComboBox *m_box;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
+    HtmlExtractor m_actorExtractor;
 
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString html, Movie *movie, QList<int> infos, QStringList &actorIds);
     void downloadActors(Movie *movie, QStringList actorIds);
     void parseAndAssignActor(QString html, Movie *movie, QString id);
+    void setupExtractors();
 };
 
 #endif // AEBN_H
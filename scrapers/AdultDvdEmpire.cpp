@@ -1,7 +1,6 @@
 #include "AdultDvdEmpire.h"
 
 #include <QDebug>
-#include <QRegExp>
 #include <QTextDocument>
 #include "data/Storage.h"
 #include "settings/Settings.h"
@@ -20,6 +19,26 @@ AdultDvdEmpire::AdultDvdEmpire(QObject *parent)
                       << MovieScraperInfos::Studios
                       << MovieScraperInfos::Backdrop
                       << MovieScraperInfos::Set;
+    setupExtractors();
+}
+
+void AdultDvdEmpire::setupExtractors()
+{
+    m_searchExtractor.addField("result", "<p class=\"title\"><a href=\"/([^\"]*)\" title=\"([^\"]*)\"", HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "<h1>(.*)</h1>");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "<strong>Length</strong> ([0-9]*) hrs. ([0-9]*) mins.<br/>");
+    m_infoExtractor.addField("released", MovieScraperInfos::Released, "<strong>Production Year</strong> ([0-9]{4})<br/>");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "</p><p>(.*)</p></div");
+    m_infoExtractor.addField("poster", MovieScraperInfos::Poster, "<div id=\"Boxcover\"><a href=\"([^\"]*)\"");
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "Studio</strong>[^>]*>([^<]*)</a>");
+    m_infoExtractor.addField("set", MovieScraperInfos::Set, "<p><a href=\"[^\"]*/series/[^\"]*\">([^<]*)</a></p>");
+    m_infoExtractor.addField("categories", MovieScraperInfos::Genres, "Categories</h2><p>(.*)</p>");
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "<a href=\".*\">(.*)</a>", HtmlExtractor::AllMatches, "categories");
+    m_infoExtractor.addField("cast", MovieScraperInfos::Actors, "Cast</h2><ul class=\"cast listgrid listgrid3\">(.*)</ul>");
+    m_infoExtractor.addField("actor", MovieScraperInfos::Actors, "<a href=\".*\"><img src='(.*)' alt='.*' title='.*' /><br /><span>(.*)</span></a>", HtmlExtractor::AllMatches, "cast");
+
+    m_scenesExtractor.addField("scene", "<a rel=\"screenshots\" href=\"([^\"]*)\" class=\"fancy\" id=\"fancy\" [^>]*><img src=\"([^\"]*)\" alt", HtmlExtractor::AllMatches);
 }
 
 QString AdultDvdEmpire::name()
@@ -79,16 +98,12 @@ QList<ScraperSearchResult> AdultDvdEmpire::parseSearch(QString html)
 {
     QTextDocument doc;
     QList<ScraperSearchResult> results;
-    int offset = 0;
-    QRegExp rx("<p class=\"title\"><a href=\"/([^\"]*)\" title=\"([^\"]*)\"");
-    rx.setMinimal(true);
-    while ((offset = rx.indexIn(html, offset)) != -1) {
-        doc.setHtml(rx.cap(2).trimmed());
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
+        doc.setHtml(match.at(1).trimmed());
         ScraperSearchResult result;
-        result.id = rx.cap(1);
+        result.id = match.at(0);
         result.name = doc.toPlainText();
         results << result;
-        offset += rx.matchedLength();
     }
 
     return results;
@@ -133,85 +148,57 @@ void AdultDvdEmpire::onLoadFinished()
 void AdultDvdEmpire::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos)
 {
     QTextDocument doc;
-    QRegExp rx;
-    rx.setMinimal(true);
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
-    rx.setPattern("<h1>(.*)</h1>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1) {
-        doc.setHtml(rx.cap(1).trimmed());
+    if (fields.contains("title")) {
+        doc.setHtml(fields.value("title").trimmed());
         movie->setName(doc.toPlainText());
     }
 
-    rx.setPattern("<strong>Length</strong> ([0-9]*) hrs. ([0-9]*) mins.<br/>");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1)
-        movie->setRuntime(rx.cap(1).toInt()*60 + rx.cap(2).toInt());
+    if (fields.contains("runtime"))
+        movie->setRuntime(fields.value("runtime").toInt()*60 + fields.value("runtime", 2).toInt());
 
-    rx.setPattern("<strong>Production Year</strong> ([0-9]{4})<br/>");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1), "yyyy"));
+    if (fields.contains("released"))
+        movie->setReleased(QDate::fromString(fields.value("released"), "yyyy"));
 
-    rx.setPattern("</p><p>(.*)</p></div");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1) {
-        doc.setHtml(rx.cap(1).trimmed());
+    if (fields.contains("overview")) {
+        doc.setHtml(fields.value("overview").trimmed());
         movie->setOverview(doc.toPlainText());
         if (Settings::instance()->usePlotForOutline())
             movie->setOutline(doc.toPlainText());
     }
 
-    rx.setPattern("<div id=\"Boxcover\"><a href=\"([^\"]*)\"");
-    if (infos.contains(MovieScraperInfos::Poster) && rx.indexIn(html) != -1) {
+    if (fields.contains("poster")) {
         Poster p;
-        p.thumbUrl = rx.cap(1);
-        p.originalUrl = rx.cap(1);
+        p.thumbUrl = fields.value("poster");
+        p.originalUrl = fields.value("poster");
         movie->addPoster(p);
     }
 
-    rx.setPattern("Studio</strong>[^>]*>([^<]*)</a>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1) {
-        doc.setHtml(rx.cap(1));
+    if (fields.contains("studio")) {
+        doc.setHtml(fields.value("studio"));
         movie->addStudio(doc.toPlainText());
     }
 
-    rx.setPattern("<p><a href=\"[^\"]*/series/[^\"]*\">([^<]*)</a></p>");
-    if (infos.contains(MovieScraperInfos::Set) && rx.indexIn(html) != -1) {
-        QString set = rx.cap(1);
+    if (fields.contains("set")) {
+        QString set = fields.value("set");
         if (set.endsWith("Series", Qt::CaseInsensitive))
             set.chop(6);
         doc.setHtml(set.trimmed());
         movie->setSet(doc.toPlainText());
     }
 
-    if (infos.contains(MovieScraperInfos::Genres)) {
-        rx.setPattern("Categories</h2><p>(.*)</p>");
-        if (rx.indexIn(html) != -1) {
-            QRegExp rx2("<a href=\".*\">(.*)</a>");
-            rx2.setMinimal(true);
-            QString categories = rx.cap(1);
-            int offset = 0;
-            while ((offset = rx2.indexIn(categories, offset)) != -1) {
-                doc.setHtml(rx2.cap(1));
-                movie->addGenre(doc.toPlainText());
-                offset += rx2.matchedLength();
-            }
-        }
+    foreach (const QString &genre, fields.values("genre")) {
+        doc.setHtml(genre);
+        movie->addGenre(doc.toPlainText());
     }
 
-    if (infos.contains(MovieScraperInfos::Actors)) {
-        int offset = 0;
-        rx.setPattern("Cast</h2><ul class=\"cast listgrid listgrid3\">(.*)</ul>");
-        if (rx.indexIn(html) != -1) {
-            QString cast = rx.cap(1);
-            QRegExp rx2("<a href=\".*\"><img src='(.*)' alt='.*' title='.*' /><br /><span>(.*)</span></a>");
-            rx2.setMinimal(true);
-            while ((offset = rx2.indexIn(cast, offset)) != -1) {
-                offset += rx2.matchedLength();
-                doc.setHtml(rx2.cap(2));
-                Actor a;
-                a.name = doc.toPlainText();
-                a.thumb = rx2.cap(1);
-                movie->addActor(a);
-            }
-        }
+    foreach (const QStringList &actor, fields.matches("actor")) {
+        doc.setHtml(actor.at(1));
+        Actor a;
+        a.name = doc.toPlainText();
+        a.thumb = actor.at(0);
+        movie->addActor(a);
     }
 }
 
@@ -233,14 +220,10 @@ void AdultDvdEmpire::onLoadScenesFinished()
 
 void AdultDvdEmpire::parseAndAssignScenes(QString html, Movie *movie)
 {
-    QRegExp rx("<a rel=\"screenshots\" href=\"([^\"]*)\" class=\"fancy\" id=\"fancy\" [^>]*><img src=\"([^\"]*)\" alt");
-    rx.setMinimal(true);
-    int offset = 0;
-    while ((offset = rx.indexIn(html, offset)) != -1) {
-        offset += rx.matchedLength();
+    foreach (const QStringList &scene, m_scenesExtractor.extract(html).matches("scene")) {
         Poster p;
-        p.thumbUrl = rx.cap(2);
-        p.originalUrl = rx.cap(1);
+        p.thumbUrl = scene.at(1);
+        p.originalUrl = scene.at(0);
         movie->addBackdrop(p);
     }
 }
@@ -5,6 +5,7 @@
 #include <QObject>
 #include <QWidget>
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 class AdultDvdEmpire : public ScraperInterface
 {
@@ -34,11 +35,15 @@ private slots:
 private:
     QNetworkAccessManager m_qnam;
     QList<int> m_scraperSupports;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
+    HtmlExtractor m_scenesExtractor;
 
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString html, Movie *movie, QList<int> infos);
     void parseAndAssignScenes(QString html, Movie *movie);
+    void setupExtractors();
 };
 
 #endif // ADULTDVDEMPIRE_H
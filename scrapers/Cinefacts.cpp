@@ -1,4 +1,5 @@
 #include "Cinefacts.h"
+#include <QRegularExpression>
 #include <QTextDocument>
 #include <QWidget>
 #include "data/Storage.h"
@@ -26,6 +27,41 @@ Cinefacts::Cinefacts(QObject *parent)
                       << MovieScraperInfos::Poster
                       << MovieScraperInfos::Director
                       << MovieScraperInfos::Writer;
+    setupExtractors();
+}
+
+/**
+ * @brief Registers the patterns of all fields parsed from Cinefacts pages
+ */
+void Cinefacts::setupExtractors()
+{
+    m_searchExtractor.addField("result", "<a class=\"s_link\" href=\"/Filme/([^\"]*)\">([^<]*)</a>", HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "<span itemprop=\"name\">(.*)</span>");
+    m_infoExtractor.addField("originalTitle", MovieScraperInfos::Title, "<span itemprop=\"alternativeHeadline\" >(.*)</span>");
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "<span itemprop=\"genre\" >(.*)</span>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("year", MovieScraperInfos::Released, "<time datetime=\"[^\"]*\" itemprop=\"dateCreated\" >([0-9]{4})</time>");
+    m_infoExtractor.addField("country", MovieScraperInfos::Countries, "<span itemprop=\"genre\" >[^>]*</span> \\| (.*) \\(<time datetime=");
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "<span itemscope itemprop=\"provider\" itemtype=\"http://www.schema.org/Organization\" ><span itemprop=\"name\" >([^<]*)</span>");
+    m_infoExtractor.addField("certification", MovieScraperInfos::Certification, "Freigegeben ab ([0-9]*) Jahren");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "<time itemprop=\"duration\" datetime=\"PT[^\"]*\" >([0-9]*)</time>");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "<span class=\"thisSummary\" itemprop=\"description\">.*<strong>Inhalt: </strong>(.*)</span>");
+
+    m_actorsExtractor.addField("director", MovieScraperInfos::Director,
+                               "<h4>Regie</h4></header><div class=\"teasers  teasers_full\"><article><div class=\"item_content\"><header><h5><a href=\"[^\"]*\">(.*)</a></h5>");
+    m_actorsExtractor.addField("writer", MovieScraperInfos::Writer,
+                               "<h4>Drehbuch</h4></header><div class=\"teasers  teasers_full\"><article><div class=\"item_content\"><header><h5><a href=\"[^\"]*\">(.*)</a>");
+    m_actorsExtractor.addField("actors", MovieScraperInfos::Actors, "<section><header><h4>Darsteller</h4></header><div class=\"teasers  teasers_bild\">(.*)</div></section>");
+    m_actorsExtractor.addField("actor", MovieScraperInfos::Actors,
+                               "<article><figure class=\"item_img\"><a href=\"[^\"]*\"><img  src=\"(.*)\" class=\"thumb\" ></a></figure><div class=\"item_content\"><header><h5><a href=\".*\">(.*)</a><span class=\"right2\"> Rolle: (.*)</span></h5></header>",
+                               HtmlExtractor::AllMatches, "actors");
+
+    m_imagesExtractor.addField("posters", "<header><h3>Poster</h3></header>.*<ul>(.*)</ul>");
+    m_imagesExtractor.addField("poster", "<li><a href=\"([^\"]*)\">", HtmlExtractor::AllMatches, "posters");
+    m_imagesExtractor.addField("backgrounds", "<header><h3>Szenenbilder</h3></header>.*<ul>(.*)</ul>");
+    m_imagesExtractor.addField("background", "<li><a href=\"([^\"]*)\">", HtmlExtractor::AllMatches, "backgrounds");
+
+    m_imageExtractor.addField("image", "<a href=\"([^\"]*)\" target=\"_blank\">Bild in Originalgr..e</a>");
 }
 
 /**
@@ -154,24 +190,21 @@ void Cinefacts::searchFinished()
 QList<ScraperSearchResult> Cinefacts::parseSearch(QString html)
 {
     QList<ScraperSearchResult> results;
-    int pos = 0;
-    QRegExp rx("<a class=\"s_link\" href=\"/Filme/([^\"]*)\">([^<]*)</a>");
-    rx.setMinimal(true);
-    while ((pos = rx.indexIn(html, pos)) != -1) {
+    static const QRegularExpression yearRx("(.*) \\[([0-9]{4})\\]",
+                                           QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.id = rx.cap(1);
+        result.id = match.at(0);
 
-        QRegExp rx2("(.*) \\[([0-9]{4})\\]");
-        rx2.setMinimal(true);
-        if (rx2.indexIn(rx.cap(2)) != -1) {
-            result.name = rx2.cap(1);
-            result.released = QDate::fromString(rx2.cap(2), "yyyy");
+        QRegularExpressionMatch yearMatch = yearRx.match(match.at(1));
+        if (yearMatch.hasMatch()) {
+            result.name = yearMatch.captured(1);
+            result.released = QDate::fromString(yearMatch.captured(2), "yyyy");
         } else {
-            result.name = rx.cap(2);
+            result.name = match.at(1);
         }
 
         results.append(result);
-        pos += rx.matchedLength();
     }
     return results;
 }
@@ -293,59 +326,44 @@ void Cinefacts::imagesFinished()
  */
 void Cinefacts::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos)
 {
-    QRegExp rx;
-    rx.setMinimal(true);
     QTextDocument doc;
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
     // Title
-    rx.setPattern("<span itemprop=\"name\">(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setName(rx.cap(1).trimmed());
+    if (fields.contains("title"))
+        movie->setName(fields.value("title").trimmed());
 
     // Original Title
-    rx.setPattern("<span itemprop=\"alternativeHeadline\" >(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setOriginalName(rx.cap(1).trimmed());
+    if (fields.contains("originalTitle"))
+        movie->setOriginalName(fields.value("originalTitle").trimmed());
 
     // Genre
-    if (infos.contains(MovieScraperInfos::Genres)) {
-        rx.setPattern("<span itemprop=\"genre\" >(.*)</span>");
-        int offset = 0;
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            offset += rx.matchedLength();
-            movie->addGenre(rx.cap(1));
-        }
-    }
+    foreach (const QString &genre, fields.values("genre"))
+        movie->addGenre(genre);
 
     // Year
-    rx.setPattern("<time datetime=\"[^\"]*\" itemprop=\"dateCreated\" >([0-9]{4})</time>");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1).trimmed(), "yyyy"));
+    if (fields.contains("year"))
+        movie->setReleased(QDate::fromString(fields.value("year").trimmed(), "yyyy"));
 
     // Country
-    rx.setPattern("<span itemprop=\"genre\" >[^>]*</span> \\| (.*) \\(<time datetime=");
-    if (infos.contains(MovieScraperInfos::Countries) && rx.indexIn(html) != -1)
-        movie->addCountry(Helper::mapCountry(rx.cap(1).trimmed()));
+    if (fields.contains("country"))
+        movie->addCountry(Helper::mapCountry(fields.value("country").trimmed()));
 
     // Studio
-    rx.setPattern("<span itemscope itemprop=\"provider\" itemtype=\"http://www.schema.org/Organization\" ><span itemprop=\"name\" >([^<]*)</span>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1)
-        movie->addStudio(Helper::mapStudio(rx.cap(1).trimmed()));
+    if (fields.contains("studio"))
+        movie->addStudio(Helper::mapStudio(fields.value("studio").trimmed()));
 
     // MPAA
-    rx.setPattern("Freigegeben ab ([0-9]*) Jahren");
-    if (infos.contains(MovieScraperInfos::Certification) && rx.indexIn(html) != -1)
-        movie->setCertification(Helper::mapCertification("FSK " + rx.cap(1)));
+    if (fields.contains("certification"))
+        movie->setCertification(Helper::mapCertification("FSK " + fields.value("certification")));
 
     // Runtime
-    rx.setPattern("<time itemprop=\"duration\" datetime=\"PT[^\"]*\" >([0-9]*)</time>");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1)
-        movie->setRuntime(rx.cap(1).trimmed().toInt());
+    if (fields.contains("runtime"))
+        movie->setRuntime(fields.value("runtime").trimmed().toInt());
 
     // Overview
-    rx.setPattern("<span class=\"thisSummary\" itemprop=\"description\">.*<strong>Inhalt: </strong>(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1) {
-        doc.setHtml(rx.cap(1).trimmed());
+    if (fields.contains("overview")) {
+        doc.setHtml(fields.value("overview").trimmed());
         movie->setOverview(doc.toPlainText());
         if (Settings::instance()->usePlotForOutline())
             movie->setOutline(doc.toPlainText());
@@ -354,69 +372,30 @@ void Cinefacts::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos
 
 void Cinefacts::parseAndAssignActors(QString html, Movie *movie, QList<int> infos)
 {
-    QRegExp rx;
-    rx.setMinimal(true);
-    if (infos.contains(MovieScraperInfos::Director)) {
-        rx.setPattern("<h4>Regie</h4></header><div class=\"teasers  teasers_full\"><article><div class=\"item_content\"><header><h5><a href=\"[^\"]*\">(.*)</a></h5>");
-        if (rx.indexIn(html) != 1)
-            movie->setDirector(rx.cap(1));
-    }
-
-    if (infos.contains(MovieScraperInfos::Writer)) {
-        rx.setPattern("<h4>Drehbuch</h4></header><div class=\"teasers  teasers_full\"><article><div class=\"item_content\"><header><h5><a href=\"[^\"]*\">(.*)</a>");
-        if (rx.indexIn(html) != 1)
-            movie->setWriter(rx.cap(1));
-    }
-
-    if (infos.contains(MovieScraperInfos::Actors)) {
-        rx.setPattern("<section><header><h4>Darsteller</h4></header><div class=\"teasers  teasers_bild\">(.*)</div></section>");
-        if (rx.indexIn(html) != -1) {
-            QString actors = rx.cap(1);
-            QRegExp rx2("<article><figure class=\"item_img\"><a href=\"[^\"]*\"><img  src=\"(.*)\" class=\"thumb\" ></a></figure><div class=\"item_content\"><header><h5><a href=\".*\">(.*)</a><span class=\"right2\"> Rolle: (.*)</span></h5></header>");
-            rx2.setMinimal(true);
-            int pos = 0;
-            while ((pos = rx2.indexIn(actors, pos)) != -1) {
-                QString thumb = rx2.cap(1);
-                if (!thumb.startsWith("http://"))
-                    thumb.prepend("http://www.cinefacts.de");
-                Actor a;
-                a.name = rx2.cap(2);
-                a.role = rx2.cap(3);
-                a.thumb = thumb;
-                movie->addActor(a);
-                pos += rx2.matchedLength();
-            }
-        }
+    HtmlExtractor::Result fields = m_actorsExtractor.extract(html, infos);
+    if (fields.contains("director"))
+        movie->setDirector(fields.value("director"));
+
+    if (fields.contains("writer"))
+        movie->setWriter(fields.value("writer"));
+
+    foreach (const QStringList &actor, fields.matches("actor")) {
+        QString thumb = actor.at(0);
+        if (!thumb.startsWith("http://"))
+            thumb.prepend("http://www.cinefacts.de");
+        Actor a;
+        a.name = actor.at(1);
+        a.role = actor.at(2);
+        a.thumb = thumb;
+        movie->addActor(a);
     }
 }
 
 void Cinefacts::parseImages(QString data, QStringList &posters, QStringList &backgrounds)
 {
-    QRegExp rx("<header><h3>Poster</h3></header>.*<ul>(.*)</ul>");
-    rx.setMinimal(true);
-    if (rx.indexIn(data) != -1) {
-        QString poster = rx.cap(1);
-        QRegExp rx2("<li><a href=\"([^\"]*)\">");
-        rx2.setMinimal(true);
-        int pos = 0;
-        while ((pos = rx2.indexIn(poster, pos)) != -1) {
-            posters.append(rx2.cap(1));
-            pos += rx2.matchedLength();
-        }
-    }
-
-    rx.setPattern("<header><h3>Szenenbilder</h3></header>.*<ul>(.*)</ul>");
-    rx.setMinimal(true);
-    if (rx.indexIn(data) != -1) {
-        QString background = rx.cap(1);
-        QRegExp rx2("<li><a href=\"([^\"]*)\">");
-        rx2.setMinimal(true);
-        int pos = 0;
-        while ((pos = rx2.indexIn(background, pos)) != -1) {
-            backgrounds.append(rx2.cap(1));
-            pos += rx2.matchedLength();
-        }
-    }
+    HtmlExtractor::Result fields = m_imagesExtractor.extract(data);
+    posters.append(fields.values("poster"));
+    backgrounds.append(fields.values("background"));
 }
 
 
@@ -437,12 +416,11 @@ void Cinefacts::posterFinished()
 
     if (reply->error() == QNetworkReply::NoError ) {
         QString msg = QString::fromUtf8(reply->readAll());
-        QRegExp rx("<a href=\"([^\"]*)\" target=\"_blank\">Bild in Originalgr..e</a>");
-        rx.setMinimal(true);
-        if (rx.indexIn(msg) != -1) {
+        HtmlExtractor::Result fields = m_imageExtractor.extract(msg);
+        if (fields.contains("image")) {
             Poster p;
-            p.thumbUrl = rx.cap(1);
-            p.originalUrl = rx.cap(1);
+            p.thumbUrl = fields.value("image");
+            p.originalUrl = fields.value("image");
             movie->addPoster(p);
         }
 
@@ -484,12 +462,11 @@ void Cinefacts::backdropFinished()
 
     if (reply->error() == QNetworkReply::NoError ) {
         QString msg = QString::fromUtf8(reply->readAll());
-        QRegExp rx("<a href=\"([^\"]*)\" target=\"_blank\">Bild in Originalgr..e</a>");
-        rx.setMinimal(true);
-        if (rx.indexIn(msg) != -1) {
+        HtmlExtractor::Result fields = m_imageExtractor.extract(msg);
+        if (fields.contains("image")) {
             Poster p;
-            p.thumbUrl = rx.cap(1);
-            p.originalUrl = rx.cap(1);
+            p.thumbUrl = fields.value("image");
+            p.originalUrl = fields.value("image");
             movie->addBackdrop(p);
         }
 
@@ -7,6 +7,7 @@
 #include <QObject>
 
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 /**
  * @brief The Cinefacts class
@@ -42,12 +43,18 @@ private slots:
 private:
     QNetworkAccessManager m_qnam;
     QList<int> m_scraperSupports;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
+    HtmlExtractor m_actorsExtractor;
+    HtmlExtractor m_imagesExtractor;
+    HtmlExtractor m_imageExtractor;
 
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString data, Movie *movie, QList<int> infos);
     void parseAndAssignActors(QString data, Movie *movie, QList<int> infos);
     void parseImages(QString data, QStringList &posters, QStringList &backgrounds);
+    void setupExtractors();
 };
 
 #endif // CINEFACTS_H
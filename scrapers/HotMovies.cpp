@@ -2,7 +2,6 @@
 
 #include <QDebug>
 #include <QGridLayout>
-#include <QRegExp>
 #include "data/Storage.h"
 #include "globals/Helper.h"
 #include "main/MainWindow.h"
@@ -53,6 +52,28 @@ HotMovies::HotMovies(QObject *parent)
                       << MovieScraperInfos::Studios
                       << MovieScraperInfos::Director
                       << MovieScraperInfos::Set;
+    setupExtractors();
+}
+
+void HotMovies::setupExtractors()
+{
+    m_searchExtractor.addField("result", "<tr>.*<td colspan=\"2\">.*<h3 class=\"title\">.*<a href=\"(.*)\" title=\".*\" >(.*)</a>", HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "<span itemprop=\"name\">(.*)</span>");
+    m_infoExtractor.addField("rating", MovieScraperInfos::Rating,
+                             "<span itemprop=\"name\">.*</span>.*</h1><hr/>.*<div class=\"rating\"><a href=\".*\" rel=\"nofollow\" title=\".*\"><img src=\"http://imgcover-[0-9].hotmovies.com/vodimages/images/stars-([0-9]+-[0-9]+).png\" border=\"0\" /></a><br/><span class=\"rating_number \">([0-9]+) .*</span></div>.*</div>.*<div class=\"video_info\">");
+    m_infoExtractor.addField("released", MovieScraperInfos::Released, "<span itemprop=\"copyrightYear\">([0-9]{4})</span>");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "<span itemprop=\"duration\" datetime=\"PT[^\"]*\">(.*)</span>");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "var descfullcontent = \"([^\"]*)\"");
+    m_infoExtractor.addField("poster", MovieScraperInfos::Poster, "<img alt=\"[^\"]*\" id=\"cover\" src=\"([^\"]*)\"");
+    m_infoExtractor.addField("actor", MovieScraperInfos::Actors,
+                             "key=\"([^\"]*)\"/> <img src=\"http://imgcover-[0-9]+.hotmovies.com/vodimages/images/spacer.gif\" class=\"lg_star_image\" /> </span><a href=\"[^\"]*\".*"
+                             "title=\"[^\"]*\" rel=\"tag\" itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>",
+                             HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "\">[^>]*[\\s]+->[\\s]([^>]*)</a>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "<a href=\".*\" title=\".*\" itemprop=\"productionCompany\" itemscope itemtype=\"http://schema.org/Organization\"><span itemprop=\"name\">(.*)</span></a>");
+    m_infoExtractor.addField("director", MovieScraperInfos::Director, "itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span>");
+    m_infoExtractor.addField("set", MovieScraperInfos::Set, "<a href=\"http://www.hotmovies.com/.*[/?]series/[^\"]*\" title=\"[^\"]*\" rel=\"tag\">(.*)</a>");
 }
 
 QString HotMovies::name()
@@ -118,16 +139,11 @@ void HotMovies::onSearchFinished()
 QList<ScraperSearchResult> HotMovies::parseSearch(QString html)
 {
     QList<ScraperSearchResult> results;
-    int offset = 0;
-
-    QRegExp rx("<tr>.*<td colspan=\"2\">.*<h3 class=\"title\">.*<a href=\"(.*)\" title=\".*\" >(.*)</a>");
-    rx.setMinimal(true);
-    while ((offset = rx.indexIn(html, offset)) != -1) {
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.id = rx.cap(1);
-        result.name = rx.cap(2);
+        result.id = match.at(0);
+        result.name = match.at(1);
         results << result;
-        offset += rx.matchedLength();
     }
 
     return results;
@@ -160,80 +176,59 @@ void HotMovies::onLoadFinished()
 
 void HotMovies::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos)
 {
-    QRegExp rx;
-    rx.setMinimal(true);
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
-    rx.setPattern("<span itemprop=\"name\">(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setName(rx.cap(1));
+    if (fields.contains("title"))
+        movie->setName(fields.value("title"));
 
-    rx.setPattern("<span itemprop=\"name\">.*</span>.*</h1><hr/>.*<div class=\"rating\"><a href=\".*\" rel=\"nofollow\" title=\".*\"><img src=\"http://imgcover-[0-9].hotmovies.com/vodimages/images/stars-([0-9]+-[0-9]+).png\" border=\"0\" /></a><br/><span class=\"rating_number \">([0-9]+) .*</span></div>.*</div>.*<div class=\"video_info\">");
-    if (infos.contains(MovieScraperInfos::Rating) && rx.indexIn(html) != -1) {
-        movie->setRating(rx.cap(1).replace("-", ".").toFloat()*2);
-        movie->setVotes(rx.cap(2).toInt());
+    if (fields.contains("rating")) {
+        movie->setRating(fields.value("rating").replace("-", ".").toFloat()*2);
+        movie->setVotes(fields.value("rating", 2).toInt());
     }
 
-    rx.setPattern("<span itemprop=\"copyrightYear\">([0-9]{4})</span>");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1), "yyyy"));
+    if (fields.contains("released"))
+        movie->setReleased(QDate::fromString(fields.value("released"), "yyyy"));
 
-    rx.setPattern("<span itemprop=\"duration\" datetime=\"PT[^\"]*\">(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1) {
-        QStringList runtime = rx.cap(1).split(":");
+    if (fields.contains("runtime")) {
+        QStringList runtime = fields.value("runtime").split(":");
         if (runtime.count() == 3)
             movie->setRuntime(runtime.at(0).toInt()*60 + runtime.at(1).toInt());
         else if (runtime.count() == 2)
             movie->setRuntime(runtime.at(0).toInt());
     }
 
-    rx.setPattern("var descfullcontent = \"([^\"]*)\"");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1) {
-        movie->setOverview(QString::fromUtf8(QByteArray::fromPercentEncoding(rx.cap(1).toUtf8())));
+    if (fields.contains("overview")) {
+        QString overview = QString::fromUtf8(QByteArray::fromPercentEncoding(fields.value("overview").toUtf8()));
+        movie->setOverview(overview);
         if (Settings::instance()->usePlotForOutline())
-            movie->setOutline(QString::fromUtf8(QByteArray::fromPercentEncoding(rx.cap(1).toUtf8())));
+            movie->setOutline(overview);
     }
 
-    rx.setPattern("<img alt=\"[^\"]*\" id=\"cover\" src=\"([^\"]*)\"");
-    if (infos.contains(MovieScraperInfos::Poster) && rx.indexIn(html) != -1) {
+    if (fields.contains("poster")) {
         Poster p;
-        p.thumbUrl = rx.cap(1);
-        p.originalUrl = rx.cap(1);
+        p.thumbUrl = fields.value("poster");
+        p.originalUrl = fields.value("poster");
         movie->addPoster(p);
     }
 
-    if (infos.contains(MovieScraperInfos::Actors)) {
-        rx.setPattern("key=\"([^\"]*)\"/> <img src=\"http://imgcover-[0-9]+.hotmovies.com/vodimages/images/spacer.gif\" class=\"lg_star_image\" /> </span><a href=\"[^\"]*\".*"
-                      "title=\"[^\"]*\" rel=\"tag\" itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span></a>");
-        int offset = 0;
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            offset += rx.matchedLength();
-            Actor a;
-            a.name = rx.cap(2);
-            a.thumb = rx.cap(1);
-            movie->addActor(a);
-        }
+    foreach (const QStringList &actor, fields.matches("actor")) {
+        Actor a;
+        a.name = actor.at(1);
+        a.thumb = actor.at(0);
+        movie->addActor(a);
     }
 
-    if (infos.contains(MovieScraperInfos::Genres)) {
-        rx.setPattern("\">[^>]*[\\s]+->[\\s]([^>]*)</a>");
-        int offset = 0;
-        while ((offset = rx.indexIn(html, offset)) != -1) {
-            offset += rx.matchedLength();
-            movie->addGenre(rx.cap(1));
-        }
-    }
+    foreach (const QString &genre, fields.values("genre"))
+        movie->addGenre(genre);
 
-    rx.setPattern("<a href=\".*\" title=\".*\" itemprop=\"productionCompany\" itemscope itemtype=\"http://schema.org/Organization\"><span itemprop=\"name\">(.*)</span></a>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1)
-        movie->addStudio(rx.cap(1));
+    if (fields.contains("studio"))
+        movie->addStudio(fields.value("studio"));
 
-    rx.setPattern("itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\"><span itemprop=\"name\">(.*)</span>");
-    if (infos.contains(MovieScraperInfos::Director) && rx.indexIn(html) != -1)
-        movie->setDirector(rx.cap(1));
+    if (fields.contains("director"))
+        movie->setDirector(fields.value("director"));
 
-    rx.setPattern("<a href=\"http://www.hotmovies.com/.*[/?]series/[^\"]*\" title=\"[^\"]*\" rel=\"tag\">(.*)</a>");
-    if (infos.contains(MovieScraperInfos::Set) && rx.indexIn(html) != -1)
-        movie->setSet(rx.cap(1));
+    if (fields.contains("set"))
+        movie->setSet(fields.value("set"));
 }
 
 bool HotMovies::hasSettings()
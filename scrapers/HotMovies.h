@@ -6,6 +6,7 @@
 #include <QObject>
 #include <QWidget>
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 class HotMovies : public ScraperInterface
 {
@@ -37,10 +38,13 @@ private:
     QString m_language;
     QWidget *m_widget;
     QComboBox *m_box;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
 
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString html, Movie *movie, QList<int> infos);
+    void setupExtractors();
 };
 
 #endif // HOTMOVIES_H
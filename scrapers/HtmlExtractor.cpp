@@ -0,0 +1,164 @@
+#include "HtmlExtractor.h"
+
+#include <QDebug>
+#include <QRegularExpressionMatchIterator>
+
+HtmlExtractor::HtmlExtractor()
+{
+}
+
+/**
+ * @brief Registers a field which is always extracted
+ * @param name Name of the field
+ * @param pattern Regular expression, captured groups are stored
+ * @param options Extract only the first or all matches, make quantifiers greedy
+ * @param parent If set, the pattern is applied to the first captured group of this field instead of the whole page
+ */
+void HtmlExtractor::addField(const QString &name, const QString &pattern, Options options, const QString &parent)
+{
+    addField(name, -1, pattern, options, parent);
+}
+
+/**
+ * @brief Registers a field which is only extracted if the given info should be loaded
+ * @param name Name of the field
+ * @param info Info the field belongs to (MovieScraperInfos)
+ * @param pattern Regular expression, captured groups are stored
+ * @param options Extract only the first or all matches, make quantifiers greedy
+ * @param parent If set, the pattern is applied to the first captured group of this field instead of the whole page
+ */
+void HtmlExtractor::addField(const QString &name, int info, const QString &pattern, Options options, const QString &parent)
+{
+    QRegularExpression::PatternOptions patternOptions = QRegularExpression::DotMatchesEverythingOption;
+    if (!options.testFlag(Greedy))
+        patternOptions |= QRegularExpression::InvertedGreedinessOption;
+
+    Field field;
+    field.name = name;
+    field.info = info;
+    field.parent = parent.isEmpty() ? -1 : m_fieldIndex.value(parent, -1);
+    field.allMatches = options.testFlag(AllMatches);
+    field.regex = QRegularExpression(pattern, patternOptions);
+    if (!field.regex.isValid())
+        qWarning() << "Invalid pattern for field" << name << field.regex.errorString();
+    if (!parent.isEmpty() && field.parent == -1)
+        qWarning() << "Parent field" << parent << "of" << name << "is not registered";
+
+    m_fieldIndex.insert(name, m_fields.count());
+    m_fields.append(field);
+}
+
+/**
+ * @brief Extracts all registered fields
+ * @param html Page content
+ * @return Captured groups
+ */
+HtmlExtractor::Result HtmlExtractor::extract(const QString &html) const
+{
+    return extract(html, QList<int>(), false);
+}
+
+/**
+ * @brief Extracts the fields belonging to the given infos and all fields without an info
+ * @param html Page content
+ * @param infos Infos to load
+ * @return Captured groups
+ */
+HtmlExtractor::Result HtmlExtractor::extract(const QString &html, const QList<int> &infos) const
+{
+    return extract(html, infos, true);
+}
+
+HtmlExtractor::Result HtmlExtractor::extract(const QString &html, const QList<int> &infos, bool filter) const
+{
+    Result result;
+    foreach (const Field &field, m_fields) {
+        if (filter && field.info != -1 && !infos.contains(field.info))
+            continue;
+
+        QList<QStringList> matches;
+        if (field.parent == -1) {
+            match(field, html, matches);
+        } else {
+            foreach (const QStringList &parentMatch, result.m_matches.value(m_fields.at(field.parent).name)) {
+                if (!parentMatch.isEmpty())
+                    match(field, parentMatch.first(), matches);
+            }
+        }
+
+        if (!matches.isEmpty())
+            result.m_matches.insert(field.name, matches);
+    }
+    return result;
+}
+
+void HtmlExtractor::match(const Field &field, const QString &text, QList<QStringList> &matches)
+{
+    int groups = field.regex.captureCount();
+    if (field.allMatches) {
+        QRegularExpressionMatchIterator it = field.regex.globalMatch(text);
+        while (it.hasNext()) {
+            QRegularExpressionMatch match = it.next();
+            QStringList captured;
+            for (int i=1 ; i<=groups ; ++i)
+                captured << match.captured(i);
+            matches.append(captured);
+        }
+    } else {
+        QRegularExpressionMatch match = field.regex.match(text);
+        if (match.hasMatch()) {
+            QStringList captured;
+            for (int i=1 ; i<=groups ; ++i)
+                captured << match.captured(i);
+            matches.append(captured);
+        }
+    }
+}
+
+/**
+ * @brief Checks if a field was found
+ * @param field Name of the field
+ * @return True if the pattern matched at least once
+ */
+bool HtmlExtractor::Result::contains(const QString &field) const
+{
+    return m_matches.contains(field);
+}
+
+/**
+ * @brief Returns a captured group of the first match of a field
+ * @param field Name of the field
+ * @param group Number of the captured group
+ * @return Captured text, empty if the field was not found
+ */
+QString HtmlExtractor::Result::value(const QString &field, int group) const
+{
+    QList<QStringList> matches = m_matches.value(field);
+    if (matches.isEmpty())
+        return QString();
+    return matches.first().value(group-1);
+}
+
+/**
+ * @brief Returns a captured group of all matches of a field
+ * @param field Name of the field
+ * @param group Number of the captured group
+ * @return List of captured texts
+ */
+QStringList HtmlExtractor::Result::values(const QString &field, int group) const
+{
+    QStringList values;
+    foreach (const QStringList &match, m_matches.value(field))
+        values << match.value(group-1);
+    return values;
+}
+
+/**
+ * @brief Returns all captured groups of all matches of a field
+ * @param field Name of the field
+ * @return List of matches, each containing the captured groups starting with group 1
+ */
+QList<QStringList> HtmlExtractor::Result::matches(const QString &field) const
+{
+    return m_matches.value(field);
+}
@@ -0,0 +1,68 @@
+#ifndef HTMLEXTRACTOR_H
+#define HTMLEXTRACTOR_H
+
+#include <QHash>
+#include <QList>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The HtmlExtractor class
+ *        Holds the field patterns of a scraper. Patterns are registered (and compiled) once
+ *        and then applied to every downloaded page. A field can be extracted from the
+ *        captured text of another field, e.g. all genre links inside the genre block.
+ *        Patterns behave like minimal QRegExps: quantifiers are non-greedy by default
+ *        and "." matches newlines.
+ */
+class HtmlExtractor
+{
+public:
+    enum Option {
+        FirstMatch = 0x0,
+        AllMatches = 0x1,
+        Greedy     = 0x2
+    };
+    Q_DECLARE_FLAGS(Options, Option)
+
+    /**
+     * @brief Captured groups of all fields found in a page
+     */
+    class Result
+    {
+    public:
+        bool contains(const QString &field) const;
+        QString value(const QString &field, int group = 1) const;
+        QStringList values(const QString &field, int group = 1) const;
+        QList<QStringList> matches(const QString &field) const;
+
+    private:
+        friend class HtmlExtractor;
+        QHash<QString, QList<QStringList> > m_matches;
+    };
+
+    HtmlExtractor();
+    void addField(const QString &name, const QString &pattern, Options options = FirstMatch, const QString &parent = QString());
+    void addField(const QString &name, int info, const QString &pattern, Options options = FirstMatch, const QString &parent = QString());
+    HtmlExtractor::Result extract(const QString &html) const;
+    HtmlExtractor::Result extract(const QString &html, const QList<int> &infos) const;
+
+private:
+    struct Field {
+        QString name;
+        int info;
+        int parent;
+        bool allMatches;
+        QRegularExpression regex;
+    };
+
+    QList<Field> m_fields;
+    QHash<QString, int> m_fieldIndex;
+
+    HtmlExtractor::Result extract(const QString &html, const QList<int> &infos, bool filter) const;
+    static void match(const Field &field, const QString &text, QList<QStringList> &matches);
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(HtmlExtractor::Options)
+
+#endif // HTMLEXTRACTOR_H
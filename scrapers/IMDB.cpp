@@ -1,7 +1,6 @@
 #include "IMDB.h"
 
-#include <QScriptEngine>
-#include <QScriptValueIterator>
+#include <QRegularExpression>
 #include <QWidget>
 #include "data/Storage.h"
 #include "globals/Helper.h"
@@ -25,6 +24,56 @@ IMDB::IMDB(QObject *parent)
                       << MovieScraperInfos::Countries
                       << MovieScraperInfos::Actors
                       << MovieScraperInfos::Poster;
+    setupExtractors();
+}
+
+void IMDB::setupExtractors()
+{
+    m_searchIdExtractor.addField("title", "<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">(.*)</span>");
+    m_searchIdExtractor.addField("yearLink", "<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">.*<span class=\"nobr\">\\(<a href=\"[^\"]*\" >([0-9]*)</a>\\)</span>");
+    m_searchIdExtractor.addField("year", "<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">.*</span>.*<span class=\"nobr\">\\(([0-9]*)\\)</span>");
+    m_searchIdExtractor.addField("id", "<link rel=\"canonical\" href=\"http://www.imdb.com/title/(.*)/\" />");
+
+    m_searchExtractor.addField("result", "<td class=\"result_text\"> <a href=\"/title/([t]*[\\d]+)/[^\"]*\" >([^<]*)</a>(?: \\(I+\\) | )\\(([0-9]*)\\) (?:</td>|<br/>)",
+                               HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "<h1 class=\"header\">[^<]*<span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>");
+    m_infoExtractor.addField("director", MovieScraperInfos::Director,
+                             "<div class=\"txt-block\" itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\">[^<]*"
+                             "<h4 class=\"inline\">Director:</h4>[^<]"
+                             "<a href=\"[^\"]*\" itemprop='url'><span class=\"itemprop\" itemprop=\"name\">([^<]*)</span></a>");
+    m_infoExtractor.addField("writer", MovieScraperInfos::Writer,
+                             "<div class=\"txt-block\" itemprop=\"creator\" itemscope itemtype=\"http://schema.org/Person\">[^<]*"
+                             "<h4 class=\"inline\">Writer:</h4>[^<]"
+                             "<a href=\"[^\"]*\" itemprop='url'><span class=\"itemprop\" itemprop=\"name\">([^<]*)</span></a>");
+    m_infoExtractor.addField("genres", MovieScraperInfos::Genres, "<div class=\"see-more inline canwrap\" itemprop=\"genre\">[^<]*<h4 class=\"inline\">Genres:</h4>(.*)</div>");
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "<a href=\"[^\"]*\" >([^<]*)</a>", HtmlExtractor::AllMatches, "genres");
+    m_infoExtractor.addField("tagline", MovieScraperInfos::Tagline, "<h4 class=\"inline\">Taglines:</h4>(.*)<span");
+    m_infoExtractor.addField("keywords", MovieScraperInfos::Tags, "<div class=\"see-more inline canwrap\" itemprop=\"keywords\">(.*)</div>");
+    m_infoExtractor.addField("keyword", MovieScraperInfos::Tags, "<span class=\"itemprop\" itemprop=\"keywords\">([^<]*)</span>", HtmlExtractor::AllMatches, "keywords");
+    m_infoExtractor.addField("released", MovieScraperInfos::Released, "<a href=\"[^\"]*\" title=\"See all release dates\" >[^<]*<meta itemprop=\"datePublished\" content=\"([^\"]*)\" />");
+    m_infoExtractor.addField("certification", MovieScraperInfos::Certification, "itemprop=\"contentRating\" content=\"([^\"]*)\"></span>");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "<time itemprop=\"duration\" datetime=\"PT([0-9]+)M\" >");
+    m_infoExtractor.addField("outline", MovieScraperInfos::Overview, "<p itemprop=\"description\">([^<]*)</p>");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "<div class=\"inline canwrap\" itemprop=\"description\">[^<]*<p>([^<]*)", HtmlExtractor::Greedy);
+    m_infoExtractor.addField("ratingBox", MovieScraperInfos::Rating, "<div class=\"star-box-details\" itemtype=\"http://schema.org/AggregateRating\" itemscope itemprop=\"aggregateRating\">(.*)</div>");
+    m_infoExtractor.addField("rating", MovieScraperInfos::Rating, "<span itemprop=\"ratingValue\">(.*)</span>", HtmlExtractor::FirstMatch, "ratingBox");
+    m_infoExtractor.addField("votes", MovieScraperInfos::Rating, "<span itemprop=\"ratingCount\">(.*)</span>", HtmlExtractor::FirstMatch, "ratingBox");
+    m_infoExtractor.addField("top250", MovieScraperInfos::Rating, "<strong>Top 250 #([0-9]+)</strong>");
+    m_infoExtractor.addField("studios", MovieScraperInfos::Studios, "<h3>Company Credits</h3>[^<]*<div class=\"txt-block\">(.*)</div>");
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "<span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>", HtmlExtractor::AllMatches, "studios");
+    m_infoExtractor.addField("countries", MovieScraperInfos::Countries, "<div class=\"txt-block\">[^<]*<h4 class=\"inline\">Country:</h4>(.*)</div>");
+    m_infoExtractor.addField("country", MovieScraperInfos::Countries, "<a href=\"[^\"]*\" itemprop='url'>([^<]*)</a>", HtmlExtractor::AllMatches, "countries");
+    m_infoExtractor.addField("castList", MovieScraperInfos::Actors, "<table class=\"cast_list\">(.*)</table>");
+    m_infoExtractor.addField("actor", MovieScraperInfos::Actors,
+                             "<tr class=\"[^\"]*\">[^<]*<td class=\"primary_photo\">[^<]*<a href=\"[^\"]*\" ><img [^<]*loadlate=\"([^\"]*)\"[^<]* /></a>[^<]*</td>[^<]*"
+                             "<td class=\"itemprop\" itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\">[^<]*<a href=\"[^\"]*\" itemprop='url'> <span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>.*"
+                             "<a href=\"/character/[^\"]*\" >([^<]*)</a>", HtmlExtractor::AllMatches, "castList");
+
+    m_posterPageExtractor.addField("image", "<div class=\"image\">(.*)</div>");
+    m_posterPageExtractor.addField("link", "<a href=\"([^\"]*)\" >", HtmlExtractor::FirstMatch, "image");
+
+    m_posterExtractor.addField("poster", MovieScraperInfos::Poster, "<img onmousedown=\"return false;\" onmousemove=\"return false;\" oncontextmenu=\"return false;\" id=\"primary-img\" title=\"[^\"]*\" alt=\"[^\"]*\" src=\"([^\"]*)\" />");
 }
 
 QNetworkAccessManager *IMDB::qnam()
@@ -113,26 +162,14 @@ void IMDB::onSearchIdFinished()
     QList<ScraperSearchResult> results;
     if (reply->error() == QNetworkReply::NoError) {
         QString msg = QString::fromUtf8(reply->readAll());
+        HtmlExtractor::Result fields = m_searchIdExtractor.extract(msg);
         ScraperSearchResult result;
-
-        QRegExp rx;
-        rx.setMinimal(true);
-        rx.setPattern("<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">(.*)</span>");
-        if (rx.indexIn(msg) != -1)
-            result.name = rx.cap(1);
-
-        rx.setPattern("<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">.*<span class=\"nobr\">\\(<a href=\"[^\"]*\" >([0-9]*)</a>\\)</span>");
-        if (rx.indexIn(msg) != -1) {
-            result.released = QDate::fromString(rx.cap( 1 ), "yyyy");
-        } else {
-            rx.setPattern("<h1 class=\"header\"> <span class=\"itemprop\" itemprop=\"name\">.*</span>.*<span class=\"nobr\">\\(([0-9]*)\\)</span>");
-            if (rx.indexIn(msg) != -1)
-                result.released = QDate::fromString(rx.cap(1), "yyyy");
-        }
-
-        rx.setPattern("<link rel=\"canonical\" href=\"http://www.imdb.com/title/(.*)/\" />");
-        if (rx.indexIn(msg) != -1)
-            result.id = rx.cap(1);
+        result.name = fields.value("title");
+        if (fields.contains("yearLink"))
+            result.released = QDate::fromString(fields.value("yearLink"), "yyyy");
+        else if (fields.contains("year"))
+            result.released = QDate::fromString(fields.value("year"), "yyyy");
+        result.id = fields.value("id");
 
         if ((!result.id.isEmpty()) && (!result.name.isEmpty()))
             results.append(result);
@@ -148,16 +185,12 @@ QList<ScraperSearchResult> IMDB::parseSearch(QString html)
 {
     QList<ScraperSearchResult> results;
 
-    QRegExp rx("<td class=\"result_text\"> <a href=\"/title/([t]*[\\d]+)/[^\"]*\" >([^<]*)</a>(?: \\(I+\\) | )\\(([0-9]*)\\) (?:</td>|<br/>)");
-    rx.setMinimal(true);
-    int pos = 0;
-    while ((pos = rx.indexIn(html, pos)) != -1) {
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.name = rx.cap(2);
-        result.id = rx.cap(1);
-        result.released = QDate::fromString(rx.cap(3), "yyyy");
+        result.name = match.at(1);
+        result.id = match.at(0);
+        result.released = QDate::fromString(match.at(2), "yyyy");
         results.append(result);
-        pos += rx.matchedLength();
     }
     return results;
 }
@@ -222,157 +255,88 @@ void IMDB::onPosterLoadFinished()
 
 void IMDB::parseAndAssignInfos(QString html, Movie *movie, QList<int> infos)
 {
-    QRegExp rx;
-    rx.setMinimal(true);
-
-    rx.setPattern("<h1 class=\"header\">[^<]*<span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setName(rx.cap(1));
-
-    rx.setPattern("<div class=\"txt-block\" itemprop=\"director\" itemscope itemtype=\"http://schema.org/Person\">[^<]*"
-                  "<h4 class=\"inline\">Director:</h4>[^<]"
-                  "<a href=\"[^\"]*\" itemprop='url'><span class=\"itemprop\" itemprop=\"name\">([^<]*)</span></a>");
-    if (infos.contains(MovieScraperInfos::Director) && rx.indexIn(html) != -1)
-        movie->setDirector(rx.cap(1));
-
-    rx.setPattern("<div class=\"txt-block\" itemprop=\"creator\" itemscope itemtype=\"http://schema.org/Person\">[^<]*"
-                  "<h4 class=\"inline\">Writer:</h4>[^<]"
-                  "<a href=\"[^\"]*\" itemprop='url'><span class=\"itemprop\" itemprop=\"name\">([^<]*)</span></a>");
-    if (infos.contains(MovieScraperInfos::Writer) && rx.indexIn(html) != -1)
-        movie->setWriter(rx.cap(1));
-
-    rx.setPattern("<div class=\"see-more inline canwrap\" itemprop=\"genre\">[^<]*<h4 class=\"inline\">Genres:</h4>(.*)</div>");
-    if (infos.contains(MovieScraperInfos::Genres) && rx.indexIn(html) != -1) {
-        QString genres = rx.cap(1);
-        rx.setPattern("<a href=\"[^\"]*\" >([^<]*)</a>");
-        int pos = 0;
-        while ((pos = rx.indexIn(genres, pos)) != -1) {
-            movie->addGenre(Helper::mapGenre(rx.cap(1).trimmed()));
-            pos += rx.matchedLength();
-        }
-    }
+    static const QRegularExpression thumbRx("http://ia.media-imdb.com/images/(.*)/(.*)._V(.*)_S(.*)([0-9]*)_CR[0-9]*,[0-9]*,[0-9]*,[0-9]*_.jpg",
+                                            QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
 
-    rx.setPattern("<h4 class=\"inline\">Taglines:</h4>(.*)<span");
-    if (infos.contains(MovieScraperInfos::Tagline) && rx.indexIn(html) != -1)
-        movie->setTagline(rx.cap(1).trimmed());
-
-    rx.setPattern("<div class=\"see-more inline canwrap\" itemprop=\"keywords\">(.*)</div>");
-    if (infos.contains(MovieScraperInfos::Tags) && rx.indexIn(html) != -1) {
-        QString keywords = rx.cap(1);
-        rx.setPattern("<span class=\"itemprop\" itemprop=\"keywords\">([^<]*)</span>");
-        int pos = 0;
-        while ((pos = rx.indexIn(keywords, pos)) != -1) {
-            movie->addTag(rx.cap(1).trimmed());
-            pos += rx.matchedLength();
-        }
-    }
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
-    rx.setPattern("<a href=\"[^\"]*\" title=\"See all release dates\" >[^<]*<meta itemprop=\"datePublished\" content=\"([^\"]*)\" />");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1), "yyyy-MM-dd"));
-
-    rx.setPattern("itemprop=\"contentRating\" content=\"([^\"]*)\"></span>");
-    if (infos.contains(MovieScraperInfos::Certification) && rx.indexIn(html) != -1)
-        movie->setCertification(Helper::mapCertification(rx.cap(1)));
-
-    rx.setPattern("<time itemprop=\"duration\" datetime=\"PT([0-9]+)M\" >");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1)
-        movie->setRuntime(rx.cap(1).toInt());
-
-    rx.setPattern("<p itemprop=\"description\">([^<]*)</p>");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1)
-        movie->setOutline(rx.cap(1).trimmed());
-
-    rx.setPattern("<div class=\"inline canwrap\" itemprop=\"description\">[^<]*<p>([^<]*)");
-    rx.setMinimal(false);
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1)
-        movie->setOverview(rx.cap(1).trimmed());
-    rx.setMinimal(true);
-
-    rx.setPattern("<div class=\"star-box-details\" itemtype=\"http://schema.org/AggregateRating\" itemscope itemprop=\"aggregateRating\">(.*)</div>");
-    if (infos.contains(MovieScraperInfos::Rating) && rx.indexIn(html) != -1) {
-        QString content = rx.cap(1);
-        rx.setPattern("<span itemprop=\"ratingValue\">(.*)</span>");
-        if (rx.indexIn(content) != -1)
-            movie->setRating(rx.cap(1).trimmed().replace(",", ".").toFloat());
-
-        rx.setPattern("<span itemprop=\"ratingCount\">(.*)</span>");
-        if (rx.indexIn(content) != -1)
-            movie->setVotes(rx.cap(1).replace(",", "").replace(".", "").toInt());
-    }
+    if (fields.contains("title"))
+        movie->setName(fields.value("title"));
 
-    rx.setPattern("<strong>Top 250 #([0-9]+)</strong>");
-    if (infos.contains(MovieScraperInfos::Rating) && rx.indexIn(html) != -1)
-        movie->setTop250(rx.cap(1).toInt());
-
-    rx.setPattern("<h3>Company Credits</h3>[^<]*<div class=\"txt-block\">(.*)</div>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1) {
-        QString content = rx.cap(1);
-        rx.setPattern("<span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>");
-        int pos = 0;
-        while ((pos = rx.indexIn(content, pos)) != -1) {
-            movie->addStudio(Helper::mapStudio(rx.cap(1).trimmed()));
-            pos += rx.matchedLength();
-        }
-    }
+    if (fields.contains("director"))
+        movie->setDirector(fields.value("director"));
 
-    rx.setPattern("<div class=\"txt-block\">[^<]*<h4 class=\"inline\">Country:</h4>(.*)</div>");
-    if (infos.contains(MovieScraperInfos::Countries) && rx.indexIn(html) != -1) {
-        QString content = rx.cap(1);
-        rx.setPattern("<a href=\"[^\"]*\" itemprop='url'>([^<]*)</a>");
-        int pos = 0;
-        while ((pos = rx.indexIn(content, pos)) != -1) {
-            movie->addCountry(Helper::mapCountry(rx.cap(1).trimmed()));
-            pos += rx.matchedLength();
-        }
-    }
+    if (fields.contains("writer"))
+        movie->setWriter(fields.value("writer"));
 
-    rx.setPattern("<table class=\"cast_list\">(.*)</table>");
-    if (infos.contains(MovieScraperInfos::Actors) && rx.indexIn(html) != -1) {
-        QString content = rx.cap(1);
-        rx.setPattern("<tr class=\"[^\"]*\">[^<]*<td class=\"primary_photo\">[^<]*<a href=\"[^\"]*\" ><img [^<]*loadlate=\"([^\"]*)\"[^<]* /></a>[^<]*</td>[^<]*"
-                      "<td class=\"itemprop\" itemprop=\"actor\" itemscope itemtype=\"http://schema.org/Person\">[^<]*<a href=\"[^\"]*\" itemprop='url'> <span class=\"itemprop\" itemprop=\"name\">([^<]*)</span>.*"
-                      "<a href=\"/character/[^\"]*\" >([^<]*)</a>");
-        int pos = 0;
-        while ((pos = rx.indexIn(content, pos)) != -1) {
-            Actor a;
-            QRegExp aRx("http://ia.media-imdb.com/images/(.*)/(.*)._V(.*)_S(.*)([0-9]*)_CR[0-9]*,[0-9]*,[0-9]*,[0-9]*_.jpg");
-            aRx.setMinimal(true);
-            if (aRx.indexIn(rx.cap(1)) != -1)
-                a.thumb = "http://ia.media-imdb.com/images/" + aRx.cap(1) + "/" + aRx.cap(2) + "._V" + aRx.cap(3) + "_SY317_CR0,0,214,317_.jpg";
-            else
-                a.thumb = rx.cap(1);
-            a.name = rx.cap(2);
-            a.role = rx.cap(3);
-            movie->addActor(a);
-            pos += rx.matchedLength();
-        }
+    foreach (const QString &genre, fields.values("genre"))
+        movie->addGenre(Helper::mapGenre(genre.trimmed()));
+
+    if (fields.contains("tagline"))
+        movie->setTagline(fields.value("tagline").trimmed());
+
+    foreach (const QString &keyword, fields.values("keyword"))
+        movie->addTag(keyword.trimmed());
+
+    if (fields.contains("released"))
+        movie->setReleased(QDate::fromString(fields.value("released"), "yyyy-MM-dd"));
+
+    if (fields.contains("certification"))
+        movie->setCertification(Helper::mapCertification(fields.value("certification")));
+
+    if (fields.contains("runtime"))
+        movie->setRuntime(fields.value("runtime").toInt());
+
+    if (fields.contains("outline"))
+        movie->setOutline(fields.value("outline").trimmed());
+
+    if (fields.contains("overview"))
+        movie->setOverview(fields.value("overview").trimmed());
+
+    if (fields.contains("rating"))
+        movie->setRating(fields.value("rating").trimmed().replace(",", ".").toFloat());
+
+    if (fields.contains("votes"))
+        movie->setVotes(fields.value("votes").replace(",", "").replace(".", "").toInt());
+
+    if (fields.contains("top250"))
+        movie->setTop250(fields.value("top250").toInt());
+
+    foreach (const QString &studio, fields.values("studio"))
+        movie->addStudio(Helper::mapStudio(studio.trimmed()));
+
+    foreach (const QString &country, fields.values("country"))
+        movie->addCountry(Helper::mapCountry(country.trimmed()));
+
+    foreach (const QStringList &actor, fields.matches("actor")) {
+        Actor a;
+        QRegularExpressionMatch match = thumbRx.match(actor.at(0));
+        if (match.hasMatch())
+            a.thumb = "http://ia.media-imdb.com/images/" + match.captured(1) + "/" + match.captured(2) + "._V" + match.captured(3) + "_SY317_CR0,0,214,317_.jpg";
+        else
+            a.thumb = actor.at(0);
+        a.name = actor.at(1);
+        a.role = actor.at(2);
+        movie->addActor(a);
     }
 }
 
 QString IMDB::parsePosters(QString html)
 {
-    QRegExp rx("<div class=\"image\">(.*)</div>");
-    rx.setMinimal(true);
-    if (rx.indexIn(html) == -1)
-        return QString();
-
-    QString content = rx.cap(1);
-    rx.setPattern("<a href=\"([^\"]*)\" >");
-    if (rx.indexIn(content) == -1)
+    HtmlExtractor::Result fields = m_posterPageExtractor.extract(html);
+    if (!fields.contains("link"))
         return QString();
 
-    return QString("http://www.imdb.com%1").arg(rx.cap(1));
+    return QString("http://www.imdb.com%1").arg(fields.value("link"));
 }
 
 void IMDB::parseAndAssignPoster(QString html, Movie *movie, QList<int> infos)
 {
-    QRegExp rx("<img onmousedown=\"return false;\" onmousemove=\"return false;\" oncontextmenu=\"return false;\" id=\"primary-img\" title=\"[^\"]*\" alt=\"[^\"]*\" src=\"([^\"]*)\" />");
-    rx.setMinimal(true);
-    if (infos.contains(MovieScraperInfos::Poster) && rx.indexIn(html) != -1) {
+    HtmlExtractor::Result fields = m_posterExtractor.extract(html, infos);
+    if (fields.contains("poster")) {
         Poster p;
-        p.originalUrl = rx.cap(1);
-        p.thumbUrl = rx.cap(1);
+        p.originalUrl = fields.value("poster");
+        p.thumbUrl = fields.value("poster");
         movie->addPoster(p);
     }
 }
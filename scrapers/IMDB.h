@@ -4,6 +4,7 @@
 #include "QNetworkAccessManager"
 #include "QNetworkReply"
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 class IMDB : public ScraperInterface
 {
@@ -32,14 +33,22 @@ private slots:
     void onPosterLoadFinished();
 
 private:
+    friend class BenchmarkSuite;
+
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString html, Movie *movie, QList<int> infos);
     void parseAndAssignPoster(QString html, Movie *movie, QList<int> infos);
     QString parsePosters(QString html);
+    void setupExtractors();
 
     QNetworkAccessManager m_qnam;
     QList<int> m_scraperSupports;
+    HtmlExtractor m_searchIdExtractor;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
+    HtmlExtractor m_posterPageExtractor;
+    HtmlExtractor m_posterExtractor;
 };
 
 #endif // IMDB_H
@@ -2,15 +2,13 @@
 
 #include <QDebug>
 #include <QLabel>
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include <QSettings>
 #include <QGridLayout>
 
 #include "data/Storage.h"
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "globals/JsonValue.h"
 #include "main/MainWindow.h"
 #include "settings/Settings.h"
 
@@ -234,9 +232,7 @@ void TMDb::setupFinished()
     }
     QString msg = QString::fromUtf8(reply->readAll());
     reply->deleteLater();
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(msg) + ")");
+    JsonValue sc = JsonValue::parse(msg);
 
     m_baseUrl = sc.property("images").property("base_url").toString();
 }
@@ -355,27 +351,23 @@ QList<ScraperSearchResult> TMDb::parseSearch(QString json, int *nextPage)
 {
     qDebug() << "Entered";
     QList<ScraperSearchResult> results;
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
+    JsonValue sc = JsonValue::parse(json);
 
     // only get the first 3 pages
     if (sc.property("page").toInteger() < sc.property("total_pages").toInteger() && sc.property("page").toInteger() < 3)
         *nextPage = sc.property("page").toInteger()+1;
 
     if (sc.property("results").isArray() ) {
-        QScriptValueIterator it(sc.property("results"));
-        while (it.hasNext() ) {
-            it.next();
-            if (it.value().property("id").toString().isEmpty()) {
+        foreach (const JsonValue &vR, sc.property("results").elements()) {
+            if (vR.property("id").toString().isEmpty()) {
                 continue;
             }
             ScraperSearchResult result;
-            result.name     = it.value().property("title").toString();
+            result.name     = vR.property("title").toString();
             if (result.name.isEmpty())
-                it.value().property("original_title").toString();
-            result.id       = it.value().property("id").toString();
-            result.released = QDate::fromString(it.value().property("release_date").toString(), "yyyy-MM-dd");
+                vR.property("original_title").toString();
+            result.id       = vR.property("id").toString();
+            result.released = QDate::fromString(vR.property("release_date").toString(), "yyyy-MM-dd");
             results.append(result);
         }
     } else if (!sc.property("id").toString().isEmpty()) {
@@ -591,16 +583,14 @@ void TMDb::loadReleasesFinished()
 void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
 {
     qDebug() << "Entered";
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
+    JsonValue sc = JsonValue::parse(json);
 
     // Infos
     if (sc.property("imdb_id").isValid() && !sc.property("imdb_id").toString().isEmpty())
         movie->setId(sc.property("imdb_id").toString());
     if (infos.contains(MovieScraperInfos::Title) && sc.property("title").isValid())
         movie->setName(sc.property("title").toString());
-    if (infos.contains(MovieScraperInfos::Set) && !sc.property("belongs_to_collection").toString().isEmpty())
+    if (infos.contains(MovieScraperInfos::Set) && sc.property("belongs_to_collection").isObject())
         movie->setSet(sc.property("belongs_to_collection").property("name").toString());
     if (infos.contains(MovieScraperInfos::Title) && sc.property("original_title").isValid())
         movie->setOriginalName(sc.property("original_title").toString());
@@ -620,30 +610,21 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
     if (infos.contains(MovieScraperInfos::Runtime) && sc.property("runtime").isValid())
         movie->setRuntime(sc.property("runtime").toInteger());
     if (infos.contains(MovieScraperInfos::Genres) && sc.property("genres").isArray()) {
-        QScriptValueIterator itC(sc.property("genres"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("genres").elements()) {
             if (vC.property("id").toString().isEmpty())
                 continue;
             movie->addGenre(Helper::mapGenre(vC.property("name").toString()));
         }
     }
     if (infos.contains(MovieScraperInfos::Studios) && sc.property("production_companies").isArray()) {
-        QScriptValueIterator itS(sc.property("production_companies"));
-        while (itS.hasNext()) {
-            itS.next();
-            QScriptValue vS = itS.value();
+        foreach (const JsonValue &vS, sc.property("production_companies").elements()) {
             if (vS.property("id").toString().isEmpty())
                 continue;
             movie->addStudio(Helper::mapStudio(vS.property("name").toString()));
         }
     }
     if (infos.contains(MovieScraperInfos::Countries) && sc.property("production_countries").isArray()) {
-        QScriptValueIterator itC(sc.property("production_countries"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("production_countries").elements()) {
             if (vC.property("name").toString().isEmpty())
                 continue;
             movie->addCountry(Helper::mapCountry(vC.property("name").toString()));
@@ -652,10 +633,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
 
     // Casts
     if (infos.contains(MovieScraperInfos::Actors) && sc.property("cast").isArray()) {
-        QScriptValueIterator itC(sc.property("cast"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("cast").elements()) {
             if (vC.property("name").toString().isEmpty())
                 continue;
             Actor a;
@@ -669,10 +647,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
 
     // Crew
     if ((infos.contains(MovieScraperInfos::Director) || infos.contains(MovieScraperInfos::Writer)) && sc.property("crew").isArray()) {
-        QScriptValueIterator itC(sc.property("crew"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("crew").elements()) {
             if (vC.property("name").toString().isEmpty())
                 continue;
             if (infos.contains(MovieScraperInfos::Writer) && vC.property("department").toString() == "Writing") {
@@ -691,10 +666,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
 
     // Trailers
     if (infos.contains(MovieScraperInfos::Trailer) && sc.property("youtube").isArray()) {
-        QScriptValueIterator itC(sc.property("youtube"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("youtube").elements()) {
             if (vC.property("source").toString().isEmpty())
                 continue;
             movie->setTrailer(QUrl(Helper::formatTrailerUrl(QString("http://www.youtube.com/watch?v=%1").arg(vC.property("source").toString()))));
@@ -704,10 +676,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
 
     // Images
     if (infos.contains(MovieScraperInfos::Backdrop) && sc.property("backdrops").isArray()) {
-        QScriptValueIterator itB(sc.property("backdrops"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("backdrops").elements()) {
             if (vB.property("file_path").toString().isEmpty())
                 continue;
             Poster b;
@@ -720,10 +689,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
     }
 
     if (infos.contains(MovieScraperInfos::Poster) && sc.property("posters").isArray()) {
-        QScriptValueIterator itB(sc.property("posters"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("posters").elements()) {
             if (vB.property("file_path").toString().isEmpty())
                 continue;
             Poster b;
@@ -742,10 +708,7 @@ void TMDb::parseAndAssignInfos(QString json, Movie *movie, QList<int> infos)
         QString locale;
         QString us;
         QString gb;
-        QScriptValueIterator itB(sc.property("countries"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("countries").elements()) {
             if (vB.property("iso_3166_1").toString() == "US")
                 us = vB.property("certification").toString();
             if (vB.property("iso_3166_1").toString() == "GB")
@@ -45,6 +45,8 @@ private slots:
     void setupFinished();
 
 private:
+    friend class BenchmarkSuite;
+
     QNetworkAccessManager m_qnam;
     QString m_language;
     QString m_language2;
@@ -2,15 +2,13 @@
 
 #include <QDebug>
 #include <QLabel>
-#include <QtScript/QScriptValue>
-#include <QtScript/QScriptValueIterator>
-#include <QtScript/QScriptEngine>
 #include <QSettings>
 #include <QGridLayout>
 
 #include "data/Storage.h"
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "globals/JsonValue.h"
 #include "main/MainWindow.h"
 
 /**
@@ -185,9 +183,7 @@ void TMDbConcerts::setupFinished()
     }
     QString msg = QString::fromUtf8(reply->readAll());
     reply->deleteLater();
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(msg) + ")");
+    JsonValue sc = JsonValue::parse(msg);
 
     m_baseUrl = sc.property("images").property("base_url").toString();
 }
@@ -264,27 +260,23 @@ QList<ScraperSearchResult> TMDbConcerts::parseSearch(QString json, int *nextPage
 {
     qDebug() << "Entered";
     QList<ScraperSearchResult> results;
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
+    JsonValue sc = JsonValue::parse(json);
 
     // only get the first 3 pages
     if (sc.property("page").toInteger() < sc.property("total_pages").toInteger() && sc.property("page").toInteger() < 3)
         *nextPage = sc.property("page").toInteger()+1;
 
     if (sc.property("results").isArray() ) {
-        QScriptValueIterator it(sc.property("results"));
-        while (it.hasNext() ) {
-            it.next();
-            if (it.value().property("id").toString().isEmpty()) {
+        foreach (const JsonValue &vR, sc.property("results").elements()) {
+            if (vR.property("id").toString().isEmpty()) {
                 continue;
             }
             ScraperSearchResult result;
-            result.name     = it.value().property("title").toString();
+            result.name     = vR.property("title").toString();
             if (result.name.isEmpty())
-                it.value().property("original_title").toString();
-            result.id       = it.value().property("id").toString();
-            result.released = QDate::fromString(it.value().property("release_date").toString(), "yyyy-MM-dd");
+                vR.property("original_title").toString();
+            result.id       = vR.property("id").toString();
+            result.released = QDate::fromString(vR.property("release_date").toString(), "yyyy-MM-dd");
             results.append(result);
         }
     } else if (!sc.property("id").toString().isEmpty()) {
@@ -465,9 +457,7 @@ void TMDbConcerts::loadReleasesFinished()
 void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int> infos)
 {
     qDebug() << "Entered";
-    QScriptValue sc;
-    QScriptEngine engine;
-    sc = engine.evaluate("(" + QString(json) + ")");
+    JsonValue sc = JsonValue::parse(json);
 
     // Infos
     if (sc.property("imdb_id").isValid() && !sc.property("imdb_id").toString().isEmpty())
@@ -485,10 +475,7 @@ void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int
     if (infos.contains(ConcertScraperInfos::Runtime) && sc.property("runtime").isValid())
         concert->setRuntime(sc.property("runtime").toInteger());
     if (infos.contains(ConcertScraperInfos::Genres) && sc.property("genres").isArray()) {
-        QScriptValueIterator itC(sc.property("genres"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("genres").elements()) {
             if (vC.property("id").toString().isEmpty())
                 continue;
             concert->addGenre(Helper::mapGenre(vC.property("name").toString()));
@@ -497,10 +484,7 @@ void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int
 
     // Trailers
     if (infos.contains(ConcertScraperInfos::Trailer) && sc.property("youtube").isArray()) {
-        QScriptValueIterator itC(sc.property("youtube"));
-        while (itC.hasNext()) {
-            itC.next();
-            QScriptValue vC = itC.value();
+        foreach (const JsonValue &vC, sc.property("youtube").elements()) {
             if (vC.property("source").toString().isEmpty())
                 continue;
             concert->setTrailer(QUrl(Helper::formatTrailerUrl(QString("http://www.youtube.com/watch?v=%1").arg(vC.property("source").toString()))));
@@ -510,10 +494,7 @@ void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int
 
     // Images
     if (infos.contains(ConcertScraperInfos::Backdrop) && sc.property("backdrops").isArray()) {
-        QScriptValueIterator itB(sc.property("backdrops"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("backdrops").elements()) {
             if (vB.property("file_path").toString().isEmpty())
                 continue;
             Poster b;
@@ -526,10 +507,7 @@ void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int
     }
 
     if (infos.contains(ConcertScraperInfos::Poster) && sc.property("posters").isArray()) {
-        QScriptValueIterator itB(sc.property("posters"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("posters").elements()) {
             if (vB.property("file_path").toString().isEmpty())
                 continue;
             Poster b;
@@ -546,10 +524,7 @@ void TMDbConcerts::parseAndAssignInfos(QString json, Concert *concert, QList<int
         QString locale;
         QString us;
         QString gb;
-        QScriptValueIterator itB(sc.property("countries"));
-        while (itB.hasNext()) {
-            itB.next();
-            QScriptValue vB = itB.value();
+        foreach (const JsonValue &vB, sc.property("countries").elements()) {
             if (vB.property("iso_3166_1").toString() == "US")
                 us = vB.property("certification").toString();
             if (vB.property("iso_3166_1").toString() == "GB")
@@ -1,11 +1,15 @@
 #include "TheTvDb.h"
 
 #include <QComboBox>
+#include <QDir>
 #include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
 #include <QGridLayout>
 #include <QLabel>
 #include <QSettings>
 #include <QSpacerItem>
+#include <QTimer>
 
 #include "data/Storage.h"
 #include "globals/Globals.h"
@@ -15,6 +19,11 @@
 #include "mediaCenterPlugins/XbmcXml.h"
 #include "settings/Settings.h"
 
+// seconds until the data of a series is downloaded again
+static const int seriesCacheTtl = 3600;
+// number of parsed series kept in memory, older ones are loaded again from the cache directory
+static const int seriesCacheSize = 3;
+
 /**
  * @brief TheTvDb::TheTvDb
  * @param parent
@@ -287,7 +296,7 @@ void TheTvDb::onLoadFinished()
 
     if (reply->error() == QNetworkReply::NoError ) {
         QString msg = QString::fromUtf8(reply->readAll());
-        parseAndAssignInfos(msg, show, updateType, infos);
+        parseAndAssignInfos(cacheSeries(seriesKey(show->tvdbId()), msg), show, updateType, infos);
     } else {
         qWarning() << "Network Error" << reply->errorString();
     }
@@ -358,20 +367,17 @@ void TheTvDb::onBannersFinished()
 }
 
 /**
- * @brief Parses info XML data and assigns it to the given tv show object
- * @param xml XML data
+ * @brief Assigns the infos of a series to the given tv show object
+ * @param series Parsed series data
  * @param show Tv Show object
- * @param updateAllEpisodes Update all child episodes (regardless if they already have infos or not)
+ * @param updateType Update the show and/or all or only new child episodes
  */
-void TheTvDb::parseAndAssignInfos(QString xml, TvShow *show, TvShowUpdateType updateType, QList<int> infosToLoad)
+void TheTvDb::parseAndAssignInfos(const Series &series, TvShow *show, TvShowUpdateType updateType, QList<int> infosToLoad)
 {
-    QDomDocument domDoc;
-    domDoc.setContent(xml);
-
     if (updateType == UpdateShow || updateType == UpdateShowAndAllEpisodes || updateType == UpdateShowAndNewEpisodes) {
         show->clear(infosToLoad);
-        if (!domDoc.elementsByTagName("Series").isEmpty()) {
-            QDomElement elem = domDoc.elementsByTagName("Series").at(0).toElement();
+        QDomElement elem = series.document.documentElement().firstChildElement("Series");
+        if (!elem.isNull()) {
             if (infosToLoad.contains(TvShowScraperInfos::Certification) && !elem.elementsByTagName("ContentRating").isEmpty())
                 show->setCertification(Helper::mapCertification(elem.elementsByTagName("ContentRating").at(0).toElement().text()));
             if (infosToLoad.contains(TvShowScraperInfos::FirstAired) && !elem.elementsByTagName("FirstAired").isEmpty())
@@ -392,72 +398,76 @@ void TheTvDb::parseAndAssignInfos(QString xml, TvShow *show, TvShowUpdateType up
     }
 
     if (updateType == UpdateAllEpisodes || updateType == UpdateNewEpisodes || updateType == UpdateShowAndAllEpisodes || updateType == UpdateShowAndNewEpisodes) {
-        for (int i=0, n=domDoc.elementsByTagName("Episode").count() ; i<n ; ++i) {
-            QDomElement elem = domDoc.elementsByTagName("Episode").at(i).toElement();
-
-            TvShowEpisode *episode = 0;
-            if (Settings::instance()->tvShowDvdOrder() &&
-                    !elem.elementsByTagName("DVD_season").isEmpty() &&
-                    !elem.elementsByTagName("DVD_season").at(0).toElement().text().isEmpty() &&
-                    !elem.elementsByTagName("DVD_episodenumber").isEmpty() &&
-                    !elem.elementsByTagName("DVD_episodenumber").at(0).toElement().text().isEmpty()) {
-                QRegExp rx("^(\\d*)\\D*");
-                int seasonNumber = -1;
-                int episodeNumber = -1;
-                QString seasonText = elem.elementsByTagName("DVD_season").at(0).toElement().text();
-                QString episodeText = elem.elementsByTagName("DVD_episodenumber").at(0).toElement().text();
-                if (rx.indexIn(QString("%1").arg(seasonText), 0) != -1)
-                    seasonNumber = rx.cap(1).toInt();
-                if (rx.indexIn(QString("%1").arg(episodeText), 0) != -1)
-                    episodeNumber = rx.cap(1).toInt();
-                episode = show->episode(seasonNumber, episodeNumber);
-            } else if (!elem.elementsByTagName("SeasonNumber").isEmpty() && !elem.elementsByTagName("EpisodeNumber").isEmpty()) {
-                int seasonNumber = elem.elementsByTagName("SeasonNumber").at(0).toElement().text().toInt();
-                int episodeNumber = elem.elementsByTagName("EpisodeNumber").at(0).toElement().text().toInt();
-                episode = show->episode(seasonNumber, episodeNumber);
-            }
+        // walk the show's episodes and look up their data, the series may contain far more episodes than the show
+        bool dvdOrder = Settings::instance()->tvShowDvdOrder();
+        foreach (TvShowEpisode *episode, show->episodes()) {
+            if (!episode->isValid())
+                continue;
+            if (!(updateType == UpdateAllEpisodes || updateType == UpdateShowAndAllEpisodes || !episode->infoLoaded()))
+                continue;
 
-            if (!episode || !episode->isValid())
+            QPair<int, int> number(episode->season(), episode->episode());
+            if (show->episode(number.first, number.second) != episode)
                 continue;
 
-            if (updateType == UpdateAllEpisodes || updateType == UpdateShowAndAllEpisodes ||
-                    ((updateType == UpdateNewEpisodes || updateType == UpdateShowAndNewEpisodes) && !episode->infoLoaded())) {
-                episode->clear(infosToLoad);
-                parseAndAssignSingleEpisodeInfos(elem, episode, infosToLoad);
+            // in DVD order, episodes without DVD numbers are matched by their aired numbers
+            QDomElement elem;
+            if (dvdOrder)
+                elem = series.dvdEpisodes.value(number);
+            if (elem.isNull()) {
+                elem = series.airedEpisodes.value(number);
+                if (dvdOrder && !elem.firstChildElement("DVD_season").text().isEmpty() && !elem.firstChildElement("DVD_episodenumber").text().isEmpty())
+                    continue;
             }
+            if (elem.isNull())
+                continue;
+
+            episode->clear(infosToLoad);
+            parseAndAssignSingleEpisodeInfos(elem, episode, infosToLoad);
         }
     }
 
-    fillDatabaseWithAllEpisodes(xml, show);
+    fillDatabaseWithAllEpisodes(series, show);
 }
 
+/**
+ * @brief Replaces the episode list of a show in the database, which is used to show missing episodes
+ * @param xml Content of all.xml
+ * @param show Tv Show object
+ */
 void TheTvDb::fillDatabaseWithAllEpisodes(QString xml, TvShow *show)
+{
+    QString id = show->tvdbId().isEmpty() ? show->id() : show->tvdbId();
+    fillDatabaseWithAllEpisodes(cacheSeries(seriesKey(id), xml), show);
+}
+
+void TheTvDb::fillDatabaseWithAllEpisodes(const Series &series, TvShow *show)
 {
     QList<int> infosToLoad;
     infosToLoad << TvShowScraperInfos::Director << TvShowScraperInfos::Title << TvShowScraperInfos::FirstAired
                 << TvShowScraperInfos::Overview << TvShowScraperInfos::Rating << TvShowScraperInfos::Writer
                 << TvShowScraperInfos::Thumbnail;
 
-    int showsSettingsId = Manager::instance()->database()->showsSettingsId(show);
-    Manager::instance()->database()->clearEpisodeList(showsSettingsId);
-
-    TvShowEpisode *episode = new TvShowEpisode();
-    QDomDocument domDoc;
-    domDoc.setContent(xml);
-    for (int i=0, n=domDoc.elementsByTagName("Episode").count() ; i<n ; ++i) {
-        QDomElement elem = domDoc.elementsByTagName("Episode").at(i).toElement();
-        if (!elem.elementsByTagName("SeasonNumber").isEmpty() && !elem.elementsByTagName("EpisodeNumber").isEmpty()) {
-            episode->clear();
-            int seasonNumber = elem.elementsByTagName("SeasonNumber").at(0).toElement().text().toInt();
-            int episodeNumber = elem.elementsByTagName("EpisodeNumber").at(0).toElement().text().toInt();
-            QString id = elem.elementsByTagName("id").at(0).toElement().text();
-            episode->setSeason(seasonNumber);
-            episode->setEpisode(episodeNumber);
-            parseAndAssignSingleEpisodeInfos(elem, episode, infosToLoad);
-            Manager::instance()->database()->addEpisodeToShowList(episode, showsSettingsId, id);
-        }
+    Database *database = Manager::instance()->database();
+    int showsSettingsId = database->showsSettingsId(show);
+    // a savepoint doesn't commit a transaction which the caller may have opened
+    database->savepoint("episodeList");
+    database->clearEpisodeList(showsSettingsId);
+
+    TvShowEpisode episode;
+    for (QDomElement elem = series.document.documentElement().firstChildElement("Episode") ; !elem.isNull() ; elem = elem.nextSiblingElement("Episode")) {
+        QDomElement seasonElem = elem.firstChildElement("SeasonNumber");
+        QDomElement episodeElem = elem.firstChildElement("EpisodeNumber");
+        if (seasonElem.isNull() || episodeElem.isNull())
+            continue;
+        episode.clear();
+        episode.setSeason(seasonElem.text().toInt());
+        episode.setEpisode(episodeElem.text().toInt());
+        parseAndAssignSingleEpisodeInfos(elem, &episode, infosToLoad);
+        database->addEpisodeToShowList(&episode, showsSettingsId, elem.firstChildElement("id").text());
     }
-    Manager::instance()->database()->cleanUpEpisodeList(showsSettingsId);
+    database->cleanUpEpisodeList(showsSettingsId);
+    database->releaseSavepoint("episodeList");
 }
 
 /**
@@ -611,81 +621,217 @@ void TheTvDb::parseAndAssignSingleEpisodeInfos(QDomElement elem, TvShowEpisode *
 }
 
 /**
- * @brief Starts network requests to download infos from TheTvDb
+ * @brief Loads the infos of an episode
+ *        The series data is downloaded only once and then served from the series cache
  * @param id TheTvDb show ID
  * @param episode Episode object
+ * @see TheTvDb::processEpisodeRequests
  * @see TheTvDb::onEpisodeLoadFinished
  */
 void TheTvDb::loadTvShowEpisodeData(QString id, TvShowEpisode *episode, QList<int> infosToLoad)
 {
     qDebug() << "Entered, id=" << id << "episode=" << episode->name();
     episode->clear(infosToLoad);
+
+    EpisodeRequest request;
+    request.seriesKey = seriesKey(id);
+    request.episode = episode;
+    request.infosToLoad = infosToLoad;
+    m_episodeRequests.append(request);
+
+    if (m_seriesDownloads.contains(request.seriesKey))
+        return;
+
+    if (loadCachedSeries(request.seriesKey)) {
+        // the episode signals are connected after this call returns
+        QTimer::singleShot(0, this, SLOT(processEpisodeRequests()));
+        return;
+    }
+
+    m_seriesDownloads.insert(request.seriesKey);
     QString mirror = m_xmlMirrors.at(qrand()%m_xmlMirrors.count());
     QUrl url(QString("%1/api/%2/series/%3/all/%4.xml").arg(mirror).arg(m_apiKey).arg(id).arg(m_language));
     QNetworkReply *reply = qnam()->get(QNetworkRequest(url));
-    reply->setProperty("storage", Storage::toVariant(reply, episode));
-    reply->setProperty("infosToLoad", Storage::toVariant(reply, infosToLoad));
+    reply->setProperty("seriesKey", request.seriesKey);
     connect(reply, SIGNAL(finished()), this, SLOT(onEpisodeLoadFinished()));
 }
 
 /**
- * @brief Called when the episode infos are downloaded
- * @see TheTvDb::parseAndAssignSingleEpisodeInfos
+ * @brief Called when the series data for episode requests is downloaded
+ * @see TheTvDb::processEpisodeRequests
  */
 void TheTvDb::onEpisodeLoadFinished()
 {
     QNetworkReply *reply = static_cast<QNetworkReply*>(QObject::sender());
-    QList<int> infos = reply->property("infosToLoad").value<Storage*>()->infosToLoad();
     reply->deleteLater();
-    TvShowEpisode *episode = reply->property("storage").value<Storage*>()->episode();
-    if (!episode)
-        return;
+    QString key = reply->property("seriesKey").toString();
+    m_seriesDownloads.remove(key);
 
-    if (reply->error() == QNetworkReply::NoError ) {
-        QString msg = QString::fromUtf8(reply->readAll());
-        QDomDocument domDoc;
-        domDoc.setContent(msg);
-        QDomElement dvdElem;
-        QDomElement airedElem;
-        for (int i=0, n=domDoc.elementsByTagName("Episode").count() ; i<n ; ++i) {
-            QDomElement elem = domDoc.elementsByTagName("Episode").at(i).toElement();
-            if (!elem.elementsByTagName("SeasonNumber").isEmpty() && !elem.elementsByTagName("EpisodeNumber").isEmpty()) {
-                int seasonNumber = elem.elementsByTagName("SeasonNumber").at(0).toElement().text().toInt();
-                int episodeNumber = elem.elementsByTagName("EpisodeNumber").at(0).toElement().text().toInt();
-                if (episode->season() == seasonNumber && episode->episode() == episodeNumber)
-                    airedElem = elem;
-            }
-            if (!elem.elementsByTagName("DVD_season").isEmpty() &&
-                    !elem.elementsByTagName("DVD_season").at(0).toElement().text().isEmpty() &&
-                    !elem.elementsByTagName("DVD_episodenumber").isEmpty() &&
-                    !elem.elementsByTagName("DVD_episodenumber").at(0).toElement().text().isEmpty()) {
-                QRegExp rx("^(\\d*)\\D*");
-                int seasonNumber = -1;
-                int episodeNumber = -1;
-                QString seasonText = elem.elementsByTagName("DVD_season").at(0).toElement().text();
-                QString episodeText = elem.elementsByTagName("DVD_episodenumber").at(0).toElement().text();
-                if (rx.indexIn(QString("%1").arg(seasonText), 0) != -1)
-                    seasonNumber = rx.cap(1).toInt();
-                if (rx.indexIn(QString("%1").arg(episodeText), 0) != -1)
-                    episodeNumber = rx.cap(1).toInt();
-                if (episode->season() == seasonNumber && episode->episode() == episodeNumber)
-                    dvdElem = elem;
+    if (reply->error() == QNetworkReply::NoError )
+        cacheSeries(key, QString::fromUtf8(reply->readAll()));
+    else
+        qWarning() << "Network Error" << reply->errorString();
+
+    processEpisodeRequests();
+}
+
+/**
+ * @brief Assigns the infos of all episodes whose series data is available
+ *        Requests of series which could not be loaded are finished without infos
+ * @see TheTvDb::parseAndAssignSingleEpisodeInfos
+ */
+void TheTvDb::processEpisodeRequests()
+{
+    qDebug() << "DVD ORDER" << Settings::instance()->tvShowDvdOrder();
+
+    QList<EpisodeRequest> requests = m_episodeRequests;
+    m_episodeRequests.clear();
+    foreach (const EpisodeRequest &request, requests) {
+        if (m_seriesDownloads.contains(request.seriesKey)) {
+            m_episodeRequests.append(request);
+            continue;
+        }
+
+        TvShowEpisode *episode = request.episode;
+        if (!episode)
+            continue;
+
+        // the series may have been evicted from memory in the meantime
+        if (m_series.contains(request.seriesKey) || loadCachedSeries(request.seriesKey)) {
+            const Series &series = m_series[request.seriesKey];
+            QPair<int, int> number(episode->season(), episode->episode());
+            QDomElement elem;
+            if (Settings::instance()->tvShowDvdOrder())
+                elem = series.dvdEpisodes.value(number);
+            if (elem.isNull())
+                elem = series.airedEpisodes.value(number);
+            if (!elem.isNull()) {
+                episode->clear(request.infosToLoad);
+                parseAndAssignSingleEpisodeInfos(elem, episode, request.infosToLoad);
             }
-            if (!dvdElem.isNull() && !airedElem.isNull())
-                break;
         }
+        episode->scraperLoadDone();
+    }
+}
+
+/**
+ * @brief Key of a series in the series cache, the data depends on the language
+ * @param id TheTvDb show ID
+ * @return Cache key
+ */
+QString TheTvDb::seriesKey(QString id)
+{
+    return QString("%1_%2").arg(id).arg(m_language);
+}
+
+/**
+ * @brief Returns the file which stores the data of a series on disk
+ * @param key Series key
+ * @return File name or an empty string if the cache directory could not be created
+ */
+QString TheTvDb::seriesCacheFile(QString key)
+{
+    QString location = Settings::instance()->imageCacheDir() + "/tvdb";
+    QDir dir(location);
+    if (!dir.exists() && !dir.mkpath(location))
+        return QString();
+    return QString("%1/%2.xml").arg(location).arg(key);
+}
+
+/**
+ * @brief Makes sure the series is in memory if it was loaded less than an hour ago
+ * @param key Series key
+ * @return True if the series cache contains the series
+ */
+bool TheTvDb::loadCachedSeries(QString key)
+{
+    if (m_series.contains(key)) {
+        if (m_series[key].loaded.secsTo(QDateTime::currentDateTime()) < seriesCacheTtl) {
+            m_seriesUsage.removeOne(key);
+            m_seriesUsage.append(key);
+            return true;
+        }
+        m_series.remove(key);
+        m_seriesUsage.removeOne(key);
+    }
+
+    QFileInfo fi(seriesCacheFile(key));
+    if (!fi.isFile() || fi.lastModified().secsTo(QDateTime::currentDateTime()) >= seriesCacheTtl)
+        return false;
 
-        qDebug() << "DVD ORDER" << Settings::instance()->tvShowDvdOrder();
+    QFile file(fi.absoluteFilePath());
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    QString xml = QString::fromUtf8(file.readAll());
+    file.close();
 
-        if (Settings::instance()->tvShowDvdOrder() && !dvdElem.isNull()) {
-            episode->clear(infos);
-            parseAndAssignSingleEpisodeInfos(dvdElem, episode, infos);
-        } else if (!airedElem.isNull()) {
-            episode->clear(infos);
-            parseAndAssignSingleEpisodeInfos(airedElem, episode, infos);
+    cacheSeries(key, xml, false);
+    m_series[key].loaded = fi.lastModified();
+    return true;
+}
+
+/**
+ * @brief Parses the data of a series once and indexes its episodes by aired and DVD order
+ *        Only the last seriesCacheSize series are kept in memory.
+ * @param key Series key
+ * @param xml Content of all.xml
+ * @param writeToDisk Also store the data in the cache directory
+ * @return Cached series
+ */
+const TheTvDb::Series &TheTvDb::cacheSeries(QString key, QString xml, bool writeToDisk)
+{
+    // drop expired series, they would be downloaded again anyway
+    QDateTime now = QDateTime::currentDateTime();
+    QMutableMapIterator<QString, Series> it(m_series);
+    while (it.hasNext()) {
+        if (it.next().value().loaded.secsTo(now) >= seriesCacheTtl) {
+            m_seriesUsage.removeOne(it.key());
+            it.remove();
         }
-    } else {
-        qWarning() << "Network Error" << reply->errorString();
     }
-    episode->scraperLoadDone();
+
+    // drop the least recently used series, parsed documents of large series take several megabytes
+    m_series.remove(key);
+    m_seriesUsage.removeOne(key);
+    while (m_seriesUsage.count() >= seriesCacheSize)
+        m_series.remove(m_seriesUsage.takeFirst());
+
+    Series series;
+    series.loaded = now;
+    series.document.setContent(xml);
+
+    QRegExp rx("^(\\d*)\\D*");
+    for (QDomElement elem = series.document.documentElement().firstChildElement("Episode") ; !elem.isNull() ; elem = elem.nextSiblingElement("Episode")) {
+        QDomElement seasonElem = elem.firstChildElement("SeasonNumber");
+        QDomElement episodeElem = elem.firstChildElement("EpisodeNumber");
+        if (!seasonElem.isNull() && !episodeElem.isNull()) {
+            QPair<int, int> number(seasonElem.text().toInt(), episodeElem.text().toInt());
+            if (!series.airedEpisodes.contains(number))
+                series.airedEpisodes.insert(number, elem);
+        }
+
+        QString seasonText = elem.firstChildElement("DVD_season").text();
+        QString episodeText = elem.firstChildElement("DVD_episodenumber").text();
+        if (!seasonText.isEmpty() && !episodeText.isEmpty()) {
+            QPair<int, int> number(-1, -1);
+            if (rx.indexIn(seasonText, 0) != -1)
+                number.first = rx.cap(1).toInt();
+            if (rx.indexIn(episodeText, 0) != -1)
+                number.second = rx.cap(1).toInt();
+            if (!series.dvdEpisodes.contains(number))
+                series.dvdEpisodes.insert(number, elem);
+        }
+    }
+
+    if (writeToDisk) {
+        QFile file(seriesCacheFile(key));
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            file.write(xml.toUtf8());
+            file.close();
+        }
+    }
+
+    m_series.insert(key, series);
+    m_seriesUsage.append(key);
+    return m_series[key];
 }
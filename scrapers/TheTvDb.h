@@ -2,10 +2,16 @@
 #define THETVDB_H
 
 #include <QComboBox>
+#include <QDateTime>
+#include <QDomDocument>
 #include <QDomElement>
+#include <QHash>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QObject>
+#include <QPair>
+#include <QPointer>
+#include <QSet>
 
 #include "data/TvScraperInterface.h"
 
@@ -39,24 +45,49 @@ private slots:
     void onSearchFinished();
     void onLoadFinished();
     void onEpisodeLoadFinished();
+    void processEpisodeRequests();
     void onActorsFinished();
     void onBannersFinished();
 
 private:
+    /**
+     * @brief A parsed all.xml of a series with its episodes indexed by (season, episode)
+     */
+    struct Series {
+        QDomDocument document;
+        QHash<QPair<int, int>, QDomElement> airedEpisodes;
+        QHash<QPair<int, int>, QDomElement> dvdEpisodes;
+        QDateTime loaded;
+    };
+    struct EpisodeRequest {
+        QString seriesKey;
+        QPointer<TvShowEpisode> episode;
+        QList<int> infosToLoad;
+    };
+
     QString m_apiKey;
     QString m_language;
     QNetworkAccessManager m_qnam;
     QStringList m_xmlMirrors;
     QStringList m_bannerMirrors;
     QStringList m_zipMirrors;
+    QMap<QString, Series> m_series;
+    QStringList m_seriesUsage;
+    QSet<QString> m_seriesDownloads;
+    QList<EpisodeRequest> m_episodeRequests;
 
     QNetworkAccessManager *qnam();
     void setMirrors();
     QList<ScraperSearchResult> parseSearch(QString xml);
-    void parseAndAssignInfos(QString xml, TvShow *show, TvShowUpdateType updateType, QList<int> infosToLoad);
+    void parseAndAssignInfos(const Series &series, TvShow *show, TvShowUpdateType updateType, QList<int> infosToLoad);
+    void fillDatabaseWithAllEpisodes(const Series &series, TvShow *show);
     void parseAndAssignActors(QString xml, TvShow *show);
     void parseAndAssignBanners(QString xml, TvShow *show, TvShowUpdateType updateType, QList<int> infosToLoad);
     void parseAndAssignSingleEpisodeInfos(QDomElement elem, TvShowEpisode *episode, QList<int> infosToLoad);
+    QString seriesKey(QString id);
+    QString seriesCacheFile(QString key);
+    bool loadCachedSeries(QString key);
+    const Series &cacheSeries(QString key, QString xml, bool writeToDisk = true);
     QComboBox *m_box;
     QWidget *m_widget;
 };
@@ -2,12 +2,12 @@
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
-#include <QRegExp>
 #include "globals/Helper.h"
 
 TvTunes::TvTunes(QObject *parent) :
     QObject(parent)
 {
+    m_searchExtractor.addField("result", "[0-9]*\\.&nbsp;<a href=\"http://www.televisiontunes.com/(.*).html\">(.*)</a>", HtmlExtractor::AllMatches);
 }
 
 void TvTunes::search(QString searchStr)
@@ -39,18 +39,11 @@ void TvTunes::onSearchFinished()
 QList<ScraperSearchResult> TvTunes::parseSearch(QString html)
 {
     QList<ScraperSearchResult> results;
-
-    QRegExp rx;
-    rx.setMinimal(true);
-
-    rx.setPattern("[0-9]*\\.&nbsp;<a href=\"http://www.televisiontunes.com/(.*).html\">(.*)</a>");
-    int pos = 0;
-    while ((pos = rx.indexIn(html, pos)) != -1) {
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.id = QString("http://www.televisiontunes.com/download.php?f=%1").arg(rx.cap(1));
-        result.name = rx.cap(2);
+        result.id = QString("http://www.televisiontunes.com/download.php?f=%1").arg(match.at(0));
+        result.name = match.at(1);
         results.append(result);
-        pos += rx.matchedLength();
     }
 
     return results;
@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QNetworkAccessManager>
 #include "globals/Globals.h"
+#include "scrapers/HtmlExtractor.h"
 
 class TvTunes : public QObject
 {
@@ -20,6 +21,7 @@ private slots:
 
 private:
     QNetworkAccessManager m_qnam;
+    HtmlExtractor m_searchExtractor;
     QList<ScraperSearchResult> parseSearch(QString html);
 };
 
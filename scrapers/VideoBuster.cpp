@@ -25,6 +25,34 @@ VideoBuster::VideoBuster(QObject *parent)
                       << MovieScraperInfos::Overview
                       << MovieScraperInfos::Poster
                       << MovieScraperInfos::Backdrop;
+    setupExtractors();
+}
+
+/**
+ * @brief Registers the patterns of all fields parsed from VideoBuster pages
+ */
+void VideoBuster::setupExtractors()
+{
+    m_searchExtractor.addField("result", "<div class=\"name\">([^>]*)>([^<]*)</a>.*<a class=\"more\" href=\"([^\"]*)\">.*<label>Produktion</label>.*([0-9]+)</div>",
+                               HtmlExtractor::AllMatches);
+
+    m_infoExtractor.addField("title", MovieScraperInfos::Title, "class=\"name\">([^<]*)</h1>");
+    m_infoExtractor.addField("originalTitle", MovieScraperInfos::Title, "Originaltitel:</div>.*<div class=\"content\">([^<]*)</div>");
+    m_infoExtractor.addField("year", MovieScraperInfos::Released, "Produktion:</div>.*<div class=\"content\">.*([0-9]*)</div>");
+    m_infoExtractor.addField("country", MovieScraperInfos::Countries, "Produktion:</div>.*<div class=\"content\">(.*)([0-9]+|</div>)", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("certification", MovieScraperInfos::Certification, "FSK ab ([0-9]+) ");
+    m_infoExtractor.addField("actor", MovieScraperInfos::Actors, "class=\"actor_link\">([^<]*)</a>", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("studio", MovieScraperInfos::Studios, "Studio:</div>.*<div class=\"content\">([^<]*)</div>");
+    m_infoExtractor.addField("runtime", MovieScraperInfos::Runtime, "Laufzeit ca. ([0-9]*) Minuten");
+    m_infoExtractor.addField("rating", MovieScraperInfos::Rating, "Gesamtwertung: ([0-9.]+) Sterne  bei ([0-9]*) Stimmen");
+    m_infoExtractor.addField("genre", MovieScraperInfos::Genres, "<a href='/genrelist.php/.*>([^<]*)</a>");
+    m_infoExtractor.addField("tagline", MovieScraperInfos::Tagline, "class=\"long_name\">([^<]*)</p>");
+    m_infoExtractor.addField("overview", MovieScraperInfos::Overview, "<div class=\"txt movie_description\">(.*)(<br />|</div>)");
+    m_infoExtractor.addField("poster", MovieScraperInfos::Poster, "src=\"(https://gfx.videobuster.de/archive/resized)/w124/([^\"]*)\"", HtmlExtractor::AllMatches);
+    m_infoExtractor.addField("backdrops", MovieScraperInfos::Backdrop, "<a href=\"/titledtl.php/([^\\?]*)\\?tab=gallery&content_type_idnr=1");
+
+    m_backdropExtractor.addField("backdrop", "href=\"https://gfx.videobuster.de/archive/resized/([^\"]*)\"(.*)([^<]*)<img (.*) src=\"https://gfx.videobuster.de/archive/resized/c110/([^\"]*)\"",
+                                 HtmlExtractor::AllMatches);
 }
 
 /**
@@ -113,16 +141,12 @@ QList<ScraperSearchResult> VideoBuster::parseSearch(QString html)
 {
     qDebug() << "Entered";
     QList<ScraperSearchResult> results;
-    int pos = 0;
-    QRegExp rx("<div class=\"name\">([^>]*)>([^<]*)</a>.*<a class=\"more\" href=\"([^\"]*)\">.*<label>Produktion</label>.*([0-9]+)</div>");
-    rx.setMinimal(true);
-    while ((pos = rx.indexIn(html, pos)) != -1) {
+    foreach (const QStringList &match, m_searchExtractor.extract(html).matches("result")) {
         ScraperSearchResult result;
-        result.name     = rx.cap(2);
-        result.id       = rx.cap(3);
-        result.released = QDate::fromString(rx.cap(4), "yyyy");
+        result.name     = match.at(1);
+        result.id       = match.at(2);
+        result.released = QDate::fromString(match.at(3), "yyyy");
         results.append(result);
-        pos += rx.matchedLength();
     }
     return results;
 }
@@ -178,98 +202,75 @@ void VideoBuster::parseAndAssignInfos(QString html, Movie *movie, QList<int> inf
 {
     qDebug() << "Entered";
     movie->clear(infos);
-    QRegExp rx;
-    rx.setMinimal(true);
-    int pos = 0;
     QTextDocument doc;
+    HtmlExtractor::Result fields = m_infoExtractor.extract(html, infos);
 
     // Title
-    rx.setPattern("class=\"name\">([^<]*)</h1>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setName(rx.cap(1).trimmed());
+    if (fields.contains("title"))
+        movie->setName(fields.value("title").trimmed());
 
     // Original Title
-    rx.setPattern("Originaltitel:</div>.*<div class=\"content\">([^<]*)</div>");
-    if (infos.contains(MovieScraperInfos::Title) && rx.indexIn(html) != -1)
-        movie->setOriginalName(rx.cap(1).trimmed());
+    if (fields.contains("originalTitle"))
+        movie->setOriginalName(fields.value("originalTitle").trimmed());
 
     // Year
-    rx.setPattern("Produktion:</div>.*<div class=\"content\">.*([0-9]*)</div>");
-    if (infos.contains(MovieScraperInfos::Released) && rx.indexIn(html) != -1)
-        movie->setReleased(QDate::fromString(rx.cap(1).trimmed(), "yyyy"));
+    if (fields.contains("year"))
+        movie->setReleased(QDate::fromString(fields.value("year").trimmed(), "yyyy"));
 
     // Country
-    pos = 0;
-    rx.setPattern("Produktion:</div>.*<div class=\"content\">(.*)([0-9]+|</div>)");
-    while (infos.contains(MovieScraperInfos::Countries) && (pos = rx.indexIn(html, pos)) != -1) {
-        movie->addCountry(Helper::mapCountry(rx.cap(1).trimmed()));
-        pos += rx.matchedLength();
-    }
+    foreach (const QString &country, fields.values("country"))
+        movie->addCountry(Helper::mapCountry(country.trimmed()));
 
     // MPAA
-    rx.setPattern("FSK ab ([0-9]+) ");
-    if (infos.contains(MovieScraperInfos::Certification) && rx.indexIn(html) != -1)
-        movie->setCertification(Helper::mapCertification("FSK " + rx.cap(1)));
+    if (fields.contains("certification"))
+        movie->setCertification(Helper::mapCertification("FSK " + fields.value("certification")));
 
     // Actors
-    pos = 0;
-    rx.setPattern("class=\"actor_link\">([^<]*)</a>");
-    while (infos.contains(MovieScraperInfos::Actors) && (pos = rx.indexIn(html, pos)) != -1) {
+    foreach (const QString &actor, fields.values("actor")) {
         Actor a;
-        a.name = rx.cap(1).trimmed();
+        a.name = actor.trimmed();
         movie->addActor(a);
-        pos += rx.matchedLength();
     }
 
     // Studio
-    rx.setPattern("Studio:</div>.*<div class=\"content\">([^<]*)</div>");
-    if (infos.contains(MovieScraperInfos::Studios) && rx.indexIn(html) != -1)
-        movie->addStudio(Helper::mapStudio(rx.cap(1).trimmed()));
+    if (fields.contains("studio"))
+        movie->addStudio(Helper::mapStudio(fields.value("studio").trimmed()));
 
     // Runtime
-    rx.setPattern("Laufzeit ca. ([0-9]*) Minuten");
-    if (infos.contains(MovieScraperInfos::Runtime) && rx.indexIn(html) != -1)
-        movie->setRuntime(rx.cap(1).trimmed().toInt());
+    if (fields.contains("runtime"))
+        movie->setRuntime(fields.value("runtime").trimmed().toInt());
 
     // Rating
-    rx.setPattern("Gesamtwertung: ([0-9.]+) Sterne  bei ([0-9]*) Stimmen");
-    if (infos.contains(MovieScraperInfos::Rating) && rx.indexIn(html) != -1)
-        movie->setRating(rx.cap(1).trimmed().toFloat());
+    if (fields.contains("rating"))
+        movie->setRating(fields.value("rating").trimmed().toFloat());
 
     // Genres
-    rx.setPattern("<a href='/genrelist.php/.*>([^<]*)</a>");
-    if (infos.contains(MovieScraperInfos::Genres) && rx.indexIn(html) != -1)
-        movie->addGenre(Helper::mapGenre(rx.cap(1).trimmed()));
+    if (fields.contains("genre"))
+        movie->addGenre(Helper::mapGenre(fields.value("genre").trimmed()));
 
     // Tagline
-    rx.setPattern("class=\"long_name\">([^<]*)</p>");
-    if (infos.contains(MovieScraperInfos::Tagline) && rx.indexIn(html) != -1)
-        movie->setTagline(rx.cap(1).trimmed());
+    if (fields.contains("tagline"))
+        movie->setTagline(fields.value("tagline").trimmed());
 
     // Overview
-    rx.setPattern("<div class=\"txt movie_description\">(.*)(<br />|</div>)");
-    if (infos.contains(MovieScraperInfos::Overview) && rx.indexIn(html) != -1) {
-        doc.setHtml(rx.cap(1).trimmed());
+    if (fields.contains("overview")) {
+        doc.setHtml(fields.value("overview").trimmed());
         movie->setOverview(doc.toPlainText());
         if (Settings::instance()->usePlotForOutline())
             movie->setOutline(doc.toPlainText());
     }
 
     // Posters
-    pos = 0;
-    rx.setPattern("src=\"(https://gfx.videobuster.de/archive/resized)/w124/([^\"]*)\"");
-    while (infos.contains(MovieScraperInfos::Poster) && (pos = rx.indexIn(html, pos)) != -1) {
+    foreach (const QStringList &poster, fields.matches("poster")) {
         Poster p;
-        p.thumbUrl = rx.cap(1) + "/h550/" + rx.cap(2);
-        p.originalUrl = rx.cap(1) + "/w700/" + rx.cap(2);
+        p.thumbUrl = poster.at(0) + "/h550/" + poster.at(1);
+        p.originalUrl = poster.at(0) + "/w700/" + poster.at(1);
         movie->addPoster(p);
-        pos += rx.matchedLength();
     }
 
     // Backdrops
-    rx.setPattern("<a href=\"/titledtl.php/([^\\?]*)\\?tab=gallery&content_type_idnr=1");
-    if (infos.contains(MovieScraperInfos::Backdrop) && rx.indexIn(html) != -1) {
-        QUrl backdropUrl(QString("https://www.videobuster.de/titledtl.php/%1?tab=gallery&content_type_idnr=1").arg(rx.cap(1)));
+    if (fields.contains("backdrops")) {
+        QUrl backdropUrl(QString("https://www.videobuster.de/titledtl.php/%1?tab=gallery&content_type_idnr=1").arg(fields.value("backdrops")));
         QNetworkReply *reply = qnam()->get(QNetworkRequest(backdropUrl));
         reply->setProperty("storage", Storage::toVariant(reply, movie));
         reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
@@ -293,17 +294,13 @@ void VideoBuster::backdropFinished()
 
     if (reply->error() == QNetworkReply::NoError ) {
         QString msg = reply->readAll();
-        QRegExp rx("href=\"https://gfx.videobuster.de/archive/resized/([^\"]*)\"(.*)([^<]*)<img (.*) src=\"https://gfx.videobuster.de/archive/resized/c110/([^\"]*)\"");
-        rx.setMinimal(true);
-        int pos = 0;
-        while ((pos = rx.indexIn(msg, pos)) != -1) {
-            pos += rx.matchedLength();
-            if (rx.cap(2).contains("titledtl_cover_pictures")) {
+        foreach (const QStringList &backdrop, m_backdropExtractor.extract(msg).matches("backdrop")) {
+            if (backdrop.at(1).contains("titledtl_cover_pictures")) {
                 continue;
             }
             Poster p;
-            p.thumbUrl = QUrl(QString("https://gfx.videobuster.de/archive/resized/w700/%1").arg(rx.cap(5)));
-            p.originalUrl = QUrl(QString("https://gfx.videobuster.de/archive/resized/%1").arg(rx.cap(1)));
+            p.thumbUrl = QUrl(QString("https://gfx.videobuster.de/archive/resized/w700/%1").arg(backdrop.at(4)));
+            p.originalUrl = QUrl(QString("https://gfx.videobuster.de/archive/resized/%1").arg(backdrop.at(0)));
             movie->addBackdrop(p);
         }
     } else {
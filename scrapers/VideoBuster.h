@@ -7,6 +7,7 @@
 #include <QWidget>
 
 #include "data/ScraperInterface.h"
+#include "scrapers/HtmlExtractor.h"
 
 /**
  * @brief The VideoBuster class
@@ -39,11 +40,15 @@ private slots:
 private:
     QNetworkAccessManager m_qnam;
     QList<int> m_scraperSupports;
+    HtmlExtractor m_searchExtractor;
+    HtmlExtractor m_infoExtractor;
+    HtmlExtractor m_backdropExtractor;
 
     QNetworkAccessManager *qnam();
     QList<ScraperSearchResult> parseSearch(QString html);
     void parseAndAssignInfos(QString html, Movie *movie, QList<int> infos);
     QString replaceEntities(const QString msg);
+    void setupExtractors();
 };
 
 #endif // VIDEOBUSTER_H
@@ -111,20 +111,12 @@ void SetsWidget::loadSets()
     m_moviesToSave.clear();
     m_setPosters.clear();
     m_setBackdrops.clear();
-    foreach (Movie *movie, Manager::instance()->movieModel()->movies()) {
-        if (!movie->set().isEmpty()) {
-            if (m_sets.contains(movie->set())) {
-                m_sets[movie->set()].append(movie);
-            } else {
-                QList<Movie*> l;
-                QList<Movie*> el;
-                l << movie;
-                m_sets.insert(movie->set(), l);
-                m_moviesToSave.insert(movie->set(), el);
-                m_setPosters.insert(movie->set(), QImage());
-                m_setBackdrops.insert(movie->set(), QImage());
-            }
-        }
+    MovieIndex *movieIndex = Manager::instance()->movieModel()->movieIndex();
+    foreach (const QString &set, movieIndex->values(MovieIndex::Set)) {
+        m_sets.insert(set, movieIndex->movies(MovieIndex::Set, set));
+        m_moviesToSave.insert(set, QList<Movie*>());
+        m_setPosters.insert(set, QImage());
+        m_setBackdrops.insert(set, QImage());
     }
     foreach (const QString &set, m_addedSets) {
         if (!set.isEmpty() && !m_sets.contains(set)) {
@@ -246,9 +238,7 @@ void SetsWidget::loadSet(QString set)
         ui->buttonPreviewBackdrop->setEnabled(true);
         m_currentBackdrop = backdrop;
     } else {
-        QPixmap pixmap = QPixmap(":/img/pictures_alt.png").scaled(QSize(64, 64) * Helper::devicePixelRatio(this), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-        Helper::setDevicePixelRatio(pixmap, Helper::devicePixelRatio(this));
-        ui->backdrop->setPixmap(pixmap);
+        ui->backdrop->setPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64), Helper::devicePixelRatio(this)));
         ui->buttonPreviewBackdrop->setEnabled(false);
     }
     ui->movies->blockSignals(false);
@@ -553,12 +543,12 @@ void SetsWidget::onDownloadFinished(DownloadManagerElement elem)
     QString setName = elem.movie->name();
     if (elem.imageType == ImageType::MovieSetPoster) {
         if (m_setPosters.contains(setName))
-            m_setPosters[setName] = QImage::fromData(elem.data);
+            m_setPosters[setName] = QImage::fromData(elem.image.data());
         if (ui->sets->currentRow() >= 0 && ui->sets->currentRow() < ui->sets->rowCount() && ui->sets->item(ui->sets->currentRow(), 0)->text() == setName)
             loadSet(setName);
     } else if (elem.imageType == ImageType::MovieSetBackdrop) {
         if (m_setBackdrops.contains(setName))
-            m_setBackdrops[setName] = QImage::fromData(elem.data);
+            m_setBackdrops[setName] = QImage::fromData(elem.image.data());
         if (ui->sets->currentRow() >= 0 && ui->sets->currentRow() < ui->sets->rowCount() && ui->sets->item(ui->sets->currentRow(), 0)->text() == setName)
             loadSet(setName);
     }
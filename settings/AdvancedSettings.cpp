@@ -21,7 +21,10 @@ void AdvancedSettings::reset()
 {
     m_debugLog = false;
     m_forceCache = false;
+    m_syncWrites = false;
     m_logFile = "";
+    m_logLevels.clear();
+    m_traceFile = "";
     m_sortTokens = QStringList() << "Der" << "Die" << "Das" << "The" << "Le" << "La" << "Les" << "Un" << "Une" << "Des";
     m_genreMappings.clear();
     m_audioCodecMappings.clear();
@@ -93,6 +96,8 @@ void AdvancedSettings::loadSettings()
             loadCountryMappings(xml);
         else if (xml.name() == "portableMode")
             m_portableMode = (xml.readElementText() == "true");
+        else if (xml.name() == "syncWrites")
+            m_syncWrites = (xml.readElementText() == "true");
         else
             xml.skipCurrentElement();
     }
@@ -100,7 +105,10 @@ void AdvancedSettings::loadSettings()
     qDebug() << "Advanced settings";
     qDebug() << "    debugLog              " << m_debugLog;
     qDebug() << "    logFile               " << m_logFile;
+    qDebug() << "    logLevels             " << m_logLevels;
+    qDebug() << "    traceFile             " << m_traceFile;
     qDebug() << "    forceCache            " << m_forceCache;
+    qDebug() << "    syncWrites            " << m_syncWrites;
     qDebug() << "    sortTokens            " << m_sortTokens;
     qDebug() << "    genreMappings         " << m_genreMappings;
     qDebug() << "    movieFilters          " << m_movieFilters;
@@ -122,6 +130,10 @@ void AdvancedSettings::loadLog(QXmlStreamReader &xml)
             m_debugLog = (xml.readElementText() == "true");
         else if (xml.name() == "file")
             m_logFile = xml.readElementText();
+        else if (xml.name() == "level" && !xml.attributes().value("class").isEmpty())
+            m_logLevels.insert(xml.attributes().value("class").toString(), xml.readElementText());
+        else if (xml.name() == "trace")
+            m_traceFile = xml.readElementText();
         else
             xml.skipCurrentElement();
     }
@@ -264,6 +276,16 @@ QString AdvancedSettings::logFile() const
     return m_logFile;
 }
 
+QHash<QString, QString> AdvancedSettings::logLevels() const
+{
+    return m_logLevels;
+}
+
+QString AdvancedSettings::traceFile() const
+{
+    return m_traceFile;
+}
+
 QStringList AdvancedSettings::sortTokens() const
 {
     return m_sortTokens;
@@ -337,3 +359,8 @@ bool AdvancedSettings::portableMode() const
     return false;
 #endif
 }
+
+bool AdvancedSettings::syncWrites() const
+{
+    return m_syncWrites;
+}
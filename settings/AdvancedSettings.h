@@ -16,6 +16,8 @@ public:
 
     bool debugLog() const;
     QString logFile() const;
+    QHash<QString, QString> logLevels() const;
+    QString traceFile() const;
     QStringList sortTokens() const;
     QHash<QString, QString> genreMappings() const;
     QStringList movieFilters() const;
@@ -30,10 +32,13 @@ public:
     bool useFirstStudioOnly() const;
     bool forceCache() const;
     bool portableMode() const;
+    bool syncWrites() const;
 
 private:
     bool m_debugLog;
     QString m_logFile;
+    QHash<QString, QString> m_logLevels;
+    QString m_traceFile;
     QStringList m_sortTokens;
     QHash<QString, QString> m_genreMappings;
     QStringList m_movieFilters;
@@ -48,6 +53,7 @@ private:
     bool m_useFirstStudioOnly;
     bool m_forceCache;
     bool m_portableMode;
+    bool m_syncWrites;
 
     void loadSettings();
     void reset();
@@ -48,7 +48,7 @@ int DataFile::pos() const
  * @param season Season number
  * @return
  */
-QString DataFile::saveFileName(const QString &fileName, int season, bool stacked)
+QString DataFile::saveFileName(const QString &fileName, int season, bool stacked) const
 {
     if (type() == DataFileType::MovieSetBackdrop || type() == DataFileType::MovieSetPoster) {
         QString newFileName = m_fileName;
@@ -94,7 +94,7 @@ int DataFile::type() const
  * @param b
  * @return a lessThan b
  */
-bool DataFile::lessThan(DataFile a, DataFile b)
+bool DataFile::lessThan(const DataFile &a, const DataFile &b)
 {
     return a.pos() < b.pos();
 }
@@ -13,8 +13,8 @@ public:
     int type() const;
     QString fileName() const;
     int pos() const;
-    QString saveFileName(const QString &fileName, int season = -1, bool stacked = false);
-    static bool lessThan(DataFile a, DataFile b);
+    QString saveFileName(const QString &fileName, int season = -1, bool stacked = false) const;
+    static bool lessThan(const DataFile &a, const DataFile &b);
     void setFileName(QString fileName);
 
     static int dataFileTypeForImageType(int imageType);
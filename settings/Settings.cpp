@@ -59,6 +59,7 @@ Settings::Settings(QObject *parent) :
     m_initialDataFilesFrodo.append(DataFile(DataFileType::ConcertCdArt, "disc.png", 0));
     m_initialDataFilesFrodo.append(DataFile(DataFileType::ConcertClearArt, "clearart.png", 0));
     m_initialDataFilesFrodo.append(DataFile(DataFileType::ConcertLogo, "logo.png", 0));
+    m_initialDataFilesFrodoByType = dataFilesByType(m_initialDataFilesFrodo);
 }
 
 /**
@@ -240,6 +241,7 @@ void Settings::loadSettings()
         m_dataFiles = m_initialDataFilesFrodo;
     else
         m_dataFiles = dataFiles;
+    sortDataFiles();
 
     // Movie set artwork
     m_movieSetArtworkType = settings()->value("MovieSetArtwork/StoringType", 0).toInt();
@@ -628,33 +630,55 @@ bool Settings::autoLoadStreamDetails()
 }
 
 /**
- * @brief Settings::dataFiles
- * @param type
- * @return
+ * @brief Returns the data files of a type sorted by position.
+ *        The reference stays valid until the data files are changed with setDataFiles.
+ * @param type Data file type
+ * @return Data files of the type
  */
-QList<DataFile> Settings::dataFiles(int type)
+const QList<DataFile> &Settings::dataFiles(int type) const
+{
+    return dataFilesOfType(m_dataFilesByType, type);
+}
+
+/**
+ * @brief Groups the data files by their type and sorts them by position.
+ *        dataFiles() is called for every image of every item, so this is only done when the data files change.
+ */
+void Settings::sortDataFiles()
+{
+    m_dataFilesByType = dataFilesByType(m_dataFiles);
+}
+
+QMap<int, QList<DataFile> > Settings::dataFilesByType(const QList<DataFile> &files)
 {
-    QList<DataFile> files;
-    foreach (const DataFile &file, m_dataFiles) {
-        if (file.type() == type)
-            files.append(file);
+    QMap<int, QList<DataFile> > filesByType;
+    foreach (const DataFile &file, files)
+        filesByType[file.type()].append(file);
+    QMutableMapIterator<int, QList<DataFile> > it(filesByType);
+    while (it.hasNext()) {
+        it.next();
+        qSort(it.value().begin(), it.value().end(), DataFile::lessThan);
     }
-    qSort(files.begin(), files.end(), DataFile::lessThan);
-    return files;
+    return filesByType;
 }
 
-QList<DataFile> Settings::dataFilesFrodo(int type)
+const QList<DataFile> &Settings::dataFilesOfType(const QMap<int, QList<DataFile> > &files, int type)
+{
+    static const QList<DataFile> noFiles;
+    QMap<int, QList<DataFile> >::const_iterator it = files.constFind(type);
+    return (it == files.constEnd()) ? noFiles : it.value();
+}
+
+/**
+ * @brief Returns the default data files
+ * @param type Data file type or -1 for all data files
+ * @return Data files sorted by position
+ */
+const QList<DataFile> &Settings::dataFilesFrodo(int type) const
 {
     if (type == -1)
         return m_initialDataFilesFrodo;
-
-    QList<DataFile> files;
-    foreach (const DataFile &file, m_initialDataFilesFrodo) {
-        if (file.type() == type)
-            files.append(file);
-    }
-    qSort(files.begin(), files.end(), DataFile::lessThan);
-    return files;
+    return dataFilesOfType(m_initialDataFilesFrodoByType, type);
 }
 
 /**
@@ -825,6 +849,7 @@ void Settings::setUseYoutubePluginUrls(bool use)
 void Settings::setDataFiles(QList<DataFile> files)
 {
     m_dataFiles = files;
+    sortDataFiles();
 }
 
 /**
@@ -1,6 +1,7 @@
 #ifndef SETTINGS_H
 #define SETTINGS_H
 
+#include <QMap>
 #include <QObject>
 #include <QPoint>
 #include <QSettings>
@@ -56,8 +57,8 @@ public:
     QString debugLogPath();
     bool useYoutubePluginUrls();
     bool downloadActorImages();
-    QList<DataFile> dataFiles(int type);
-    QList<DataFile> dataFilesFrodo(int type = -1);
+    const QList<DataFile> &dataFiles(int type) const;
+    const QList<DataFile> &dataFilesFrodo(int type = -1) const;
     bool usePlotForOutline();
     QList<int> scraperInfos(MainWidgets widget, QString scraperId);
     void renamePatterns(int renameType, QString &fileNamePattern, QString &fileNamePatternMulti, QString &directoryPattern, QString &seasonPattern);
@@ -186,7 +187,9 @@ private:
     bool m_downloadActorImages;
     bool m_autoLoadStreamDetails;
     QList<DataFile> m_dataFiles;
+    QMap<int, QList<DataFile> > m_dataFilesByType;
     QList<DataFile> m_initialDataFilesFrodo;
+    QMap<int, QList<DataFile> > m_initialDataFilesFrodoByType;
     bool m_usePlotForOutline;
     QString m_xbmcHost;
     int m_xbmcPort;
@@ -211,6 +214,9 @@ private:
     QString m_lastImagePath;
 
     void setupProxy();
+    void sortDataFiles();
+    static QMap<int, QList<DataFile> > dataFilesByType(const QList<DataFile> &files);
+    static const QList<DataFile> &dataFilesOfType(const QMap<int, QList<DataFile> > &files, int type);
     QPoint fixWindowPosition(QPoint p);
 };
 
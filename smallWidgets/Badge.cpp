@@ -1,6 +1,7 @@
 #include "Badge.h"
 
 #include <QPainter>
+#include "globals/Helper.h"
 
 Badge::Badge(QWidget *parent) :
     QLabel(parent)
@@ -52,10 +53,10 @@ void Badge::paintEvent(QPaintEvent *event)
     }
 
     if (m_active && m_showActiveMark) {
-        QImage mark = QImage(":img/checkmark_white_64.png").scaledToWidth(12, Qt::SmoothTransformation);
+        QPixmap mark = Helper::scaledPixmap(":/img/checkmark_white_64.png", QSize(12, 0));
         QPainter p(this);
         p.save();
-        p.drawImage(7, (height()-mark.height())/2, mark);
+        p.drawPixmap(7, (height()-mark.height())/2, mark);
         p.restore();
     }
 }
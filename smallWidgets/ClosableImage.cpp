@@ -37,7 +37,7 @@ ClosableImage::ClosableImage(QWidget *parent) :
     m_loadingMovie = new QMovie(":/img/spinner.gif");
     m_loadingMovie->start();
 
-    m_zoomIn = QPixmap(":/img/zoom_in.png");
+    m_zoomIn = Helper::scaledPixmap(":/img/zoom_in.png");
     Helper::setDevicePixelRatio(m_zoomIn, Helper::devicePixelRatio(this));
     QPainter p;
     p.begin(&m_zoomIn);
@@ -139,9 +139,7 @@ void ClosableImage::paintEvent(QPaintEvent *event)
     Helper::setDevicePixelRatio(img, Helper::devicePixelRatio(this));
     QRect r = rect();
     p.drawImage(0, 7, img);
-    QImage closeImg = QImage(":/img/closeImage.png").scaled(QSize(20, 20) * Helper::devicePixelRatio(this), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-    Helper::setDevicePixelRatio(closeImg, Helper::devicePixelRatio(this));
-    p.drawImage(r.width()-21, 0, closeImg);
+    p.drawPixmap(r.width()-21, 0, Helper::scaledPixmap(":/img/closeImage.png", QSize(20, 20), Helper::devicePixelRatio(this)));
     if (m_showZoomAndResolution) {
         QString res = QString("%1x%2").arg(origWidth).arg(origHeight);
         QFontMetrics fm(m_font);
@@ -186,9 +184,9 @@ void ClosableImage::setMyData(const QVariant &data)
 void ClosableImage::setImage(const QByteArray &image)
 {
     clear();
-    QImage img = QImage::fromData(image);
     m_image = image;
-    updateSize(img.width(), img.height());
+    QSize size = ImageCache::probeSize(image);
+    updateSize(size.width(), size.height());
 }
 
 void ClosableImage::setImage(const QString &image)
@@ -1,6 +1,8 @@
 #include "LoadingStreamDetails.h"
 #include "ui_LoadingStreamDetails.h"
 
+#include "data/StreamDetailsService.h"
+
 LoadingStreamDetails::LoadingStreamDetails(QWidget *parent) :
     QDialog(parent),
     ui(new Ui::LoadingStreamDetails)
@@ -34,6 +36,11 @@ void LoadingStreamDetails::loadMovies(QList<Movie*> movies)
     ui->currentFile->clear();
     adjustSize();
     show();
+
+    // Queue all probes first so they run on the worker pool while we wait for the first one
+    foreach (Movie *movie, movies)
+        StreamDetailsService::instance()->load(movie->files());
+
     foreach (Movie *movie, movies) {
         movie->blockSignals(true);
         movie->controller()->loadStreamDetailsFromFile();
@@ -53,6 +60,10 @@ void LoadingStreamDetails::loadConcerts(QList<Concert*> concerts)
     ui->currentFile->clear();
     adjustSize();
     show();
+
+    foreach (Concert *concert, concerts)
+        StreamDetailsService::instance()->load(concert->files());
+
     foreach (Concert *concert, concerts) {
         concert->controller()->loadStreamDetailsFromFile();
         concert->setChanged(true);
@@ -70,6 +81,10 @@ void LoadingStreamDetails::loadTvShowEpisodes(QList<TvShowEpisode *> episodes)
     ui->currentFile->clear();
     adjustSize();
     show();
+
+    foreach (TvShowEpisode *episode, episodes)
+        StreamDetailsService::instance()->load(episode->files());
+
     foreach (TvShowEpisode *episode, episodes) {
         episode->loadStreamDetailsFromFile();
         episode->setChanged(true);
@@ -3,6 +3,8 @@
 
 #include <QDebug>
 #include <QPainter>
+#include <QPixmapCache>
+#include "globals/Helper.h"
 
 /**
  * @brief MediaFlags::MediaFlags
@@ -146,16 +148,17 @@ void MediaFlags::setupChannels(StreamDetails *streamDetails)
 
 QPixmap MediaFlags::colorIcon(QString icon)
 {
-    static QMap<QString, QPixmap> pixmaps;
-    if (pixmaps.contains(icon))
-        return pixmaps.value(icon);
+    QString key = QString("mediaFlag_%1_%2").arg(icon).arg(m_height);
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap))
+        return pixmap;
 
-    QPixmap pixmap = QPixmap(icon).scaledToHeight(m_height, Qt::SmoothTransformation);
+    pixmap = Helper::scaledPixmap(icon, QSize(0, m_height));
     QPainter p;
     p.begin(&pixmap);
     p.setCompositionMode(QPainter::CompositionMode_SourceIn);
     p.fillRect(pixmap.rect(), QColor(34, 79, 127, 255));
     p.end();
-    pixmaps.insert(icon, pixmap);
+    QPixmapCache::insert(key, pixmap);
     return pixmap;
 }
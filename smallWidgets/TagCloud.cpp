@@ -2,6 +2,7 @@
 #include "ui_TagCloud.h"
 
 #include <QDebug>
+#include <QSet>
 #include "Badge.h"
 #include "globals/LocaleStringCompare.h"
 
@@ -35,14 +36,19 @@ void TagCloud::setTags(const QStringList &tags, const QStringList &activeTags)
     m_tags.clear();
     m_activeTags.clear();
 
+    QSet<QString> knownTags;
     foreach (const QString &tag, tags) {
-        if (!m_tags.contains(tag))
+        if (!knownTags.contains(tag)) {
+            knownTags.insert(tag);
             m_tags.append(tag);
+        }
     }
 
     foreach (const QString &tag, activeTags) {
-        if (!m_tags.contains(tag))
+        if (!knownTags.contains(tag)) {
+            knownTags.insert(tag);
             m_tags.append(tag);
+        }
         if (!m_activeTags.contains(tag))
             m_activeTags.append(tag);
     }
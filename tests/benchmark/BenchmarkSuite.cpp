@@ -0,0 +1,348 @@
+#include "BenchmarkSuite.h"
+
+#include <QDir>
+#include <QFile>
+#include <QScriptEngine>
+#include <QScriptValueIterator>
+#include <QSignalSpy>
+#include <QTest>
+#include "data/MovieProxyModel.h"
+#include "export/Exporter.h"
+#include "globals/Filter.h"
+#include "globals/JsonValue.h"
+#include "globals/Manager.h"
+#include "main/FileScannerDialog.h"
+#include "main/MainWindow.h"
+#include "scrapers/IMDB.h"
+#include "scrapers/TMDb.h"
+#include "settings/Settings.h"
+#include "tests/benchmark/StartupBenchmark.h"
+#include "tests/benchmark/SyntheticLibrary.h"
+
+static const char *databasePath = "MediaElch-Benchmark";
+static const int loadTimeout = 30*60*1000;
+
+static QStringList tmdbFixtures()
+{
+    return QStringList() << "tmdb-movie.json" << "tmdb-casts.json" << "tmdb-trailers.json" << "tmdb-images.json" << "tmdb-releases.json";
+}
+
+static void exportLibraryTo(const QString &directory)
+{
+    ExportTemplate exportTemplate;
+    exportTemplate.setIdentifier("benchmark");
+    exportTemplate.setVersion("1");
+    exportTemplate.setTemplateLocation(":/fixtures/export");
+    QList<ExportTemplate::ExportSection> sections;
+    sections << ExportTemplate::SectionMovies << ExportTemplate::SectionTvShows << ExportTemplate::SectionConcerts;
+
+    Exporter exporter;
+    QVERIFY(exporter.exportTo(directory, &exportTemplate, sections));
+}
+
+static int walkScriptValue(const QScriptValue &value)
+{
+    int size = 0;
+    if (value.isArray()) {
+        for (int i=0, n=value.property("length").toInt32() ; i<n ; ++i)
+            size += walkScriptValue(value.property(i));
+    } else if (value.isObject()) {
+        QScriptValueIterator it(value);
+        while (it.hasNext()) {
+            it.next();
+            size += walkScriptValue(it.value());
+        }
+    } else {
+        size += value.toString().size();
+    }
+    return size;
+}
+
+static int walkJsonValue(const JsonValue &value)
+{
+    int size = 0;
+    if (value.isArray()) {
+        foreach (const JsonValue &element, value.elements())
+            size += walkJsonValue(element);
+    } else if (value.isObject()) {
+        foreach (const QString &key, value.keys())
+            size += walkJsonValue(value.property(key));
+    } else {
+        size += value.toString().size();
+    }
+    return size;
+}
+
+/**
+ * @brief BenchmarkSuite::BenchmarkSuite
+ * @param parent
+ */
+BenchmarkSuite::BenchmarkSuite(QObject *parent) :
+    QObject(parent),
+    m_mainWindow(0)
+{
+}
+
+/**
+ * @brief Generates the library, uses it as the only library directories and waits until the main window loaded it
+ */
+void BenchmarkSuite::initTestCase()
+{
+    QList<int> counts = SyntheticLibrary::counts();
+    SyntheticLibrary library(QDir::tempPath() + "/MediaElch-Benchmark-Suite");
+    QVERIFY(library.create(counts.at(0), counts.at(1), counts.at(2), counts.at(3)));
+
+    QFile::remove(Settings::instance()->databaseDir() + "/MediaElch.sqlite");
+    StartupBenchmark::setLibraryDirectories(library);
+    Settings::instance()->setCheckForUpdates(false);
+
+    m_mainWindow = new MainWindow;
+    QSignalSpy loaded(Manager::instance()->fileScannerDialog(), SIGNAL(accepted()));
+    QVERIFY(loaded.wait(loadTimeout));
+}
+
+void BenchmarkSuite::cleanupTestCase()
+{
+    Manager::instance()->database()->clearMovies(databasePath);
+    delete m_mainWindow;
+    m_mainWindow = 0;
+}
+
+/**
+ * @brief Returns the content of a fixture, fixtures are read only once
+ * @param name File name in tests/benchmark/fixtures
+ * @return Content of the fixture
+ */
+QByteArray BenchmarkSuite::fixture(const QString &name)
+{
+    if (!m_fixtures.contains(name)) {
+        QFile file(":/fixtures/" + name);
+        if (file.open(QIODevice::ReadOnly))
+            m_fixtures.insert(name, file.readAll());
+        else
+            m_fixtures.insert(name, QByteArray());
+    }
+    return m_fixtures.value(name);
+}
+
+void BenchmarkSuite::scanMovies()
+{
+    QBENCHMARK {
+        Manager::instance()->movieFileSearcher()->reload(true);
+    }
+}
+
+void BenchmarkSuite::loadMoviesFromCache()
+{
+    QBENCHMARK {
+        Manager::instance()->movieFileSearcher()->reload(false);
+    }
+}
+
+void BenchmarkSuite::scanTvShows()
+{
+    QBENCHMARK {
+        Manager::instance()->tvShowFileSearcher()->reload(true);
+    }
+}
+
+void BenchmarkSuite::loadTvShowsFromCache()
+{
+    QBENCHMARK {
+        Manager::instance()->tvShowFileSearcher()->reload(false);
+    }
+}
+
+void BenchmarkSuite::scanConcerts()
+{
+    QBENCHMARK {
+        Manager::instance()->concertFileSearcher()->reload(true);
+    }
+}
+
+void BenchmarkSuite::loadConcertsFromCache()
+{
+    QBENCHMARK {
+        Manager::instance()->concertFileSearcher()->reload(false);
+    }
+}
+
+void BenchmarkSuite::loadMovieNfos()
+{
+    QBENCHMARK {
+        foreach (Movie *movie, Manager::instance()->movieModel()->movies())
+            movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true, true);
+    }
+}
+
+void BenchmarkSuite::loadEpisodeNfos()
+{
+    QBENCHMARK {
+        foreach (TvShow *show, Manager::instance()->tvShowModel()->tvShows()) {
+            foreach (TvShowEpisode *episode, show->episodes())
+                episode->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), true);
+        }
+    }
+}
+
+void BenchmarkSuite::saveMovieNfos()
+{
+    QBENCHMARK {
+        foreach (Movie *movie, Manager::instance()->movieModel()->movies())
+            Manager::instance()->mediaCenterInterface()->saveMovie(movie);
+    }
+}
+
+void BenchmarkSuite::filterMovies()
+{
+    MovieProxyModel proxyModel;
+    proxyModel.setSourceModel(Manager::instance()->movieModel());
+
+    Filter genreFilter("Genre \"Action\"", "Action", QStringList() << "Genre" << "Action", MovieFilters::Genres, true);
+    Filter titleFilter("Title", "Movie 00", QStringList(), MovieFilters::Title, false);
+    QBENCHMARK {
+        proxyModel.setFilter(QList<Filter*>() << &genreFilter, "");
+        proxyModel.invalidate();
+        proxyModel.setFilter(QList<Filter*>() << &titleFilter, "Movie 00");
+        proxyModel.invalidate();
+        proxyModel.setFilter(QList<Filter*>() << &genreFilter << &titleFilter, "Movie 00");
+        proxyModel.invalidate();
+        proxyModel.setFilter(QList<Filter*>(), "");
+        proxyModel.invalidate();
+    }
+}
+
+void BenchmarkSuite::sortMovies()
+{
+    MovieProxyModel proxyModel;
+    proxyModel.setSourceModel(Manager::instance()->movieModel());
+    QBENCHMARK {
+        proxyModel.setSortBy(SortByName);
+        proxyModel.setSortBy(SortBySeen);
+        proxyModel.setSortBy(SortByAdded);
+        proxyModel.setSortBy(SortByYear);
+        proxyModel.setSortBy(SortByNew);
+    }
+}
+
+/**
+ * @brief Exports the whole library with the template from tests/benchmark/fixtures/export into an empty directory
+ */
+void BenchmarkSuite::exportLibrary()
+{
+    QString directory = QDir::tempPath() + "/MediaElch-Benchmark-Export";
+    QBENCHMARK {
+        QDir(directory).removeRecursively();
+        QDir().mkpath(directory);
+        exportLibraryTo(directory);
+    }
+}
+
+/**
+ * @brief Exports the library again into the directory of the previous export, nothing has changed since then
+ */
+void BenchmarkSuite::reexportLibrary()
+{
+    QBENCHMARK {
+        exportLibraryTo(QDir::tempPath() + "/MediaElch-Benchmark-Export");
+    }
+}
+
+/**
+ * @brief Reads every value of the TMDb responses like the scrapers did before they used JsonValue:
+ *        a new script engine evaluates each response
+ */
+void BenchmarkSuite::parseJsonWithScriptEngine()
+{
+    int size = 0;
+    QBENCHMARK {
+        foreach (const QString &name, tmdbFixtures()) {
+            QScriptEngine engine;
+            size += walkScriptValue(engine.evaluate("(" + QString::fromUtf8(fixture(name)) + ")"));
+        }
+    }
+    QVERIFY(size > 0);
+}
+
+/**
+ * @brief Reads every value of the TMDb responses with JsonValue
+ */
+void BenchmarkSuite::parseJsonWithJsonValue()
+{
+    int size = 0;
+    QBENCHMARK {
+        foreach (const QString &name, tmdbFixtures())
+            size += walkJsonValue(JsonValue::parse(fixture(name)));
+    }
+    QVERIFY(size > 0);
+}
+
+/**
+ * @brief Assigns the TMDb responses to a movie with the parser of the TMDb scraper
+ */
+void BenchmarkSuite::parseTmdbResponses()
+{
+    TMDb *tmdb = static_cast<TMDb*>(Manager::instance()->scraper("tmdb"));
+    QVERIFY(tmdb);
+    QList<int> infos = tmdb->scraperSupports();
+    Movie movie(QStringList());
+    QBENCHMARK {
+        movie.clear(infos);
+        foreach (const QString &name, tmdbFixtures())
+            tmdb->parseAndAssignInfos(QString::fromUtf8(fixture(name)), &movie, infos);
+    }
+    QVERIFY(!movie.name().isEmpty());
+}
+
+/**
+ * @brief Assigns a saved IMDB movie page to a movie with the field patterns of the IMDB scraper
+ */
+void BenchmarkSuite::parseImdbMovie()
+{
+    IMDB *imdb = static_cast<IMDB*>(Manager::instance()->scraper("imdb"));
+    QVERIFY(imdb);
+    QString html = QString::fromUtf8(fixture("imdb-movie.html"));
+    QList<int> infos = imdb->scraperSupports();
+    Movie movie(QStringList());
+    QBENCHMARK {
+        movie.clear(infos);
+        imdb->parseAndAssignInfos(html, &movie, infos);
+        imdb->parsePosters(html);
+    }
+    QVERIFY(!movie.name().isEmpty());
+}
+
+/**
+ * @brief Parses a saved IMDB search result page with the IMDB scraper
+ */
+void BenchmarkSuite::parseImdbSearch()
+{
+    IMDB *imdb = static_cast<IMDB*>(Manager::instance()->scraper("imdb"));
+    QVERIFY(imdb);
+    QString html = QString::fromUtf8(fixture("imdb-search.html"));
+    int results = 0;
+    QBENCHMARK {
+        results = imdb->parseSearch(html).count();
+    }
+    QVERIFY(results > 0);
+}
+
+void BenchmarkSuite::addMoviesToDatabase()
+{
+    Database *database = Manager::instance()->database();
+    QBENCHMARK {
+        database->clearMovies(databasePath);
+        database->transaction();
+        foreach (Movie *movie, Manager::instance()->movieModel()->movies())
+            database->add(movie, databasePath);
+        database->commit();
+    }
+}
+
+void BenchmarkSuite::readMoviesFromDatabase()
+{
+    QBENCHMARK {
+        QList<Movie*> movies = Manager::instance()->database()->movies(databasePath);
+        qDeleteAll(movies);
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef BENCHMARKSUITE_H
+#define BENCHMARKSUITE_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QObject>
+#include <QString>
+
+class MainWindow;
+
+/**
+ * @brief The BenchmarkSuite class
+ *        Generates a synthetic library, waits until MediaElch loaded it and then measures the hot paths with QBENCHMARK:
+ *        the file searchers (scanning and loading from the cache), loading and saving nfo files,
+ *        writing and reading the cache database, filtering and sorting movies and exporting the library.
+ *        Scraper responses are parsed from the fixtures in tests/benchmark/fixtures,
+ *        exports use the template in tests/benchmark/fixtures/export.
+ *        The suite changes the library and its cache database, so it uses its own settings and database.
+ */
+class BenchmarkSuite : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BenchmarkSuite(QObject *parent = 0);
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void scanMovies();
+    void loadMoviesFromCache();
+    void scanTvShows();
+    void loadTvShowsFromCache();
+    void scanConcerts();
+    void loadConcertsFromCache();
+    void loadMovieNfos();
+    void loadEpisodeNfos();
+    void saveMovieNfos();
+    void filterMovies();
+    void sortMovies();
+    void exportLibrary();
+    void reexportLibrary();
+    void parseJsonWithScriptEngine();
+    void parseJsonWithJsonValue();
+    void parseTmdbResponses();
+    void parseImdbMovie();
+    void parseImdbSearch();
+    // adding movies changes their database ids, so the database benchmarks run last
+    void addMoviesToDatabase();
+    void readMoviesFromDatabase();
+
+private:
+    MainWindow *m_mainWindow;
+    QHash<QString, QByteArray> m_fixtures;
+
+    QByteArray fixture(const QString &name);
+};
+
+#endif // BENCHMARKSUITE_H
@@ -0,0 +1,131 @@
+#include "StartupBenchmark.h"
+
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QSignalSpy>
+#include <QTest>
+#include <QTextStream>
+#include "globals/Manager.h"
+#include "globals/Tracer.h"
+#include "main/FileScannerDialog.h"
+#include "main/MainWindow.h"
+#include "settings/Settings.h"
+#include "tests/benchmark/SyntheticLibrary.h"
+
+static const char *runVariable = "MEDIAELCH_BENCHMARK_RUN";
+static const int loadTimeout = 30*60*1000;
+
+/**
+ * @brief StartupBenchmark::StartupBenchmark
+ * @param parent
+ */
+StartupBenchmark::StartupBenchmark(QObject *parent) :
+    QObject(parent)
+{
+}
+
+/**
+ * @brief Checks if the executable was started as one run of the startup benchmark
+ * @return True if MEDIAELCH_BENCHMARK_RUN is set
+ */
+bool StartupBenchmark::isRun()
+{
+    return !qgetenv(runVariable).isEmpty();
+}
+
+/**
+ * @brief Starts MediaElch with the library and trace file from MEDIAELCH_BENCHMARK_RUN ("<library>|<trace file>")
+ *        and prints the time until the library was loaded
+ * @return Exit code
+ */
+int StartupBenchmark::run()
+{
+    QStringList run = QString::fromLocal8Bit(qgetenv(runVariable)).split("|");
+    Tracer::instance()->setFileName(run.value(1));
+    setLibraryDirectories(SyntheticLibrary(run.value(0)));
+    Settings::instance()->setCheckForUpdates(false);
+
+    MainWindow w;
+    w.show();
+    QSignalSpy loaded(Manager::instance()->fileScannerDialog(), SIGNAL(accepted()));
+    if (!loaded.wait(loadTimeout))
+        return 1;
+
+    QTextStream out(stdout);
+    out << "MEDIAELCH_BENCHMARK " << Tracer::instance()->elapsed()/1000 << endl;
+    Tracer::instance()->save();
+    return 0;
+}
+
+/**
+ * @brief Uses the directories of the library as the only movie, tv show and concert directories
+ * @param library Synthetic library
+ */
+void StartupBenchmark::setLibraryDirectories(const SyntheticLibrary &library)
+{
+    SettingsDir dir;
+    dir.separateFolders = false;
+    dir.autoReload = false;
+    dir.path = library.moviePath();
+    Settings::instance()->setMovieDirectories(QList<SettingsDir>() << dir);
+    dir.path = library.tvShowPath();
+    Settings::instance()->setTvShowDirectories(QList<SettingsDir>() << dir);
+    dir.path = library.concertPath();
+    Settings::instance()->setConcertDirectories(QList<SettingsDir>() << dir);
+}
+
+void StartupBenchmark::initTestCase()
+{
+    QList<int> counts = SyntheticLibrary::counts();
+    SyntheticLibrary library(QDir::tempPath() + "/MediaElch-Benchmark");
+    QVERIFY(library.create(counts.at(0), counts.at(1), counts.at(2), counts.at(3)));
+    m_libraryPath = library.path();
+}
+
+/**
+ * @brief Loads the library with an empty cache database
+ */
+void StartupBenchmark::coldStart()
+{
+    QFile::remove(Settings::instance()->databaseDir() + "/MediaElch.sqlite");
+    qint64 elapsed = startRun(m_libraryPath, m_libraryPath + "/trace-cold.json");
+    QVERIFY(elapsed >= 0);
+    QTest::setBenchmarkResult(elapsed, QTest::WalltimeMilliseconds);
+}
+
+/**
+ * @brief Loads the library from the cache database written by the cold start
+ */
+void StartupBenchmark::warmStart()
+{
+    qint64 elapsed = startRun(m_libraryPath, m_libraryPath + "/trace-warm.json");
+    QVERIFY(elapsed >= 0);
+    QTest::setBenchmarkResult(elapsed, QTest::WalltimeMilliseconds);
+}
+
+/**
+ * @brief Starts a run of the startup benchmark and waits until it quits
+ * @param libraryPath Path of the synthetic library
+ * @param traceFile Trace file of the run
+ * @return Time until the library was loaded in milliseconds or -1
+ */
+qint64 StartupBenchmark::startRun(QString libraryPath, QString traceFile)
+{
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert(runVariable, libraryPath + "|" + traceFile);
+
+    QProcess process;
+    process.setProcessEnvironment(environment);
+    process.start(QCoreApplication::applicationFilePath());
+    if (!process.waitForFinished(-1))
+        return -1;
+
+    foreach (const QString &line, QString::fromLocal8Bit(process.readAllStandardOutput()).split("\n")) {
+        if (line.startsWith("MEDIAELCH_BENCHMARK "))
+            return line.mid(20).trimmed().toLongLong();
+    }
+    return -1;
+}
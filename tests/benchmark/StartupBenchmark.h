@@ -0,0 +1,36 @@
+#ifndef STARTUPBENCHMARK_H
+#define STARTUPBENCHMARK_H
+
+#include <QObject>
+#include <QString>
+
+class SyntheticLibrary;
+
+/**
+ * @brief The StartupBenchmark class
+ *        Generates a synthetic library and starts the benchmark executable twice as a MediaElch run with it:
+ *        the first run has an empty cache database (cold start), the second run loads the library from the cache (warm start).
+ *        A run creates the main window, quits as soon as the library is loaded and prints the elapsed time,
+ *        which is reported as the benchmark result. Both runs write a startup trace next to the library.
+ */
+class StartupBenchmark : public QObject
+{
+    Q_OBJECT
+public:
+    explicit StartupBenchmark(QObject *parent = 0);
+    static bool isRun();
+    static int run();
+    static void setLibraryDirectories(const SyntheticLibrary &library);
+
+private slots:
+    void initTestCase();
+    void coldStart();
+    void warmStart();
+
+private:
+    QString m_libraryPath;
+
+    static qint64 startRun(QString libraryPath, QString traceFile);
+};
+
+#endif // STARTUPBENCHMARK_H
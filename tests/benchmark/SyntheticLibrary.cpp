@@ -0,0 +1,267 @@
+#include "SyntheticLibrary.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QStringList>
+#include <QXmlStreamWriter>
+
+static const char *genres[] = { "Action", "Adventure", "Comedy", "Drama", "Horror", "Science Fiction", "Thriller", "Western" };
+static const int genreCount = 8;
+static const int episodesPerSeason = 10;
+
+/**
+ * @brief SyntheticLibrary::SyntheticLibrary
+ * @param path Directory which will contain the library
+ */
+SyntheticLibrary::SyntheticLibrary(QString path) :
+    m_path(path)
+{
+}
+
+/**
+ * @brief Removes an existing library in the directory and creates a new one
+ * @param movieCount Number of movies: every tenth movie is stacked, a DVD or a BluRay structure,
+ *        the others are alternately in their own folder and in the movie directory
+ * @param showCount Number of tv shows
+ * @param episodesPerShow Number of episodes per show, split into seasons of 10 episodes
+ * @param concertCount Number of concerts
+ * @return True if all files were written
+ */
+bool SyntheticLibrary::create(int movieCount, int showCount, int episodesPerShow, int concertCount)
+{
+    QDir dir(m_path);
+    if (dir.exists() && !dir.removeRecursively()) {
+        qWarning() << "Could not remove" << m_path;
+        return false;
+    }
+    if (!dir.mkpath(moviePath()) || !dir.mkpath(tvShowPath()) || !dir.mkpath(concertPath()))
+        return false;
+
+    for (int i=1 ; i<=movieCount ; ++i) {
+        if (!createMovie(i))
+            return false;
+    }
+    for (int i=1 ; i<=showCount ; ++i) {
+        if (!createTvShow(i, episodesPerShow))
+            return false;
+    }
+    for (int i=1 ; i<=concertCount ; ++i) {
+        if (!createConcert(i))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the size of the library used by the benchmarks.
+ *        MEDIAELCH_BENCHMARK_LIBRARY="movies,shows,episodes,concerts" overrides the default counts.
+ * @return Number of movies, tv shows, episodes per show and concerts
+ */
+QList<int> SyntheticLibrary::counts()
+{
+    QList<int> counts;
+    counts << 1000 << 100 << 20 << 100;
+    QStringList values = QString::fromLocal8Bit(qgetenv("MEDIAELCH_BENCHMARK_LIBRARY")).split(",", QString::SkipEmptyParts);
+    for (int i=0, n=qMin(values.count(), counts.count()) ; i<n ; ++i) {
+        bool ok;
+        int value = values.at(i).trimmed().toInt(&ok);
+        if (ok)
+            counts[i] = value;
+    }
+    return counts;
+}
+
+QString SyntheticLibrary::path() const
+{
+    return m_path;
+}
+
+QString SyntheticLibrary::moviePath() const
+{
+    return m_path + "/Movies";
+}
+
+QString SyntheticLibrary::tvShowPath() const
+{
+    return m_path + "/TV Shows";
+}
+
+QString SyntheticLibrary::concertPath() const
+{
+    return m_path + "/Concerts";
+}
+
+bool SyntheticLibrary::createMovie(int number)
+{
+    QString name = QString("Movie %1 (%2)").arg(number, 5, 10, QChar('0')).arg(1950 + number%70);
+    QString path = moviePath() + "/" + name;
+
+    switch (number%10) {
+    case 7:
+        // stacked parts
+        return QDir().mkpath(path) &&
+               writeFile(path + "/" + name + " cd1.mkv", QByteArray()) &&
+               writeFile(path + "/" + name + " cd2.mkv", QByteArray()) &&
+               writeFile(path + "/" + name + ".nfo", movieNfo(number));
+    case 8:
+        // DVD structure
+        return QDir().mkpath(path + "/VIDEO_TS") &&
+               writeFile(path + "/VIDEO_TS/VIDEO_TS.IFO", QByteArray()) &&
+               writeFile(path + "/VIDEO_TS/VTS_01_1.VOB", QByteArray()) &&
+               writeFile(path + "/VIDEO_TS/VIDEO_TS.nfo", movieNfo(number));
+    case 9:
+        // BluRay structure
+        return QDir().mkpath(path + "/BDMV/STREAM") &&
+               writeFile(path + "/BDMV/index.bdmv", QByteArray()) &&
+               writeFile(path + "/BDMV/STREAM/00000.m2ts", QByteArray()) &&
+               writeFile(path + "/BDMV/index.nfo", movieNfo(number));
+    default:
+        break;
+    }
+
+    // odd numbers are in their own folder, even numbers share the movie directory
+    if (number%2 == 0)
+        path = moviePath();
+    else if (!QDir().mkpath(path))
+        return false;
+    return writeFile(path + "/" + name + ".mkv", QByteArray()) &&
+           writeFile(path + "/" + name + ".nfo", movieNfo(number));
+}
+
+bool SyntheticLibrary::createTvShow(int number, int episodeCount)
+{
+    QString showPath = QString("%1/Show %2").arg(tvShowPath()).arg(number, 4, 10, QChar('0'));
+    if (!QDir().mkpath(showPath) || !writeFile(showPath + "/tvshow.nfo", tvShowNfo(number)))
+        return false;
+
+    for (int i=0 ; i<episodeCount ; ++i) {
+        int season = i/episodesPerSeason + 1;
+        int episode = i%episodesPerSeason + 1;
+        QString seasonPath = QString("%1/Season %2").arg(showPath).arg(season);
+        if (episode == 1 && !QDir().mkpath(seasonPath))
+            return false;
+        QString baseName = QString("%1/Show %2 S%3E%4").arg(seasonPath)
+                                                        .arg(number, 4, 10, QChar('0'))
+                                                        .arg(season, 2, 10, QChar('0'))
+                                                        .arg(episode, 2, 10, QChar('0'));
+        if (!writeFile(baseName + ".mkv", QByteArray()) || !writeFile(baseName + ".nfo", episodeNfo(number, season, episode)))
+            return false;
+    }
+    return true;
+}
+
+bool SyntheticLibrary::createConcert(int number)
+{
+    QString baseName = QString("%1/Concert %2").arg(concertPath()).arg(number, 4, 10, QChar('0'));
+    return writeFile(baseName + ".mkv", QByteArray()) && writeFile(baseName + ".nfo", concertNfo(number));
+}
+
+QByteArray SyntheticLibrary::movieNfo(int number)
+{
+    QByteArray nfo;
+    QXmlStreamWriter xml(&nfo);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    xml.writeStartElement("movie");
+    xml.writeTextElement("title", QString("Movie %1").arg(number, 5, 10, QChar('0')));
+    xml.writeTextElement("originaltitle", QString("Original Movie %1").arg(number));
+    xml.writeTextElement("rating", QString::number((number%100)/10.0));
+    xml.writeTextElement("year", QString::number(1950 + number%70));
+    xml.writeTextElement("plot", QString("Plot of movie %1. ").arg(number).repeated(10));
+    xml.writeTextElement("tagline", QString("Tagline %1").arg(number));
+    xml.writeTextElement("runtime", QString::number(80 + number%60));
+    xml.writeTextElement("mpaa", QString("Rated %1").arg(number%5));
+    xml.writeTextElement("playcount", QString::number(number%3));
+    xml.writeTextElement("id", QString("tt%1").arg(number, 7, 10, QChar('0')));
+    xml.writeTextElement("set", QString("Set %1").arg(number/5));
+    xml.writeTextElement("genre", genres[number%genreCount]);
+    xml.writeTextElement("genre", genres[(number/genreCount)%genreCount]);
+    xml.writeTextElement("tag", QString("Tag %1").arg(number%20));
+    xml.writeTextElement("studio", QString("Studio %1").arg(number%30));
+    xml.writeTextElement("country", "USA");
+    for (int i=0 ; i<5 ; ++i) {
+        xml.writeStartElement("actor");
+        xml.writeTextElement("name", QString("Actor %1").arg((number*7 + i)%500));
+        xml.writeTextElement("role", QString("Role %1").arg(i));
+        xml.writeEndElement();
+    }
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    return nfo;
+}
+
+QByteArray SyntheticLibrary::tvShowNfo(int number)
+{
+    QByteArray nfo;
+    QXmlStreamWriter xml(&nfo);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    xml.writeStartElement("tvshow");
+    xml.writeTextElement("title", QString("Show %1").arg(number, 4, 10, QChar('0')));
+    xml.writeTextElement("rating", QString::number((number%100)/10.0));
+    xml.writeTextElement("plot", QString("Plot of show %1. ").arg(number).repeated(10));
+    xml.writeTextElement("mpaa", QString("TV-%1").arg(number%5));
+    xml.writeTextElement("premiered", QString("%1-01-01").arg(1980 + number%40));
+    xml.writeTextElement("studio", QString("Network %1").arg(number%10));
+    xml.writeTextElement("genre", genres[number%genreCount]);
+    for (int i=0 ; i<5 ; ++i) {
+        xml.writeStartElement("actor");
+        xml.writeTextElement("name", QString("Actor %1").arg((number*11 + i)%500));
+        xml.writeTextElement("role", QString("Role %1").arg(i));
+        xml.writeEndElement();
+    }
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    return nfo;
+}
+
+QByteArray SyntheticLibrary::episodeNfo(int show, int season, int episode)
+{
+    QByteArray nfo;
+    QXmlStreamWriter xml(&nfo);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    xml.writeStartElement("episodedetails");
+    xml.writeTextElement("title", QString("Episode %1").arg(episode));
+    xml.writeTextElement("showtitle", QString("Show %1").arg(show, 4, 10, QChar('0')));
+    xml.writeTextElement("season", QString::number(season));
+    xml.writeTextElement("episode", QString::number(episode));
+    xml.writeTextElement("rating", QString::number(((show + episode)%100)/10.0));
+    xml.writeTextElement("plot", QString("Plot of episode %1. ").arg(episode).repeated(5));
+    xml.writeTextElement("aired", QString("%1-%2-01").arg(1980 + show%40).arg(episode%12 + 1, 2, 10, QChar('0')));
+    xml.writeTextElement("director", QString("Director %1").arg(show%50));
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    return nfo;
+}
+
+QByteArray SyntheticLibrary::concertNfo(int number)
+{
+    QByteArray nfo;
+    QXmlStreamWriter xml(&nfo);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument("1.0", true);
+    xml.writeStartElement("musicvideo");
+    xml.writeTextElement("title", QString("Concert %1").arg(number, 4, 10, QChar('0')));
+    xml.writeTextElement("artist", QString("Artist %1").arg(number%100));
+    xml.writeTextElement("album", QString("Album %1").arg(number));
+    xml.writeTextElement("year", QString::number(1960 + number%60));
+    xml.writeTextElement("plot", QString("Plot of concert %1. ").arg(number).repeated(5));
+    xml.writeTextElement("genre", genres[number%genreCount]);
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    return nfo;
+}
+
+bool SyntheticLibrary::writeFile(QString fileName, QByteArray content)
+{
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        qWarning() << "Could not write" << fileName;
+        return false;
+    }
+    file.write(content);
+    file.close();
+    return true;
+}
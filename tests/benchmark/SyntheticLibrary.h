@@ -0,0 +1,37 @@
+#ifndef SYNTHETICLIBRARY_H
+#define SYNTHETICLIBRARY_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+/**
+ * @brief The SyntheticLibrary class
+ *        Generates a library of empty video files with nfo files for benchmarks.
+ *        The same counts always produce the same files and contents.
+ */
+class SyntheticLibrary
+{
+public:
+    explicit SyntheticLibrary(QString path);
+    bool create(int movieCount, int showCount, int episodesPerShow, int concertCount);
+    static QList<int> counts();
+    QString path() const;
+    QString moviePath() const;
+    QString tvShowPath() const;
+    QString concertPath() const;
+
+private:
+    QString m_path;
+
+    bool createMovie(int number);
+    bool createTvShow(int number, int episodeCount);
+    bool createConcert(int number);
+    static QByteArray movieNfo(int number);
+    static QByteArray tvShowNfo(int number);
+    static QByteArray episodeNfo(int show, int season, int episode);
+    static QByteArray concertNfo(int number);
+    static bool writeFile(QString fileName, QByteArray content);
+};
+
+#endif // SYNTHETICLIBRARY_H
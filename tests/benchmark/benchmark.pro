@@ -0,0 +1,28 @@
+#-------------------------------------------------
+#
+# Benchmarks of the MediaElch hot paths, built on QTest
+#
+#-------------------------------------------------
+
+include(../../MediaElch.pri)
+
+QT       += testlib
+
+TARGET = mediaelch-benchmark
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+SOURCES += \
+    main.cpp \
+    SyntheticLibrary.cpp \
+    StartupBenchmark.cpp \
+    BenchmarkSuite.cpp
+
+HEADERS += \
+    SyntheticLibrary.h \
+    StartupBenchmark.h \
+    BenchmarkSuite.h
+
+RESOURCES += \
+    benchmark.qrc
@@ -0,0 +1,31 @@
+#include <QApplication>
+#include <QTest>
+#include <QTextStream>
+#include "globals/Tracer.h"
+#include "settings/Settings.h"
+#include "tests/benchmark/BenchmarkSuite.h"
+#include "tests/benchmark/StartupBenchmark.h"
+
+int main(int argc, char *argv[])
+{
+    Tracer::instance();
+    QApplication a(argc, argv);
+
+    // The benchmarks replace the library directories and the cache database, so they use their own settings
+    QCoreApplication::setOrganizationName("kvibes");
+    QCoreApplication::setApplicationName("MediaElch-Benchmark");
+    Settings::instance(qApp)->loadSettings();
+    if (Settings::instance()->advanced()->portableMode()) {
+        QTextStream(stderr) << "The benchmarks can't be used in portable mode, they would replace the cache database." << endl;
+        return 1;
+    }
+
+    if (StartupBenchmark::isRun())
+        return StartupBenchmark::run();
+
+    StartupBenchmark startupBenchmark;
+    BenchmarkSuite suite;
+    int ret = QTest::qExec(&startupBenchmark, argc, argv);
+    ret += QTest::qExec(&suite, argc, argv);
+    return ret;
+}
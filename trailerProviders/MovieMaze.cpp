@@ -1,6 +1,7 @@
 #include "MovieMaze.h"
 
 #include <QRegExp>
+#include "data/PreviewCache.h"
 
 MovieMaze::MovieMaze(QObject *parent)
 {
@@ -129,6 +130,10 @@ QList<TrailerResult> MovieMaze::parseTrailers(QString html)
 void MovieMaze::loadPreviewImages()
 {
     for (int i=0, n=m_currentTrailers.size() ; i<n ; ++i) {
+        if (!m_currentTrailers[i].previewImageLoaded && PreviewCache::instance()->contains(m_currentTrailers[i].preview, PreviewWidth)) {
+            m_currentTrailers[i].previewImage = PreviewCache::instance()->image(m_currentTrailers[i].preview, PreviewWidth);
+            m_currentTrailers[i].previewImageLoaded = !m_currentTrailers[i].previewImage.isNull();
+        }
         if (!m_currentTrailers[i].previewImageLoaded) {
             m_currentPreviewLoad = i;
             m_previewLoadReply = m_qnam->get(QNetworkRequest(m_currentTrailers[i].preview));
@@ -145,6 +150,9 @@ void MovieMaze::onLoadPreviewImageFinished()
     if (m_previewLoadReply->error() == QNetworkReply::NoError ) {
         QImage img;
         img.loadFromData(m_previewLoadReply->readAll());
+        if (!img.isNull() && img.width() > PreviewWidth)
+            img = img.scaledToWidth(PreviewWidth, Qt::SmoothTransformation);
+        PreviewCache::instance()->insert(m_currentTrailers[m_currentPreviewLoad].preview, PreviewWidth, img);
         m_currentTrailers[m_currentPreviewLoad].previewImage = img;
     }
     m_currentTrailers[m_currentPreviewLoad].previewImageLoaded = true;
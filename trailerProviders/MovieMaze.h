@@ -29,6 +29,8 @@ private slots:
     void onLoadPreviewImageFinished();
 
 private:
+    static const int PreviewWidth = 100;
+
     QNetworkAccessManager *m_qnam;
     QNetworkReply *m_searchReply;
     QNetworkReply *m_loadReply;
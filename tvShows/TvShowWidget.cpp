@@ -148,39 +148,42 @@ void TvShowWidget::onSaveInformation()
 void TvShowWidget::onSaveAll()
 {
     qDebug() << "Entered";
-    QList<TvShow*> shows = Manager::instance()->tvShowModel()->tvShows();
-    int episodesToSave = 0;
-    int episodesSaved = 0;
-    for (int i=0, n=shows.count() ; i<n ; ++i) {
-        if (shows[i]->hasChanged())
-            episodesToSave++;
-        for (int x=0, y=shows[i]->episodes().count() ; x<y ; ++x) {
-            if (shows[i]->episodes().at(x)->hasChanged())
-                episodesToSave++;
-        }
-    }
-    qDebug() << "episodesToSave=" << episodesToSave;
+    if (m_batchSaver)
+        return;
 
+    onSetDisabledTrue();
     NotificationBox::instance()->showProgressBar(tr("Saving changed TV Shows and Episodes"), Constants::TvShowWidgetSaveProgressMessageId);
     qApp->processEvents();
 
-    for (int i=0, n=shows.count() ; i<n ; ++i) {
-        if (shows[i]->hasChanged()) {
-            qDebug() << "SAVING TV SHOW" << shows[i]->name();
-            shows[i]->saveData(Manager::instance()->mediaCenterInterfaceTvShow());
-            NotificationBox::instance()->progressBarProgress(++episodesSaved, episodesToSave, Constants::TvShowWidgetSaveProgressMessageId);
-            qApp->processEvents(QEventLoop::ExcludeUserInputEvents);
-        }
-        for (int x=0, y=shows[i]->episodes().count() ; x<y ; ++x) {
-            if (shows[i]->episodes().at(x)->hasChanged()) {
-                shows[i]->episodes().at(x)->saveData(Manager::instance()->mediaCenterInterfaceTvShow());
-                NotificationBox::instance()->progressBarProgress(++episodesSaved, episodesToSave, Constants::TvShowWidgetSaveProgressMessageId);
-                qApp->processEvents(QEventLoop::ExcludeUserInputEvents);
-            }
-        }
-    }
+    m_batchSaver = new BatchSaver(this);
+    connect(m_batchSaver, SIGNAL(sigProgress(int,int)), this, SLOT(onSaveAllProgress(int,int)));
+    connect(m_batchSaver, SIGNAL(sigFinished()), this, SLOT(onSaveAllFinished()));
+    m_batchSaver->saveTvShows(Manager::instance()->tvShowModel()->tvShows());
+}
+
+/**
+ * @brief Called when all tv shows and episodes were saved
+ */
+void TvShowWidget::onSaveAllFinished()
+{
+    onSetEnabledTrue();
     NotificationBox::instance()->hideProgressBar(Constants::TvShowWidgetSaveProgressMessageId);
-    NotificationBox::instance()->showMessage(tr("All TV Shows and Episodes Saved"));
+    if (m_batchSaver->failedItemCount() > 0)
+        NotificationBox::instance()->showMessage(tr("%n TV Show(s) or Episode(s) could not be saved", "", m_batchSaver->failedItemCount()));
+    else
+        NotificationBox::instance()->showMessage(tr("All TV Shows and Episodes Saved"));
+    m_batchSaver->deleteLater();
+    m_batchSaver = 0;
+}
+
+/**
+ * @brief Updates the progress bar while saving all tv shows and episodes
+ * @param current Current progress
+ * @param max Maximum progress
+ */
+void TvShowWidget::onSaveAllProgress(int current, int max)
+{
+    NotificationBox::instance()->progressBarProgress(current, max, Constants::TvShowWidgetSaveProgressMessageId);
 }
 
 /**
@@ -1,7 +1,9 @@
 #ifndef TVSHOWWIDGET_H
 #define TVSHOWWIDGET_H
 
+#include <QPointer>
 #include <QWidget>
+#include "data/BatchSaver.h"
 #include "data/TvShow.h"
 #include "data/TvShowEpisode.h"
 
@@ -40,8 +42,13 @@ signals:
     void sigDownloadsProgress(int, int, int);
     void sigDownloadsFinished(int);
 
+private slots:
+    void onSaveAllProgress(int current, int max);
+    void onSaveAllFinished();
+
 private:
     Ui::TvShowWidget *ui;
+    QPointer<BatchSaver> m_batchSaver;
 };
 
 #endif // TVSHOWWIDGET_H
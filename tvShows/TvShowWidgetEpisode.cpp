@@ -58,7 +58,7 @@ TvShowWidgetEpisode::TvShowWidgetEpisode(QWidget *parent) :
 
     ui->directors->setItemDelegate(new ComboDelegate(ui->directors, WidgetTvShows, ComboDelegateDirectors));
     ui->writers->setItemDelegate(new ComboDelegate(ui->writers, WidgetTvShows, ComboDelegateWriters));
-    ui->thumbnail->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->thumbnail->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
 
     m_posterDownloadManager = new DownloadManager(this);
 
@@ -269,8 +269,9 @@ void TvShowWidgetEpisode::setEpisode(TvShowEpisode *episode)
 {
     qDebug() << "Entered, episode=" << episode->name();
     m_episode = episode;
+    connect(episode, SIGNAL(sigStreamDetailsLoaded(TvShowEpisode*)), this, SLOT(onStreamDetailsLoaded(TvShowEpisode*)), Qt::UniqueConnection);
     if (!episode->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails() && !episode->isDummy())
-        episode->loadStreamDetailsFromFile();
+        episode->loadStreamDetailsInBackground();
     ui->missingLabel->setVisible(episode->isDummy());
     updateEpisodeInfo();
 
@@ -366,7 +367,7 @@ void TvShowWidgetEpisode::updateEpisodeInfo()
     ui->videoWidth->setEnabled(m_episode->streamDetailsLoaded());
     ui->videoScantype->setEnabled(m_episode->streamDetailsLoaded());
 
-    if (!m_episode->thumbnailImage().isNull())
+    if (!m_episode->stagedThumbnailImage().isNull())
         ui->thumbnail->setImage(m_episode->thumbnailImage());
     else if (!Manager::instance()->mediaCenterInterface()->imageFileName(m_episode, ImageType::TvShowEpisodeThumb).isEmpty())
         ui->thumbnail->setImage(Manager::instance()->mediaCenterInterface()->imageFileName(m_episode, ImageType::TvShowEpisodeThumb));
@@ -482,6 +483,18 @@ void TvShowWidgetEpisode::updateStreamDetails(bool reloadFromFile)
     ui->videoHeight->blockSignals(false);
 }
 
+/**
+ * @brief Shows the streamdetails once the background probe has finished
+ * @param episode Episode whose streamdetails were loaded
+ */
+void TvShowWidgetEpisode::onStreamDetailsLoaded(TvShowEpisode *episode)
+{
+    if (episode != m_episode)
+        return;
+    updateStreamDetails();
+    ui->buttonRevert->setVisible(true);
+}
+
 /**
  * @brief Forces a reload of stream details
  */
@@ -634,9 +647,9 @@ void TvShowWidgetEpisode::onPosterDownloadFinished(DownloadManagerElement elem)
     if (elem.imageType == ImageType::TvShowEpisodeThumb) {
         qDebug() << "Got a backdrop";
         if (m_episode == elem.episode)
-            ui->thumbnail->setImage(elem.data);
+            ui->thumbnail->setImage(elem.image.data());
         ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(elem.episode, ImageType::TvShowEpisodeThumb));
-        elem.episode->setThumbnailImage(elem.data);
+        elem.episode->setThumbnailImage(elem.image);
     }
     if (m_posterDownloadManager->downloadQueueSize() == 0) {
         emit sigSetActionSaveEnabled(true, WidgetTvShows);
@@ -953,7 +966,7 @@ void TvShowWidgetEpisode::onActorChanged()
 {
     if (ui->actors->currentRow() < 0 || ui->actors->currentRow() >= ui->actors->rowCount() ||
         ui->actors->currentColumn() < 0 || ui->actors->currentColumn() >= ui->actors->colorCount()) {
-        ui->actor->setPixmap(QPixmap(":/img/man.png"));
+        ui->actor->setPixmap(Helper::scaledPixmap(":/img/man.png"));
         ui->actorResolution->setText("");
         return;
     }
@@ -968,7 +981,7 @@ void TvShowWidgetEpisode::onActorChanged()
         ui->actor->setPixmap(p.scaled(120, 180, Qt::KeepAspectRatio, Qt::SmoothTransformation));
         ui->actorResolution->setText(QString("%1 x %2").arg(p.width()).arg(p.height()));
     } else {
-        ui->actor->setPixmap(QPixmap(":/img/man.png"));
+        ui->actor->setPixmap(Helper::scaledPixmap(":/img/man.png"));
         ui->actorResolution->setText("");
     }
 }
@@ -66,6 +66,7 @@ private slots:
     void onWriterEdited(QTableWidgetItem *item);
     void onStreamDetailsEdited();
     void onReloadStreamDetails();
+    void onStreamDetailsLoaded(TvShowEpisode *episode);
     void updateStreamDetails(bool reloadFromFile = false);
 
     void onAddActor();
@@ -37,10 +37,10 @@ TvShowWidgetSeason::TvShowWidgetSeason(QWidget *parent) :
     ui->labelPoster->setFont(font);
     ui->labelThumb->setFont(font);
 
-    ui->poster->setDefaultPixmap(QPixmap(":/img/film_reel.png"));
-    ui->backdrop->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->banner->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(48, 48, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->thumb->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->poster->setDefaultPixmap(Helper::scaledPixmap(":/img/film_reel.png"));
+    ui->backdrop->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->banner->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(48, 48)));
+    ui->thumb->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
 
     m_downloadManager = new DownloadManager(this);
 
@@ -128,7 +128,7 @@ void TvShowWidgetSeason::updateImages(QList<int> images)
         if (!image)
             continue;
 
-        if (!m_show->seasonImage(m_season, imageType).isNull())
+        if (!m_show->stagedSeasonImage(m_season, imageType).isNull())
             image->setImage(m_show->seasonImage(m_season, imageType));
         else if (!Manager::instance()->mediaCenterInterfaceTvShow()->imageFileName(m_show, imageType, m_season).isEmpty() &&
                 (!m_show->imagesToRemove().contains(imageType) || !m_show->imagesToRemove().value(imageType).contains(m_season)))
@@ -177,11 +177,11 @@ void TvShowWidgetSeason::onDownloadFinished(DownloadManagerElement elem)
     foreach (ClosableImage *image, ui->groupBox_3->findChildren<ClosableImage*>()) {
         if (image->imageType() == elem.imageType) {
             if (elem.imageType == ImageType::TvShowSeasonBackdrop)
-                Helper::resizeBackdrop(elem.data);
+                elem.image = Helper::resizeBackdrop(elem.image);
             if (m_show == elem.show)
-                image->setImage(elem.data);
+                image->setImage(elem.image.data());
             ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(elem.show, elem.imageType, elem.season));
-            elem.show->setSeasonImage(elem.season, elem.imageType, elem.data);
+            elem.show->setSeasonImage(elem.season, elem.imageType, elem.image);
             break;
         }
     }
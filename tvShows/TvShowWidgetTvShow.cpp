@@ -54,13 +54,13 @@ TvShowWidgetTvShow::TvShowWidgetTvShow(QWidget *parent) :
     ui->labelBanner->setFont(font);
     ui->labelThumb->setFont(font);
 
-    ui->poster->setDefaultPixmap(QPixmap(":/img/film_reel.png"));
-    ui->backdrop->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->banner->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(48, 48, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->logo->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->clearArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->characterArt->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
-    ui->thumb->setDefaultPixmap(QPixmap(":/img/pictures_alt.png").scaled(64, 64, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    ui->poster->setDefaultPixmap(Helper::scaledPixmap(":/img/film_reel.png"));
+    ui->backdrop->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->banner->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(48, 48)));
+    ui->logo->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->clearArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->characterArt->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
+    ui->thumb->setDefaultPixmap(Helper::scaledPixmap(":/img/pictures_alt.png", QSize(64, 64)));
 
     font = ui->actorResolution->font();
     #ifdef Q_OS_WIN32
@@ -340,7 +340,7 @@ void TvShowWidgetTvShow::updateImages(QList<int> images)
         if (!image)
             continue;
 
-        if (!m_show->image(imageType).isNull())
+        if (!m_show->stagedImage(imageType).isNull())
             image->setImage(m_show->image(imageType));
         else if (!m_show->imagesToRemove().contains(imageType) && !Manager::instance()->mediaCenterInterface()->imageFileName(m_show, imageType).isEmpty())
             image->setImage(Manager::instance()->mediaCenterInterface()->imageFileName(m_show, imageType));
@@ -361,7 +361,6 @@ void TvShowWidgetTvShow::onSaveInformation()
     onSetEnabled(false);
     m_savingWidget->show();
     m_show->saveData(Manager::instance()->mediaCenterInterfaceTvShow());
-    m_show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), true);
     updateTvShowInfo();
     m_savingWidget->hide();
     onSetEnabled(true);
@@ -624,23 +623,23 @@ void TvShowWidgetTvShow::onPosterDownloadFinished(DownloadManagerElement elem)
 
     if (TvShow::seasonImageTypes().contains(elem.imageType)) {
         if (elem.imageType == ImageType::TvShowSeasonBackdrop)
-            Helper::resizeBackdrop(elem.data);
+            elem.image = Helper::resizeBackdrop(elem.image);
         ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(elem.show, elem.imageType, elem.season));
-        elem.show->setSeasonImage(elem.season, elem.imageType, elem.data);
+        elem.show->setSeasonImage(elem.season, elem.imageType, elem.image);
     } else if (elem.imageType == ImageType::TvShowExtraFanart) {
-        Helper::resizeBackdrop(elem.data);
-        elem.show->addExtraFanart(elem.data);
+        elem.image = Helper::resizeBackdrop(elem.image);
+        elem.show->addExtraFanart(elem.image);
         if (elem.show == m_show)
-            ui->fanarts->addImage(elem.data);
+            ui->fanarts->addImage(elem.image.data());
     } else {
         foreach (ClosableImage *image, ui->artStackedWidget->findChildren<ClosableImage*>()) {
             if (image->imageType() == elem.imageType) {
                 if (elem.imageType == ImageType::TvShowBackdrop)
-                    Helper::resizeBackdrop(elem.data);
+                    elem.image = Helper::resizeBackdrop(elem.image);
                 if (m_show == elem.show)
-                    image->setImage(elem.data);
+                    image->setImage(elem.image.data());
                 ImageCache::instance()->invalidateImages(Manager::instance()->mediaCenterInterface()->imageFileName(elem.show, elem.imageType));
-                elem.show->setImage(elem.imageType, elem.data);
+                elem.show->setImage(elem.imageType, elem.image);
                 break;
             }
         }